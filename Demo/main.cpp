@@ -319,6 +319,12 @@ void executeXmlReader(const std::string &xmlString)
                 break;
             }
 
+            case XmlReader::XmlReader::ParsingResult_EndOfDocument:
+            {
+                std::cout << "End of document" << std::endl;
+                break;
+            }
+
             default:
             {
                 std::cout << "Default: parsing result = " << result << std::endl;
@@ -0,0 +1,87 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_COMMON_ARENA_H
+#define EMBEDDEDSTAX_COMMON_ARENA_H
+
+#include <stddef.h>
+
+namespace EmbeddedStAX
+{
+namespace Common
+{
+/**
+ * Arena (monotonic memory pool)
+ *
+ * Memory is taken from large blocks and it is never returned to the arena individually. All of the
+ * memory is released in bulk with reset() (blocks are kept for reuse) or clear() (blocks are
+ * freed).
+ */
+class Arena
+{
+public:
+    // Public API
+    Arena(const size_t blockSize = 4096U);
+    ~Arena();
+
+    size_t blockSize() const;
+    size_t bytesAllocated() const;
+    size_t capacity() const;
+
+    void *allocate(const size_t size);
+    void reset();
+    void clear();
+
+private:
+    // Private types
+    struct Block
+    {
+        Block *next;
+        size_t size;
+        size_t used;
+    };
+
+private:
+    // Private API
+    Arena(const Arena &other);
+    Arena &operator=(const Arena &other);
+
+    static size_t alignSize(const size_t size);
+    static unsigned char *blockData(Block *block);
+    Block *createBlock(const size_t size);
+
+private:
+    // Private data
+    Block *m_firstBlock;
+    Block *m_currentBlock;
+    size_t m_blockSize;
+    size_t m_bytesAllocated;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_COMMON_ARENA_H
@@ -0,0 +1,193 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_COMMON_ARENAALLOCATOR_H
+#define EMBEDDEDSTAX_COMMON_ARENAALLOCATOR_H
+
+#include <EmbeddedStAX/Common/Arena.h>
+#include <new>
+#include <stddef.h>
+
+#if __cplusplus >= 201103L
+#include <type_traits>
+#endif
+
+namespace EmbeddedStAX
+{
+namespace Common
+{
+/**
+ * Standard library compatible allocator that takes memory from an arena
+ *
+ * If no arena is set then memory is taken from the global allocator. This makes the arena
+ * optional: a default constructed allocator behaves just like std::allocator.
+ *
+ * \note With C++11 and later the copies of containers made with the copy constructor use the
+ *       global allocator (see select_on_container_copy_construction()) so that the copies stay
+ *       valid after the arena is reset. Assignment never changes the allocator of the destination
+ *       container, only swap() exchanges the allocators.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+    // Public types
+    typedef T value_type;
+    typedef T *pointer;
+    typedef const T *const_pointer;
+    typedef T &reference;
+    typedef const T &const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef ArenaAllocator<U> other;
+    };
+
+#if __cplusplus >= 201103L
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::false_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+#endif
+
+public:
+    // Public API
+    ArenaAllocator()
+        : m_arena(NULL)
+    {
+    }
+
+    explicit ArenaAllocator(Arena *arena)
+        : m_arena(arena)
+    {
+    }
+
+    ArenaAllocator(const ArenaAllocator &other)
+        : m_arena(other.m_arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other)
+        : m_arena(other.arena())
+    {
+    }
+
+    ArenaAllocator &operator=(const ArenaAllocator &other)
+    {
+        m_arena = other.m_arena;
+        return *this;
+    }
+
+    Arena *arena() const
+    {
+        return m_arena;
+    }
+
+    pointer address(reference value) const
+    {
+        return &value;
+    }
+
+    const_pointer address(const_reference value) const
+    {
+        return &value;
+    }
+
+    pointer allocate(const size_type count, const void *hint = NULL)
+    {
+        (void)hint;
+        void *memory = NULL;
+
+        if (m_arena != NULL)
+        {
+            memory = m_arena->allocate(count * sizeof(T));
+        }
+        else
+        {
+            memory = ::operator new(count * sizeof(T));
+        }
+
+        return static_cast<pointer>(memory);
+    }
+
+    void deallocate(pointer memory, const size_type count)
+    {
+        (void)count;
+
+        if (m_arena == NULL)
+        {
+            ::operator delete(static_cast<void *>(memory));
+        }
+        else
+        {
+            // Arena memory is released in bulk
+        }
+    }
+
+    size_type max_size() const
+    {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    void construct(pointer memory, const T &value)
+    {
+        new (static_cast<void *>(memory)) T(value);
+    }
+
+    void destroy(pointer memory)
+    {
+        memory->~T();
+    }
+
+    ArenaAllocator select_on_container_copy_construction() const
+    {
+        return ArenaAllocator();
+    }
+
+private:
+    // Private data
+    Arena *m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &left, const ArenaAllocator<U> &right)
+{
+    return (left.arena() == right.arena());
+}
+
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &left, const ArenaAllocator<U> &right)
+{
+    return (left.arena() != right.arena());
+}
+}
+}
+
+#endif // EMBEDDEDSTAX_COMMON_ARENAALLOCATOR_H
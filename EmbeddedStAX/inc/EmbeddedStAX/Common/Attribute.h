@@ -29,6 +29,7 @@
 #define EMBEDDEDSTAX_COMMON_ATTRIBUTE_H
 
 #include <EmbeddedStAX/Common/Common.h>
+#include <EmbeddedStAX/Common/TypedValue.h>
 #include <EmbeddedStAX/Common/Utf.h>
 #include <list>
 
@@ -43,53 +44,83 @@ public:
     Attribute(const UnicodeString &name = UnicodeString(),
               const UnicodeString &value = UnicodeString(),
               const QuotationMark quotationMark = QuotationMark_Quote);
+    explicit Attribute(const UnicodeString::allocator_type &allocator);
     Attribute(const Attribute &other);
 
     Attribute &operator=(const Attribute &other);
 
+#if __cplusplus >= 201103L
+    Attribute(Attribute &&other) noexcept;
+    Attribute &operator=(Attribute &&other);
+#endif
+
+    UnicodeString::allocator_type allocator() const;
+    void swap(Attribute &other);
     void clear();
 
-    UnicodeString name() const;
+    const UnicodeString &name() const;
     void setName(const UnicodeString &name);
 
-    UnicodeString value() const;
+    const UnicodeString &value() const;
     void setValue(const UnicodeString &value,
                   const QuotationMark quotationMark = QuotationMark_Quote);
 
+    const UnicodeString &rawValue() const;
+    bool valueHasReferences() const;
+    void setRawValue(const UnicodeString &rawValue,
+                     const QuotationMark quotationMark,
+                     const bool hasReferences);
+
     QuotationMark valueQuotationMark() const;
 
+    bool valueAsInt64(int64_t *result) const;
+    bool valueAsDouble(double *result) const;
+    bool valueAsBool(bool *result) const;
+    bool valueAsTimestamp(Timestamp *result) const;
+
 private:
     // Private data
     UnicodeString m_name;
     UnicodeString m_value;
     QuotationMark m_quotationMark;
+    bool m_valueHasReferences;
+    mutable bool m_valueDecoded;
+    mutable UnicodeString m_decodedValue;
 };
 
 class AttributeList
 {
 public:
     // Public types
-    typedef std::list<Attribute>::const_iterator ConstIterator;
+    typedef std::list<Attribute, ArenaAllocator<Attribute> >::const_iterator ConstIterator;
 
 public:
     // Public API
-    AttributeList();
+    explicit AttributeList(
+            const UnicodeString::allocator_type &allocator = UnicodeString::allocator_type());
     AttributeList(const AttributeList &other);
     ~AttributeList();
 
     AttributeList &operator=(const AttributeList &other);
 
+#if __cplusplus >= 201103L
+    AttributeList(AttributeList &&other) noexcept;
+    AttributeList &operator=(AttributeList &&other);
+#endif
+
+    UnicodeString::allocator_type allocator() const;
+    void swap(AttributeList &other);
     void clear();
     size_t size() const;
 
-    void add(const Attribute &attribute);
+    const Attribute *add(const Attribute &attribute);
     const Attribute *attribute(const UnicodeString &name);
     ConstIterator begin() const;
     ConstIterator end() const;
 
 private:
     // Private data
-    std::list<Attribute> m_attributeList;
+    std::list<Attribute, ArenaAllocator<Attribute> > m_attributeList;
 };
 }
 }
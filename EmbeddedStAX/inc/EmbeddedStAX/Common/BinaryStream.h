@@ -0,0 +1,88 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_COMMON_BINARYSTREAM_H
+#define EMBEDDEDSTAX_COMMON_BINARYSTREAM_H
+
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+
+namespace EmbeddedStAX
+{
+namespace Common
+{
+/**
+ * Binary writer appends values to a byte string
+ *
+ * Numbers are written as variable length integers (7 bits per byte, least significant first) and
+ * strings are written as their UTF-8 size followed by the UTF-8 data.
+ */
+class BinaryWriter
+{
+public:
+    // Public API
+    explicit BinaryWriter(std::string *data);
+
+    void writeByte(const uint32_t value);
+    void writeNumber(size_t value);
+    void writeString(const UnicodeString &value);
+
+private:
+    // Private data
+    std::string *m_data;
+};
+
+/**
+ * Binary reader reads the values that were written with BinaryWriter
+ *
+ * \note Data must stay valid while it is read.
+ */
+class BinaryReader
+{
+public:
+    // Public API
+    BinaryReader(const char *data = NULL, const size_t size = 0U);
+
+    size_t size() const;
+    size_t position() const;
+    bool isEndOfData() const;
+
+    bool readByte(uint32_t *value);
+    bool readNumber(size_t *value);
+    bool readString(UnicodeString *value);
+    bool readData(const char *data, const size_t size);
+
+private:
+    // Private data
+    const char *m_data;
+    size_t m_size;
+    size_t m_position;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_COMMON_BINARYSTREAM_H
@@ -28,6 +28,7 @@
 #ifndef EMBEDDEDSTAX_COMMON_COMMON_H
 #define EMBEDDEDSTAX_COMMON_COMMON_H
 
+#include <EmbeddedStAX/Common/Utf.h>
 #include <string>
 #include <stdint.h>
 
@@ -43,6 +44,8 @@ enum QuotationMark
 };
 
 bool parseDigit(const uint32_t digitCharacter, const uint32_t base, uint32_t *digitValue);
+bool decodeReferences(const UnicodeString &value, UnicodeString *output);
+void appendCharacterReference(const uint32_t unicodeChar, UnicodeString *output);
 }
 }
 
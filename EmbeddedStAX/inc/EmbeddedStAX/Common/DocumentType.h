@@ -40,14 +40,22 @@ class DocumentType
 public:
     // Public API
     DocumentType(const UnicodeString &name = UnicodeString());
+    explicit DocumentType(const UnicodeString::allocator_type &allocator);
     DocumentType(const DocumentType &other);
 
     DocumentType &operator=(const DocumentType &other);
 
+#if __cplusplus >= 201103L
+    DocumentType(DocumentType &&other) noexcept;
+    DocumentType &operator=(DocumentType &&other);
+#endif
+
+    UnicodeString::allocator_type allocator() const;
+    void swap(DocumentType &other);
     bool isValid() const;
     void clear();
 
-    UnicodeString name() const;
+    const UnicodeString &name() const;
     void setName(const UnicodeString &name);
 
 private:
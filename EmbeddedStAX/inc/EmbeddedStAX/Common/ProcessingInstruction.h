@@ -41,17 +41,25 @@ public:
     // Public API
     ProcessingInstruction(const UnicodeString &piTarget = UnicodeString(),
                           const UnicodeString &piData = UnicodeString());
+    explicit ProcessingInstruction(const UnicodeString::allocator_type &allocator);
     ProcessingInstruction(const ProcessingInstruction &other);
 
     ProcessingInstruction &operator=(const ProcessingInstruction &other);
 
+#if __cplusplus >= 201103L
+    ProcessingInstruction(ProcessingInstruction &&other) noexcept;
+    ProcessingInstruction &operator=(ProcessingInstruction &&other);
+#endif
+
+    UnicodeString::allocator_type allocator() const;
+    void swap(ProcessingInstruction &other);
     bool isValid() const;
     void clear();
 
-    UnicodeString piTarget() const;
+    const UnicodeString &piTarget() const;
     void setPiTarget(const UnicodeString &piTarget);
 
-    UnicodeString piData() const;
+    const UnicodeString &piData() const;
     void setPiData(const UnicodeString &piData);
 
 private:
@@ -0,0 +1,85 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_COMMON_SYMBOLTABLE_H
+#define EMBEDDEDSTAX_COMMON_SYMBOLTABLE_H
+
+#include <EmbeddedStAX/Common/Utf.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace Common
+{
+/**
+ * Symbol table (string interning)
+ *
+ * Each unique string is stored only once and it is identified by a symbol ID. Symbol IDs are
+ * assigned sequentially (starting with 0) and they stay valid until the table is cleared.
+ *
+ * A table can be layered on top of a read-only base table that is shared by many tables (see
+ * setBaseTable()). Symbols of the base table keep their IDs and only the symbols that are not in
+ * the base table are stored in the layered table.
+ */
+class SymbolTable
+{
+public:
+    // Public constants
+    static const uint32_t InvalidSymbol;
+
+public:
+    // Public API
+    SymbolTable();
+
+    void clear();
+    size_t size() const;
+
+    const SymbolTable *baseTable() const;
+    void setBaseTable(const SymbolTable *baseTable);
+
+    uint32_t add(const UnicodeString &name);
+    uint32_t find(const UnicodeString &name) const;
+    const UnicodeString &symbol(const uint32_t id) const;
+
+private:
+    // Private API
+    static uint32_t hash(const UnicodeString &name);
+    uint32_t baseSize() const;
+    size_t findBucket(const UnicodeString &name, const uint32_t nameHash) const;
+    void rehash(const size_t bucketCount);
+
+private:
+    // Private data
+    const SymbolTable *m_baseTable;
+    std::vector<UnicodeString> m_symbols;
+    std::vector<uint32_t> m_symbolHashes;
+    std::vector<uint32_t> m_buckets;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_COMMON_SYMBOLTABLE_H
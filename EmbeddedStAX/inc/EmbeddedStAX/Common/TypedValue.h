@@ -0,0 +1,54 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_COMMON_TYPEDVALUE_H
+#define EMBEDDEDSTAX_COMMON_TYPEDVALUE_H
+
+#include <EmbeddedStAX/Common/Utf.h>
+#include <stdint.h>
+
+namespace EmbeddedStAX
+{
+namespace Common
+{
+/**
+ * Point in time (UTC)
+ */
+struct Timestamp
+{
+    int64_t seconds;        /**< Seconds since 1970-01-01T00:00:00Z */
+    uint32_t nanoseconds;   /**< Fraction of the second in nanoseconds */
+};
+
+bool parseInt64(const UnicodeString &value, int64_t *result);
+bool parseDouble(const UnicodeString &value, double *result);
+bool parseBool(const UnicodeString &value, bool *result);
+bool parseTimestamp(const UnicodeString &value, Timestamp *result);
+}
+}
+
+#endif // EMBEDDEDSTAX_COMMON_TYPEDVALUE_H
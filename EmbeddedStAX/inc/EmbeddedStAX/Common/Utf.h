@@ -28,6 +28,7 @@
 #ifndef EMBEDDEDSTAX_COMMON_UTF_H
 #define EMBEDDEDSTAX_COMMON_UTF_H
 
+#include <EmbeddedStAX/Common/ArenaAllocator.h>
 #include <string>
 #include <stdint.h>
 
@@ -35,7 +36,7 @@ namespace EmbeddedStAX
 {
 namespace Common
 {
-typedef std::basic_string<uint32_t> UnicodeString;
+typedef std::basic_string<uint32_t, std::char_traits<uint32_t>, ArenaAllocator<uint32_t> > UnicodeString;
 
 bool isUnicodeChar(const uint32_t uchar);
 bool compareUnicodeString(const size_t startPosition,
@@ -64,6 +65,7 @@ public:
     void clear();
     Result write(const char data);
     uint32_t getChar() const;
+    size_t incompleteSize() const;
 
     static std::string toUtf8(const uint32_t unicodeChar);
     static std::string toUtf8(const UnicodeString &unicodeString);
@@ -69,6 +69,12 @@ public:
 
     XmlDeclaration &operator=(const XmlDeclaration &other);
 
+#if __cplusplus >= 201103L
+    XmlDeclaration(XmlDeclaration &&other) noexcept;
+    XmlDeclaration &operator=(XmlDeclaration &&other);
+#endif
+
+    void swap(XmlDeclaration &other);
     bool isValid() const;
     void clear();
 
@@ -0,0 +1,71 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_ABSTRACTXMLHANDLER_H
+#define EMBEDDEDSTAX_XMLREADER_ABSTRACTXMLHANDLER_H
+
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/DocumentType.h>
+#include <EmbeddedStAX/Common/ProcessingInstruction.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/Common/XmlDeclaration.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Abstract XML handler can be used to receive the parsing results with XmlReader::parse() through
+ * callbacks
+ *
+ * Each callback receives references to the values stored in the reader. They are valid only until
+ * the callback returns. All of the callbacks return true by default so only the needed ones have to
+ * be overridden.
+ */
+class AbstractXmlHandler
+{
+public:
+    // Public API
+    AbstractXmlHandler();
+    virtual ~AbstractXmlHandler();
+
+    virtual bool onXmlDeclaration(const Common::XmlDeclaration &xmlDeclaration);
+    virtual bool onProcessingInstruction(const Common::ProcessingInstruction &processingInstruction);
+    virtual bool onDocumentType(const Common::DocumentType &documentType);
+    virtual bool onComment(const Common::UnicodeString &text);
+    virtual bool onStartOfElement(const Common::UnicodeString &name,
+                                  const Common::AttributeList &attributeList);
+    virtual bool onEndOfElement(const Common::UnicodeString &name);
+    virtual bool onTextNode(const Common::UnicodeString &text);
+    virtual bool onCData(const Common::UnicodeString &text);
+    virtual bool onTextChunk(const Common::UnicodeString &text);
+    virtual bool onEndOfDocument();
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_ABSTRACTXMLHANDLER_H
@@ -0,0 +1,81 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_DOCUMENTSCANNER_H
+#define EMBEDDEDSTAX_XMLREADER_DOCUMENTSCANNER_H
+
+#include <vector>
+#include <stddef.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Document scanner finds the extents of the XML documents that follow each other in UTF-8 encoded
+ * data (without any framing between them)
+ *
+ * A document ends with the end of its root element (end tag or empty element tag at depth 0). Only
+ * the markup that affects the nesting depth is recognized: comments, CDATA sections, processing
+ * instructions and document type declarations are skipped and quoted attribute values can contain
+ * any characters. Names, references and the characters of the documents are not validated, that is
+ * left to the XmlReader that parses the document.
+ *
+ * Extent of a document starts at the first non-whitespace character after the end of the previous
+ * document so it also contains the prolog of the document (the same as with
+ * ParsingResult_EndOfDocument) and it can be parsed with a new XmlReader.
+ */
+class DocumentScanner
+{
+public:
+    // Public types
+    struct Extent
+    {
+        size_t position;
+        size_t size;
+    };
+
+public:
+    // Public API
+    DocumentScanner();
+
+    void clear();
+    bool scan(const char *data, const size_t size);
+
+    size_t documentCount() const;
+    const Extent *document(const size_t index) const;
+    size_t scannedSize() const;
+
+private:
+    // Private data
+    std::vector<Extent> m_documents;
+    size_t m_scannedSize;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_DOCUMENTSCANNER_H
@@ -0,0 +1,120 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_EVENTBUFFER_H
+#define EMBEDDEDSTAX_XMLREADER_EVENTBUFFER_H
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/Common/XmlDeclaration.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Event buffer can be used to read a batch of parsing results with XmlReader::parseBatch()
+ *
+ * Events are stored in a flat array. Names (element names, attribute names, processing
+ * instruction targets and document type names) are stored as symbol IDs and all of the other
+ * strings (text, attribute values and processing instruction data) are stored in a shared string
+ * pool.
+ */
+class EventBuffer
+{
+public:
+    // Public types
+    struct Event
+    {
+        XmlReader::ParsingResult type;  /**< Parsing result */
+        uint32_t symbol;                /**< Element name, PI target or document type name */
+        size_t textPosition;            /**< Position of the text or PI data in the string pool */
+        size_t textSize;                /**< Size of the text or PI data */
+        size_t firstAttribute;          /**< Index of the first attribute of the element */
+        size_t attributeCount;          /**< Number of attributes of the element */
+    };
+
+    struct AttributeRecord
+    {
+        uint32_t symbol;                        /**< Attribute name */
+        size_t valuePosition;                   /**< Position of the value in the string pool */
+        size_t valueSize;                       /**< Size of the value */
+        Common::QuotationMark quotationMark;    /**< Quotation mark of the value */
+    };
+
+public:
+    // Public API
+    EventBuffer(const size_t capacity = 256U);
+
+    size_t capacity() const;
+    void setCapacity(const size_t capacity);
+
+    void clear();
+    void clearSymbolTable();
+
+    size_t size() const;
+    bool isEmpty() const;
+    bool isFull() const;
+
+    const Event *event(const size_t index) const;
+    const AttributeRecord *attribute(const Event &event, const size_t index) const;
+
+    const Common::UnicodeString &name(const Event &event) const;
+    const Common::UnicodeString &name(const AttributeRecord &attribute) const;
+    Common::UnicodeString text(const Event &event) const;
+    Common::UnicodeString value(const AttributeRecord &attribute) const;
+
+    const Common::XmlDeclaration &xmlDeclaration() const;
+    const Common::UnicodeString &stringPool() const;
+    const Common::SymbolTable &symbolTable() const;
+
+private:
+    // Private API
+    friend class XmlReader;
+
+    void addEvent(const XmlReader::ParsingResult type,
+                  const Common::UnicodeString &name,
+                  const Common::UnicodeString &text);
+    void addAttribute(const Common::Attribute &attribute);
+    void setXmlDeclaration(const Common::XmlDeclaration &xmlDeclaration);
+
+private:
+    // Private data
+    size_t m_capacity;
+    std::vector<Event> m_events;
+    std::vector<AttributeRecord> m_attributes;
+    Common::UnicodeString m_stringPool;
+    Common::SymbolTable m_symbolTable;
+    Common::XmlDeclaration m_xmlDeclaration;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_EVENTBUFFER_H
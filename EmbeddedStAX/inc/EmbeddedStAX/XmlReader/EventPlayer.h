@@ -0,0 +1,94 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_EVENTPLAYER_H
+#define EMBEDDEDSTAX_XMLREADER_EVENTPLAYER_H
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/BinaryStream.h>
+#include <EmbeddedStAX/Common/DocumentType.h>
+#include <EmbeddedStAX/Common/ProcessingInstruction.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/Common/XmlDeclaration.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Event player replays a recording of the EventRecorder
+ *
+ * Events are read with parse() and their values with the same accessors as with XmlReader, but
+ * the characters, names and references are not validated or decoded again so replaying is much
+ * faster than parsing the document. Names are decoded only once (when they are added to the name
+ * dictionary).
+ *
+ * \note Recording must stay valid while it is replayed.
+ */
+class EventPlayer
+{
+public:
+    // Public API
+    EventPlayer();
+
+    void clear();
+    bool open(const char *data, const size_t size);
+
+    XmlReader::ParsingResult parse();
+    XmlReader::ParsingResult lastParsingResult() const;
+
+    const Common::XmlDeclaration &xmlDeclaration() const;
+    const Common::ProcessingInstruction &processingInstruction() const;
+    const Common::DocumentType &documentType() const;
+    const Common::UnicodeString &text() const;
+    const Common::UnicodeString &name() const;
+    const Common::AttributeList &attributeList() const;
+
+private:
+    // Private API
+    XmlReader::ParsingResult readEvent();
+    bool readName(Common::UnicodeString *name);
+
+private:
+    // Private data
+    Common::BinaryReader m_reader;
+    XmlReader::ParsingResult m_lastParsingResult;
+    std::vector<Common::UnicodeString> m_names;
+    Common::XmlDeclaration m_xmlDeclaration;
+    Common::ProcessingInstruction m_processingInstruction;
+    Common::DocumentType m_documentType;
+    Common::UnicodeString m_text;
+    Common::UnicodeString m_name;
+    Common::UnicodeString m_value;
+    Common::AttributeList m_attributeList;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_EVENTPLAYER_H
@@ -0,0 +1,99 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_EVENTRECORDER_H
+#define EMBEDDEDSTAX_XMLREADER_EVENTRECORDER_H
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Event recorder writes the parsing results of the reader to a compact binary recording that can
+ * be replayed with EventPlayer without parsing the document again
+ *
+ * Recording starts with a header ("ESX" and the format version) which is followed by the events.
+ * Each event starts with its parsing result (one byte) which is followed by its fields:
+ *
+ * - XML declaration: version, encoding and standalone (one byte each)
+ * - processing instruction: target (name) and data (string)
+ * - document type: name
+ * - comment, text node, CDATA and text chunk: text (string)
+ * - start of element: name, number of attributes and for each attribute its name, quotation mark
+ *   (one byte) and value (string)
+ * - end of element: name
+ * - end of document: no fields
+ *
+ * Numbers and strings are written with Common::BinaryWriter. Names are written as an
+ * index in the name dictionary, a name that is not yet in the dictionary is added to it and its
+ * index is followed by the name (string). Text and attribute values are recorded with their
+ * references already decoded.
+ */
+class EventRecorder
+{
+public:
+    // Public constants
+    static const uint8_t FormatVersion;
+
+public:
+    // Public API
+    EventRecorder();
+
+    void clear();
+    XmlReader::ParsingResult record(XmlReader *xmlReader);
+
+    size_t eventCount() const;
+    const std::string &data() const;
+
+private:
+    // Private types
+    class Builder;
+    friend class Builder;
+
+private:
+    // Private API
+    void writeEvent(const XmlReader::ParsingResult type);
+    void writeByte(const uint32_t value);
+    void writeNumber(const size_t value);
+    void writeString(const Common::UnicodeString &value);
+    void writeName(const Common::UnicodeString &name);
+
+private:
+    // Private data
+    std::string m_data;
+    Common::SymbolTable m_nameTable;
+    size_t m_eventCount;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_EVENTRECORDER_H
@@ -0,0 +1,126 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_NAMESPACERESOLVER_H
+#define EMBEDDEDSTAX_XMLREADER_NAMESPACERESOLVER_H
+
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Expanded name (namespace and local name) of an element or attribute
+ */
+struct ExpandedName
+{
+    uint32_t namespaceId;   /**< Namespace ID (see NamespaceResolver::namespaceUri()) */
+    uint32_t localNameId;   /**< Local name ID (see NamespaceResolver::localName()) */
+};
+
+/**
+ * Namespace resolver resolves the prefixed names to expanded names
+ *
+ * Namespace URIs, prefixes and local names are interned in symbol tables so an expanded name is
+ * just a pair of IDs. Each prefix ID directly indexes its current namespace binding and the
+ * bindings that are overridden in a scope are saved on a stack so that they can be restored at the
+ * end of the scope (element).
+ *
+ * IDs stay the same for the lifetime of the resolver (reset() only ends all of the scopes) so they
+ * can be looked up in advance with addNamespace() and addLocalName().
+ *
+ * A resolver can be layered on top of a base resolver: names that are interned in the base
+ * resolver (for example the names of the known schemas) are shared read-only by all of the
+ * resolvers that are layered on top of it and they keep the same IDs in all of them.
+ */
+class NamespaceResolver
+{
+public:
+    // Public constants
+    static const uint32_t NoNamespace;
+    static const uint32_t XmlNamespace;
+    static const uint32_t XmlnsNamespace;
+
+public:
+    // Public API
+    explicit NamespaceResolver(const NamespaceResolver *baseResolver = NULL);
+
+    void reset();
+
+    uint32_t addNamespace(const Common::UnicodeString &uri);
+    uint32_t findNamespace(const Common::UnicodeString &uri) const;
+    const Common::UnicodeString &namespaceUri(const uint32_t namespaceId) const;
+
+    uint32_t addLocalName(const Common::UnicodeString &localName);
+    uint32_t findLocalName(const Common::UnicodeString &localName) const;
+    const Common::UnicodeString &localName(const uint32_t localNameId) const;
+
+    size_t scopeDepth() const;
+    void startScope();
+    bool declare(const Common::UnicodeString &prefix, const Common::UnicodeString &uri);
+    void endScope();
+    size_t declarationCount(const size_t scope) const;
+    bool declaration(const size_t scope,
+                     const size_t index,
+                     Common::UnicodeString *prefix,
+                     Common::UnicodeString *uri) const;
+
+    bool resolveElementName(const Common::UnicodeString &name, ExpandedName *expandedName);
+    bool resolveAttributeName(const Common::UnicodeString &name, ExpandedName *expandedName);
+
+private:
+    // Private types
+    struct SavedBinding
+    {
+        uint32_t prefixId;      /**< Prefix ID */
+        uint32_t namespaceId;   /**< Namespace ID that was bound to the prefix before the scope */
+    };
+
+private:
+    // Private API
+    bool resolveName(const Common::UnicodeString &name,
+                     const bool useDefaultNamespace,
+                     ExpandedName *expandedName);
+
+private:
+    // Private data
+    Common::SymbolTable m_namespaceTable;
+    Common::SymbolTable m_prefixTable;
+    Common::SymbolTable m_localNameTable;
+    std::vector<uint32_t> m_bindings;
+    std::vector<SavedBinding> m_savedBindings;
+    std::vector<size_t> m_scopes;
+    Common::UnicodeString m_prefix;
+    Common::UnicodeString m_localName;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_NAMESPACERESOLVER_H
@@ -0,0 +1,326 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_PARALLELDOCUMENTPARSER_H
+#define EMBEDDEDSTAX_XMLREADER_PARALLELDOCUMENTPARSER_H
+
+#if (__cplusplus >= 201103L)
+
+#include <EmbeddedStAX/XmlReader/DocumentScanner.h>
+#include <EmbeddedStAX/XmlReader/EventPlayer.h>
+#include <EmbeddedStAX/XmlReader/EventRecorder.h>
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Parser of the XML documents that follow each other in in-memory data (requires C++11)
+ *
+ * Extents of the documents are found with DocumentScanner and each document is parsed by one of
+ * the worker threads with its own XmlReader. Worker records the events of the document with
+ * EventRecorder and the handler replays them with EventPlayer on the calling thread, one document
+ * at a time and in the original order of the documents.
+ *
+ * Handler must implement:
+ * \code
+ * bool onDocument(const size_t index, EventPlayer &player);
+ * \endcode
+ * which returns true to continue with the next document or false to stop parsing.
+ *
+ * \note Workers run at most a few documents ahead of the handler so the memory used for the
+ *       recordings does not depend on the number of documents.
+ */
+class ParallelDocumentParser
+{
+public:
+    // Public API
+    /**
+     * Constructor
+     *
+     * \param threadCount   Number of worker threads (0 means one per hardware thread)
+     */
+    explicit ParallelDocumentParser(const size_t threadCount = 0U)
+        : m_threadCount(threadCount),
+          m_configuration(),
+          m_parsedSize(0U)
+    {
+        if (m_threadCount == 0U)
+        {
+            m_threadCount = std::thread::hardware_concurrency();
+        }
+
+        if (m_threadCount == 0U)
+        {
+            m_threadCount = 1U;
+        }
+    }
+
+    /**
+     * Get number of worker threads
+     *
+     * \return Number of worker threads
+     */
+    size_t threadCount() const
+    {
+        return m_threadCount;
+    }
+
+    /**
+     * Set configuration of the readers of the workers
+     *
+     * \param configuration Function that is called once for the reader of each worker (for example
+     *                      to set the event mask)
+     */
+    void setConfiguration(const std::function<void(XmlReader &)> &configuration)
+    {
+        m_configuration = configuration;
+    }
+
+    /**
+     * Parse the documents and pass them to the handler
+     *
+     * \param data      UTF-8 encoded XML documents
+     * \param size      Size of the data
+     * \param handler   Handler of the documents
+     *
+     * \retval ParsingResult_NeedMoreData   All of the complete documents were parsed, the rest of
+     *                                      the data starts at parsedSize()
+     * \retval ParsingResult_None           Parsing was stopped by the handler
+     * \retval ParsingResult_Error          Error (documents before the error were passed to the
+     *                                      handler)
+     */
+    template <typename Handler>
+    XmlReader::ParsingResult parse(const char *data, const size_t size, Handler &handler)
+    {
+        DocumentScanner scanner;
+        const bool scanned = scanner.scan(data, size);
+        const size_t documentCount = scanner.documentCount();
+
+        Shared shared(documentCount, m_threadCount * 4U);
+        std::vector<std::thread> workers;
+        XmlReader::ParsingResult result = XmlReader::ParsingResult_NeedMoreData;
+        m_parsedSize = 0U;
+
+        for (size_t i = 0U; (i < m_threadCount) && (i < documentCount); i++)
+        {
+            workers.push_back(std::thread(&ParallelDocumentParser::work,
+                                          this,
+                                          data,
+                                          std::cref(scanner),
+                                          std::ref(shared)));
+        }
+
+        // Pass the documents to the handler in their original order
+        EventPlayer player;
+
+        for (size_t i = 0U; (i < documentCount) &&
+                            (result == XmlReader::ParsingResult_NeedMoreData); i++)
+        {
+            Job &job = shared.jobs[i];
+
+            {
+                std::unique_lock<std::mutex> lock(shared.mutex);
+                shared.condition.wait(lock, [&job]() { return job.done; });
+            }
+
+            if ((job.result == XmlReader::ParsingResult_Error) ||
+                (!player.open(job.recording.data(), job.recording.size())))
+            {
+                result = XmlReader::ParsingResult_Error;
+            }
+            else if (!handler.onDocument(i, player))
+            {
+                result = XmlReader::ParsingResult_None;
+            }
+            else
+            {
+                // Continue with the next document
+            }
+
+            player.clear();
+            std::string().swap(job.recording);
+            m_parsedSize = scanner.document(i)->position + scanner.document(i)->size;
+
+            {
+                std::lock_guard<std::mutex> lock(shared.mutex);
+                shared.delivered = i + 1U;
+                shared.stop = (result != XmlReader::ParsingResult_NeedMoreData);
+            }
+
+            shared.condition.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(shared.mutex);
+            shared.stop = true;
+        }
+
+        shared.condition.notify_all();
+
+        for (size_t i = 0U; i < workers.size(); i++)
+        {
+            workers[i].join();
+        }
+
+        if ((result == XmlReader::ParsingResult_NeedMoreData) && (!scanned))
+        {
+            result = XmlReader::ParsingResult_Error;
+        }
+
+        return result;
+    }
+
+    /**
+     * Get size of the parsed data
+     *
+     * \return Position right after the last document that was passed to the handler
+     */
+    size_t parsedSize() const
+    {
+        return m_parsedSize;
+    }
+
+private:
+    // Private types
+    struct Job
+    {
+        Job()
+            : recording(),
+              result(XmlReader::ParsingResult_None),
+              done(false)
+        {
+        }
+
+        std::string recording;
+        XmlReader::ParsingResult result;
+        bool done;
+    };
+
+    struct Shared
+    {
+        Shared(const size_t documentCount, const size_t window)
+            : jobs(documentCount),
+              window(window),
+              next(0U),
+              delivered(0U),
+              stop(false),
+              mutex(),
+              condition()
+        {
+        }
+
+        std::vector<Job> jobs;
+        const size_t window;
+        size_t next;
+        size_t delivered;
+        bool stop;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+
+private:
+    // Private API
+    /**
+     * Worker thread: parse and record the documents
+     *
+     * \param data      UTF-8 encoded XML documents
+     * \param scanner   Extents of the documents
+     * \param shared    State shared with the other threads
+     */
+    void work(const char *data, const DocumentScanner &scanner, Shared &shared) const
+    {
+        XmlReader xmlReader;
+        EventRecorder recorder;
+        bool finished = false;
+
+        if (m_configuration)
+        {
+            m_configuration(xmlReader);
+        }
+
+        while (!finished)
+        {
+            size_t index = 0U;
+
+            {
+                // Take the next document (but do not get too far ahead of the handler)
+                std::unique_lock<std::mutex> lock(shared.mutex);
+                shared.condition.wait(lock, [&shared]() {
+                    return shared.stop ||
+                           (shared.next >= shared.jobs.size()) ||
+                           (shared.next < (shared.delivered + shared.window));
+                });
+
+                finished = shared.stop || (shared.next >= shared.jobs.size());
+                index = shared.next;
+                shared.next++;
+            }
+
+            if (!finished)
+            {
+                const DocumentScanner::Extent *extent = scanner.document(index);
+
+                xmlReader.clear();
+                recorder.clear();
+                xmlReader.writeData(std::string(&data[extent->position], extent->size));
+
+                const XmlReader::ParsingResult result = recorder.record(&xmlReader);
+                std::string recording = recorder.data();
+
+                {
+                    std::lock_guard<std::mutex> lock(shared.mutex);
+                    shared.jobs[index].recording.swap(recording);
+                    shared.jobs[index].result = result;
+                    shared.jobs[index].done = true;
+                }
+
+                shared.condition.notify_all();
+            }
+        }
+    }
+
+private:
+    // Private data
+    size_t m_threadCount;
+    std::function<void(XmlReader &)> m_configuration;
+    size_t m_parsedSize;
+};
+}
+}
+
+#endif // (__cplusplus >= 201103L)
+
+#endif // EMBEDDEDSTAX_XMLREADER_PARALLELDOCUMENTPARSER_H
@@ -0,0 +1,203 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_PARALLELTAPEBUILDER_H
+#define EMBEDDEDSTAX_XMLREADER_PARALLELTAPEBUILDER_H
+
+#if (__cplusplus >= 201103L)
+
+#include <EmbeddedStAX/XmlReader/Tape.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Builder of a Tape of a single large in-memory document with multiple threads (requires C++11)
+ *
+ * Document is split into segments at '<' characters and each segment is built speculatively by
+ * its own thread (see Tape::buildSegment()). Segments are then merged sequentially: nesting of the
+ * elements is checked in the context of the whole document and a segment that was started inside
+ * of a comment, CDATA section, processing instruction or attribute value is rebuilt from the end
+ * of that token. Result is the same as with Tape::build().
+ *
+ * \note Small documents are built with a single thread.
+ */
+class ParallelTapeBuilder
+{
+public:
+    // Public API
+    /**
+     * Constructor
+     *
+     * \param threadCount   Number of threads (0 means one per hardware thread)
+     */
+    explicit ParallelTapeBuilder(const size_t threadCount = 0U)
+        : m_threadCount(threadCount),
+          m_minimumSegmentSize(1024U * 1024U),
+          m_segments()
+    {
+        if (m_threadCount == 0U)
+        {
+            m_threadCount = std::thread::hardware_concurrency();
+        }
+
+        if (m_threadCount == 0U)
+        {
+            m_threadCount = 1U;
+        }
+    }
+
+    /**
+     * Get number of threads
+     *
+     * \return Number of threads
+     */
+    size_t threadCount() const
+    {
+        return m_threadCount;
+    }
+
+    /**
+     * Set minimum size of a segment
+     *
+     * \param size  Minimum size of a segment in bytes (1 MiB by default)
+     */
+    void setMinimumSegmentSize(const size_t size)
+    {
+        m_minimumSegmentSize = (size > 0U) ? size : 1U;
+    }
+
+    /**
+     * Get minimum size of a segment
+     *
+     * \return Minimum size of a segment in bytes
+     */
+    size_t minimumSegmentSize() const
+    {
+        return m_minimumSegmentSize;
+    }
+
+    /**
+     * Build the tape
+     *
+     * \param      data UTF-8 encoded XML document
+     * \param      size Size of the XML document
+     * \param[out] tape Tape
+     *
+     * \retval true     Success
+     * \retval false    Error (see Tape::errorPosition())
+     */
+    bool build(const char *data, const size_t size, Tape *tape)
+    {
+        bool success = false;
+        size_t segmentCount = size / m_minimumSegmentSize;
+
+        if (segmentCount > m_threadCount)
+        {
+            segmentCount = m_threadCount;
+        }
+
+        if ((data == NULL) || (tape == NULL))
+        {
+            // Error, invalid parameters
+        }
+        else if (segmentCount <= 1U)
+        {
+            success = tape->build(data, size);
+        }
+        else
+        {
+            // Split the document at the first '<' character after each of the split points
+            std::vector<size_t> boundaries(1U, 0U);
+
+            for (size_t i = 1U; i < segmentCount; i++)
+            {
+                const size_t splitPosition = (size / segmentCount) * i;
+                const void *markup = memchr(&data[splitPosition], '<', size - splitPosition);
+
+                if (markup != NULL)
+                {
+                    const size_t boundary = static_cast<size_t>(static_cast<const char *>(markup) -
+                                                                data);
+
+                    if (boundary > boundaries.back())
+                    {
+                        boundaries.push_back(boundary);
+                    }
+                }
+            }
+
+            boundaries.push_back(size);
+            m_segments.resize(boundaries.size() - 1U);
+
+            // Build the segments (the first one on the calling thread)
+            std::vector<std::thread> threads;
+
+            for (size_t i = 1U; i < m_segments.size(); i++)
+            {
+                threads.push_back(std::thread(&Tape::buildSegment,
+                                              &m_segments[i],
+                                              data,
+                                              size,
+                                              boundaries[i],
+                                              boundaries[i + 1U]));
+            }
+
+            m_segments[0].buildSegment(data, size, boundaries[0], boundaries[1]);
+
+            for (size_t i = 0U; i < threads.size(); i++)
+            {
+                threads[i].join();
+            }
+
+            success = tape->merge(&m_segments[0], m_segments.size());
+
+            for (size_t i = 0U; i < m_segments.size(); i++)
+            {
+                m_segments[i].clear();
+            }
+        }
+
+        return success;
+    }
+
+private:
+    // Private data
+    size_t m_threadCount;
+    size_t m_minimumSegmentSize;
+    std::vector<Tape> m_segments;
+};
+}
+}
+
+#endif // (__cplusplus >= 201103L)
+
+#endif // EMBEDDEDSTAX_XMLREADER_PARALLELTAPEBUILDER_H
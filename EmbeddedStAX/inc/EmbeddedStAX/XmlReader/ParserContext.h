@@ -0,0 +1,76 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_PARSERCONTEXT_H
+#define EMBEDDEDSTAX_XMLREADER_PARSERCONTEXT_H
+
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/XmlReader/NamespaceResolver.h>
+#include <EmbeddedStAX/XmlReader/PathSelector.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Parser context holds the lookup tables that can be shared by many XML readers
+ *
+ * The context is built once (attribute keys, selected paths and the namespace URIs and local names
+ * of the known schemas) and then it is referenced by the readers (see
+ * XmlReader::setParserContext()). Tables of each reader are layered on top of the tables of the
+ * context so the shared names keep the same IDs in all of the readers and each reader stores only
+ * the names that are not in the context.
+ *
+ * \note Readers only read the context so it can be shared by readers in different threads, but it
+ *       must not be modified or destroyed while it is referenced by a reader.
+ */
+class ParserContext
+{
+public:
+    // Public API
+    ParserContext();
+
+    uint32_t registerAttributeKey(const Common::UnicodeString &name);
+    const Common::SymbolTable &attributeKeyTable() const;
+
+    bool addSelectedPath(const Common::UnicodeString &path);
+    const PathSelector &pathSelector() const;
+
+    NamespaceResolver &namespaceResolver();
+    const NamespaceResolver &namespaceResolver() const;
+
+private:
+    // Private data
+    Common::SymbolTable m_attributeKeyTable;
+    PathSelector m_pathSelector;
+    NamespaceResolver m_namespaceResolver;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_PARSERCONTEXT_H
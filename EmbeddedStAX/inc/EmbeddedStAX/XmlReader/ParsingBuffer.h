@@ -61,8 +61,12 @@ public:
 
     Common::UnicodeString substring(const size_t position,
                                     const size_t size = std::string::npos) const;
+    void appendSubstring(const size_t position,
+                         const size_t size,
+                         Common::UnicodeString *output) const;
 
     size_t writeData(const std::string &data);
+    size_t incompleteSize() const;
 
 private:
     // Private data
@@ -0,0 +1,110 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_PATHSELECTOR_H
+#define EMBEDDEDSTAX_XMLREADER_PATHSELECTOR_H
+
+#include <EmbeddedStAX/Common/ArenaAllocator.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <list>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Path selector matches the open elements against a set of element paths
+ *
+ * Supported path syntax is a subset of XPath location paths made only of element name steps:
+ * - "/a/b/c" selects element "c" which is a child of "b" which is a child of the root element "a"
+ * - "//c" selects element "c" anywhere in the document
+ * - "/a//c" selects element "c" anywhere inside the root element "a"
+ * - "*" can be used instead of an element name to match any element
+ *
+ * A selector can be layered on top of a read-only base selector that is shared by many selectors
+ * (see setBaseSelector()): an element is then matched against the paths of both selectors.
+ */
+class PathSelector
+{
+public:
+    // Public types
+    typedef std::list<Common::UnicodeString, Common::ArenaAllocator<Common::UnicodeString> >
+            ElementNameList;
+
+    enum Match
+    {
+        Match_None,
+        Match_Ancestor,
+        Match_Selected
+    };
+
+public:
+    // Public API
+    PathSelector();
+
+    void clear();
+    size_t size() const;
+    bool isEmpty() const;
+
+    const PathSelector *baseSelector() const;
+    void setBaseSelector(const PathSelector *baseSelector);
+
+    bool addPath(const Common::UnicodeString &path);
+
+    Match match(const ElementNameList &openElementList,
+                const Common::UnicodeString *emptyElementName) const;
+
+private:
+    // Private types
+    struct Step
+    {
+        Common::UnicodeString name; /**< Element name (empty matches any element) */
+        bool descendant;            /**< Step is preceded by "//" */
+    };
+
+    typedef std::vector<Step> Path;
+
+private:
+    // Private API
+    static Match matchPath(const Path &path,
+                           const ElementNameList &openElementList,
+                           const Common::UnicodeString *emptyElementName);
+    static bool executeStep(const Path &path,
+                            const Common::UnicodeString &name,
+                            const std::vector<bool> &stateList,
+                            std::vector<bool> *nextStateList);
+
+private:
+    // Private data
+    const PathSelector *m_baseSelector;
+    std::vector<Path> m_pathList;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_PATHSELECTOR_H
@@ -0,0 +1,116 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_STATICXMLHANDLER_H
+#define EMBEDDEDSTAX_XMLREADER_STATICXMLHANDLER_H
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/DocumentType.h>
+#include <EmbeddedStAX/Common/ProcessingInstruction.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/Common/XmlDeclaration.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Base class for the handlers that are used with the XmlReader::parse(Handler &) template
+ *
+ * Callbacks are not virtual: the derived handler hides the callbacks that it needs and the rest
+ * of them resolve to the inline no-op callbacks of this class, which compile away. The derived
+ * handler can also redefine HandlerEventMask to the events that it handles so that the reader does
+ * not store the values of the other events at all.
+ *
+ * Each callback returns true to continue parsing or false to stop parsing.
+ */
+class StaticXmlHandler
+{
+public:
+    // Public types
+    enum
+    {
+        HandlerEventMask = XmlReader::EventMask_All
+    };
+
+public:
+    // Public API
+    bool onXmlDeclaration(const Common::XmlDeclaration &)
+    {
+        return true;
+    }
+
+    bool onProcessingInstruction(const Common::ProcessingInstruction &)
+    {
+        return true;
+    }
+
+    bool onDocumentType(const Common::DocumentType &)
+    {
+        return true;
+    }
+
+    bool onComment(const Common::UnicodeString &)
+    {
+        return true;
+    }
+
+    bool onStartOfElement(const Common::UnicodeString &, const Common::AttributeList &)
+    {
+        return true;
+    }
+
+    bool onEndOfElement(const Common::UnicodeString &)
+    {
+        return true;
+    }
+
+    bool onTextNode(const Common::UnicodeString &)
+    {
+        return true;
+    }
+
+    bool onCData(const Common::UnicodeString &)
+    {
+        return true;
+    }
+
+    bool onTextChunk(const Common::UnicodeString &)
+    {
+        return true;
+    }
+
+    bool onEndOfDocument()
+    {
+        return true;
+    }
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_STATICXMLHANDLER_H
@@ -0,0 +1,75 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_STRUCTURALINDEX_H
+#define EMBEDDEDSTAX_XMLREADER_STRUCTURALINDEX_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Structural index of an in-memory UTF-8 encoded XML document
+ *
+ * Index holds positions of all of the structural characters ('<', '>', '&', '"', "'", '/', '?' and
+ * '!') in the document. All of the structural characters are ASCII characters so they can be
+ * found without decoding the UTF-8 sequences.
+ */
+class StructuralIndex
+{
+public:
+    // Public API
+    StructuralIndex();
+
+    void clear();
+    void build(const char *data, const size_t size);
+    void append(const char *data, const size_t startPosition, const size_t endPosition);
+    void append(const StructuralIndex &index,
+                const size_t startPosition,
+                const size_t endPosition);
+
+    size_t size() const;
+    size_t position(const size_t index) const;
+
+    static bool isStructuralChar(const char character);
+
+private:
+    // Private API
+    static uint64_t findCandidates(const uint64_t word);
+
+private:
+    // Private data
+    std::vector<size_t> m_positions;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_STRUCTURALINDEX_H
@@ -0,0 +1,163 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_TAPE_H
+#define EMBEDDEDSTAX_XMLREADER_TAPE_H
+
+#include <EmbeddedStAX/XmlReader/StructuralIndex.h>
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Common.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/Common/XmlDeclaration.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Tape can be used to parse a large in-memory UTF-8 encoded XML document in two passes
+ *
+ * The first pass builds a structural index of the document (see StructuralIndex). The second pass
+ * builds a compact tape of events from the index without re-scanning character data. Events use
+ * the same parsing results as XmlReader and they refer to the document with byte offsets, strings
+ * are decoded only when they are requested.
+ *
+ * A large document can also be split into segments that are built independently (for example in
+ * parallel, see ParallelTapeBuilder) and then merged into one tape.
+ *
+ * \note Document must stay valid while the tape is used.
+ * \note Tape checks the document structure (markup, nesting and matching element names), but it
+ *       does not validate names, characters and references like XmlReader does.
+ */
+class Tape
+{
+public:
+    // Public types
+    struct Entry
+    {
+        XmlReader::ParsingResult type;  /**< Parsing result */
+        size_t namePosition;            /**< Element name, PI target or document type name */
+        size_t nameSize;                /**< Size of the name */
+        size_t textPosition;            /**< Text, CDATA, comment text or PI data */
+        size_t textSize;                /**< Size of the text */
+        bool textHasReferences;         /**< Text contains references */
+        size_t firstAttribute;          /**< Index of the first attribute of the element */
+        size_t attributeCount;          /**< Number of attributes of the element */
+    };
+
+    struct AttributeEntry
+    {
+        size_t namePosition;                    /**< Attribute name */
+        size_t nameSize;                        /**< Size of the attribute name */
+        size_t valuePosition;                   /**< Attribute value */
+        size_t valueSize;                       /**< Size of the attribute value */
+        bool valueHasReferences;                /**< Attribute value contains references */
+        Common::QuotationMark quotationMark;    /**< Quotation mark of the value */
+    };
+
+public:
+    // Public API
+    Tape();
+
+    void clear();
+    bool build(const char *data, const size_t size);
+    bool buildSegment(const char *data,
+                      const size_t size,
+                      const size_t startPosition,
+                      const size_t endPosition);
+    bool merge(const Tape *segments, const size_t segmentCount);
+    size_t errorPosition() const;
+
+    size_t size() const;
+    const Entry *entry(const size_t index) const;
+    const AttributeEntry *attribute(const Entry &entry, const size_t index) const;
+
+    Common::UnicodeString name(const Entry &entry) const;
+    Common::UnicodeString text(const Entry &entry) const;
+    Common::UnicodeString name(const AttributeEntry &attribute) const;
+    Common::UnicodeString value(const AttributeEntry &attribute) const;
+
+    const Common::XmlDeclaration &xmlDeclaration() const;
+    const StructuralIndex &structuralIndex() const;
+
+private:
+    // Private API
+    bool readRange(const size_t startPosition, const size_t endPosition);
+    bool appendSegment(const Tape &segment);
+    bool readMarkup(const size_t position, size_t *endPosition);
+    bool readProcessingInstruction(const size_t position, size_t *endPosition);
+    bool readComment(const size_t position, size_t *endPosition);
+    bool readCData(const size_t position, size_t *endPosition);
+    bool readDocumentType(const size_t position, size_t *endPosition);
+    bool readStartOfElement(const size_t position, size_t *endPosition);
+    bool readEndOfElement(const size_t position, size_t *endPosition);
+
+    void addEntry(const XmlReader::ParsingResult type,
+                  const size_t namePosition,
+                  const size_t nameSize,
+                  const size_t textPosition = 0U,
+                  const size_t textSize = 0U,
+                  const bool textHasReferences = false);
+
+    size_t findStructuralChar(const size_t startPosition,
+                              const char character,
+                              bool *hasReferences = NULL);
+    size_t findTerminator(const size_t startPosition, const char *terminator);
+    size_t findNameEnd(const size_t position) const;
+    size_t skipWhitespace(const size_t position) const;
+    bool compare(const size_t position, const char *value) const;
+    bool isWhitespace(const size_t startPosition, const size_t endPosition) const;
+    static bool isWhitespace(const char character);
+
+    Common::UnicodeString decode(const size_t position,
+                                 const size_t size,
+                                 const bool hasReferences) const;
+
+private:
+    // Private data
+    const char *m_data;
+    size_t m_size;
+    size_t m_index;
+    size_t m_errorPosition;
+    bool m_rootFound;
+    bool m_segment;
+    bool m_segmentValid;
+    size_t m_segmentStart;
+    size_t m_segmentEnd;
+    size_t m_segmentStop;
+    size_t m_indexEnd;
+    StructuralIndex m_structuralIndex;
+    std::vector<Entry> m_entries;
+    std::vector<AttributeEntry> m_attributes;
+    std::vector<size_t> m_openElements;
+    Common::XmlDeclaration m_xmlDeclaration;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_TAPE_H
@@ -45,6 +45,7 @@ public:
     {
         Result_NeedMoreData,
         Result_Success,
+        Result_TextChunk,
         Result_Error
     };
 
@@ -52,7 +53,8 @@ public:
     {
         Option_None,
         Option_Synchronization,
-        Option_IgnoreLeadingWhitespace
+        Option_IgnoreLeadingWhitespace,
+        Option_SkipValue
     };
 
     enum ParserType
@@ -64,6 +66,7 @@ public:
         ParserType_Name,
         ParserType_ProcessingInstruction,
         ParserType_Reference,
+        ParserType_SkipElement,
         ParserType_TextNode,
         ParserType_TokenType,
     };
@@ -98,6 +101,7 @@ public:
     bool initialize(ParsingBuffer *parsingBuffer, const Option option = Option_None);
     virtual Result parse() = 0;
     void deinitialize();
+    void setArena(Common::Arena *arena);
 
 protected:
     // Protected API
@@ -106,8 +110,10 @@ protected:
     ParsingBuffer *parsingBuffer();
     void setTokenType(const TokenType tokenType);
     void setTerminationChar(const uint32_t uchar);
+    const Common::UnicodeString::allocator_type &allocator() const;
     virtual bool initializeAdditionalData() = 0;
     virtual void deinitializeAdditionalData() = 0;
+    virtual void rebindAdditionalData() = 0;
 
 private:
     // Private data
@@ -117,6 +123,7 @@ private:
     TokenType m_tokenType;
     uint32_t m_terminationChar;
     const ParserType m_parserType;
+    Common::UnicodeString::allocator_type m_allocator;
 };
 }
 }
@@ -45,7 +45,8 @@ public:
     AttributeValueParser();
     ~AttributeValueParser();
 
-    Common::UnicodeString value() const;
+    const Common::UnicodeString &value() const;
+    bool valueHasReferences() const;
 
     virtual Result parse();
 
@@ -65,6 +66,7 @@ private:
     virtual bool setOption(const Option option);
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingQuotationMark();
     State executeStateReadingAttributeValue();
@@ -75,6 +77,7 @@ private:
     State m_state;
     ReferenceParser m_referenceParser;
     Common::UnicodeString m_value;
+    bool m_valueHasReferences;
     Common::QuotationMark m_quotationMark;
 };
 }
@@ -45,7 +45,11 @@ public:
     CDataParser();
     ~CDataParser();
 
-    Common::UnicodeString text() const;
+    const Common::UnicodeString &text() const;
+    void swapText(Common::UnicodeString *text);
+
+    size_t chunkSize() const;
+    void setChunkSize(const size_t chunkSize);
 
     virtual Result parse();
 
@@ -54,6 +58,7 @@ private:
     enum State
     {
         State_ReadingCData,
+        State_TextChunkRead,
         State_Finished,
         State_Error
     };
@@ -62,6 +67,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingCData();
 
@@ -69,6 +75,7 @@ private:
     // Private data
     State m_state;
     Common::UnicodeString m_text;
+    size_t m_chunkSize;
 };
 }
 }
@@ -44,7 +44,8 @@ public:
     CommentParser();
     ~CommentParser();
 
-    Common::UnicodeString text() const;
+    const Common::UnicodeString &text() const;
+    void swapText(Common::UnicodeString *text);
 
     virtual Result parse();
 
@@ -61,6 +62,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingComment();
 
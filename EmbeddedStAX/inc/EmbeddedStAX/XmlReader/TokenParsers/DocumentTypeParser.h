@@ -46,7 +46,8 @@ public:
     DocumentTypeParser();
     ~DocumentTypeParser();
 
-    Common::DocumentType documentType() const;
+    const Common::DocumentType &documentType() const;
+    void swapDocumentType(Common::DocumentType *documentType);
 
     virtual Result parse();
 
@@ -65,6 +66,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingName();
     State executeStateReadingEnd();
@@ -44,7 +44,8 @@ public:
     EndOfElementParser();
     ~EndOfElementParser();
 
-    Common::UnicodeString name() const;
+    const Common::UnicodeString &name() const;
+    void swapName(Common::UnicodeString *name);
 
     virtual Result parse();
 
@@ -62,6 +63,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingElementName();
     State executeStateReadingEndOfElement();
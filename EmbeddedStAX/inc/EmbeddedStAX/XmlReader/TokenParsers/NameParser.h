@@ -44,7 +44,7 @@ public:
     NameParser();
     ~NameParser();
 
-    Common::UnicodeString value() const;
+    const Common::UnicodeString &value() const;
 
     virtual Result parse();
 
@@ -63,6 +63,7 @@ private:
     virtual bool setOption(const Option option);
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingNameStartChar();
     State executeStateReadingNameChars();
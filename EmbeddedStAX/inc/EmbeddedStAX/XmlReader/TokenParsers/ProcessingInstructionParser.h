@@ -47,8 +47,9 @@ public:
     ProcessingInstructionParser();
     ~ProcessingInstructionParser();
 
-    Common::ProcessingInstruction processingInstruction() const;
-    Common::XmlDeclaration xmlDeclaration() const;
+    const Common::ProcessingInstruction &processingInstruction() const;
+    void swapProcessingInstruction(Common::ProcessingInstruction *processingInstruction);
+    const Common::XmlDeclaration &xmlDeclaration() const;
 
     virtual Result parse();
 
@@ -66,6 +67,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingPiTarget();
     State executeStateReadingPiData();
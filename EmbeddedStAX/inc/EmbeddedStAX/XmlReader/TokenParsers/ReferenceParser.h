@@ -44,7 +44,7 @@ public:
     ReferenceParser();
     ~ReferenceParser();
 
-    Common::UnicodeString value() const;
+    const Common::UnicodeString &value() const;
 
     virtual Result parse();
 
@@ -66,6 +66,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingStartOfReference();
     State executeStateReadingReferenceType();
@@ -0,0 +1,97 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_TOKENPARSERS_SKIPELEMENTPARSER_H
+#define EMBEDDEDSTAX_XMLREADER_TOKENPARSERS_SKIPELEMENTPARSER_H
+
+#include <EmbeddedStAX/XmlReader/TokenParsers/AbstractTokenParser.h>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Skip element parser
+ *
+ * Skips the content of an element up to (and including) its end tag. Only the nesting depth of
+ * the elements and the boundaries of comments, CDATA sections and processing instructions are
+ * tracked, no names or values are built and the skipped content is not validated.
+ */
+class SkipElementParser: public AbstractTokenParser
+{
+public:
+    // Public API
+    SkipElementParser();
+    ~SkipElementParser();
+
+    virtual Result parse();
+
+private:
+    // Private types
+    enum State
+    {
+        State_ReadingContent,
+        State_ReadingMarkup,
+        State_ReadingMarkupDeclaration,
+        State_ReadingCommentStart,
+        State_ReadingComment,
+        State_ReadingCData,
+        State_ReadingProcessingInstruction,
+        State_ReadingStartTag,
+        State_ReadingEndTag,
+        State_Finished,
+        State_Error
+    };
+
+private:
+    // Private API
+    virtual bool initializeAdditionalData();
+    virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
+
+    State executeStateReadingContent();
+    State executeStateReadingMarkup();
+    State executeStateReadingMarkupDeclaration();
+    State executeStateReadingCommentStart();
+    State executeStateReadingTerminator(const State currentState,
+                                        const uint32_t terminatorChar,
+                                        const size_t terminatorCharCount);
+    State executeStateReadingStartTag();
+    State executeStateReadingEndTag();
+
+private:
+    // Private data
+    State m_state;
+    size_t m_depth;
+    size_t m_matchCount;
+    uint32_t m_quotationMark;
+    uint32_t m_previousChar;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_TOKENPARSERS_SKIPELEMENTPARSER_H
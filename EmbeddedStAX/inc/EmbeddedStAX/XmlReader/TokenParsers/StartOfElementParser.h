@@ -31,6 +31,8 @@
 #include <EmbeddedStAX/XmlReader/TokenParsers/NameParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/AttributeValueParser.h>
 #include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <vector>
 
 namespace EmbeddedStAX
 {
@@ -46,8 +48,13 @@ public:
     StartOfElementParser();
     ~StartOfElementParser();
 
-    Common::UnicodeString name() const;
+    const Common::UnicodeString &name() const;
+    void swapName(Common::UnicodeString *name);
     const Common::AttributeList &attributeList() const;
+    void swapAttributeList(Common::AttributeList *attributeList);
+
+    void setAttributeKeyTable(const Common::SymbolTable *attributeKeyTable);
+    void swapAttributeSlots(std::vector<const Common::Attribute *> *attributeSlots);
 
     Result parse();
 
@@ -69,6 +76,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingElementName();
     State executeStateReadingNextItem();
@@ -85,6 +93,8 @@ private:
     Common::UnicodeString m_elementName;
     Common::UnicodeString m_attributeName;
     Common::AttributeList m_attributeList;
+    const Common::SymbolTable *m_attributeKeyTable;
+    std::vector<const Common::Attribute *> m_attributeSlots;
 };
 }
 }
@@ -45,7 +45,12 @@ public:
     TextNodeParser();
     ~TextNodeParser();
 
-    Common::UnicodeString text() const;
+    const Common::UnicodeString &text() const;
+    bool textHasReferences() const;
+    void swapText(Common::UnicodeString *text);
+
+    size_t chunkSize() const;
+    void setChunkSize(const size_t chunkSize);
 
     Result parse();
 
@@ -55,6 +60,7 @@ private:
     {
         State_ReadingText,
         State_ReadingReference,
+        State_TextChunkRead,
         State_Finished,
         State_Error
     };
@@ -63,6 +69,7 @@ private:
     // Private API
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateReadingText();
     State executeStateReadingReference();
@@ -72,6 +79,8 @@ private:
     State m_state;
     ReferenceParser m_referenceParser;
     Common::UnicodeString m_text;
+    bool m_textHasReferences;
+    size_t m_chunkSize;
 };
 }
 }
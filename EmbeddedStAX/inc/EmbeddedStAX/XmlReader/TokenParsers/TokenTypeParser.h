@@ -45,6 +45,7 @@ public:
     ~TokenTypeParser();
 
     Result parse();
+    bool isWaitingForToken() const;
 
 private:
     // Private types
@@ -65,6 +66,7 @@ private:
     virtual bool setOption(const Option option);
     virtual bool initializeAdditionalData();
     virtual void deinitializeAdditionalData();
+    virtual void rebindAdditionalData();
 
     State executeStateWaitingForStartOfToken();
     State executeStateReadingTokenType();
@@ -0,0 +1,164 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_XMLDOCUMENT_H
+#define EMBEDDEDSTAX_XMLREADER_XMLDOCUMENT_H
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * XML document is a compact read-only tree (DOM) that is built by driving the XmlReader
+ *
+ * Nodes are stored in a flat array in document order and they are linked with indexes (parent,
+ * first child and next sibling) instead of pointers. Attributes are stored in a second flat array
+ * and all of the strings (names, text and attribute values) are stored in a single string pool.
+ * Node 0 is the document node, its children are the root element and the comments and processing
+ * instructions of the prolog.
+ *
+ * Clearing the document just empties the arrays so it is done in constant time and the capacity
+ * of the arrays is kept, so a document that is reused for documents of similar size does not
+ * allocate any memory after the first one.
+ */
+class XmlDocument
+{
+public:
+    // Public constants
+    static const uint32_t InvalidIndex;
+
+public:
+    // Public types
+    enum NodeType
+    {
+        NodeType_Document,
+        NodeType_Element,
+        NodeType_TextNode,
+        NodeType_CData,
+        NodeType_Comment,
+        NodeType_ProcessingInstruction
+    };
+
+    enum Result
+    {
+        Result_NeedMoreData,
+        Result_Success,
+        Result_Error
+    };
+
+public:
+    // Public API
+    XmlDocument();
+
+    void clear();
+    void reserve(const size_t nodeCount, const size_t attributeCount, const size_t stringSize);
+
+    Result build(XmlReader *xmlReader);
+    bool isComplete() const;
+
+    size_t nodeCount() const;
+    uint32_t documentNode() const;
+    uint32_t rootElement() const;
+
+    NodeType nodeType(const uint32_t node) const;
+    uint32_t parent(const uint32_t node) const;
+    uint32_t firstChild(const uint32_t node) const;
+    uint32_t nextSibling(const uint32_t node) const;
+    uint32_t findChildElement(const uint32_t node, const Common::UnicodeString &name) const;
+
+    Common::UnicodeString name(const uint32_t node) const;
+    bool nameEquals(const uint32_t node, const Common::UnicodeString &name) const;
+    Common::UnicodeString value(const uint32_t node) const;
+
+    size_t attributeCount(const uint32_t node) const;
+    Common::UnicodeString attributeName(const uint32_t node, const size_t index) const;
+    Common::UnicodeString attributeValue(const uint32_t node, const size_t index) const;
+    uint32_t findAttribute(const uint32_t node, const Common::UnicodeString &name) const;
+
+    const Common::UnicodeString &stringPool() const;
+
+private:
+    // Private types
+    struct StringRef
+    {
+        size_t position;    /**< Position of the string in the string pool */
+        size_t size;        /**< Size of the string */
+    };
+
+    struct Node
+    {
+        NodeType type;              /**< Node type */
+        uint32_t parent;            /**< Index of the parent node */
+        uint32_t firstChild;        /**< Index of the first child node */
+        uint32_t lastChild;         /**< Index of the last child node (used for appending) */
+        uint32_t nextSibling;       /**< Index of the next sibling node */
+        uint32_t firstAttribute;    /**< Index of the first attribute */
+        uint32_t attributeCount;    /**< Number of attributes */
+        StringRef name;             /**< Element name or PI target */
+        StringRef value;            /**< Text, comment or PI data */
+    };
+
+    struct AttributeNode
+    {
+        StringRef name;     /**< Attribute name */
+        StringRef value;    /**< Attribute value */
+    };
+
+    class Builder;
+    friend class Builder;
+
+private:
+    // Private API
+    const Node *node(const uint32_t index) const;
+    StringRef addString(const Common::UnicodeString &value);
+    uint32_t addNode(const NodeType type,
+                     const Common::UnicodeString &name,
+                     const Common::UnicodeString &value);
+    void addAttribute(const Common::Attribute &attribute);
+    void appendText(const Common::UnicodeString &text);
+    void endText(const NodeType type, const Common::UnicodeString &text);
+    void finishText();
+    bool compareString(const StringRef &value, const Common::UnicodeString &other) const;
+
+private:
+    // Private data
+    std::vector<Node> m_nodes;
+    std::vector<AttributeNode> m_attributes;
+    Common::UnicodeString m_stringPool;
+    uint32_t m_currentElement;
+    uint32_t m_pendingText;
+    bool m_complete;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_XMLDOCUMENT_H
@@ -0,0 +1,423 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_XMLEVENTGENERATOR_H
+#define EMBEDDEDSTAX_XMLREADER_XMLEVENTGENERATOR_H
+
+#if (__cplusplus >= 202002L) && defined(__cpp_impl_coroutine)
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <coroutine>
+#include <exception>
+#include <string>
+#include <utility>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Generator of the XmlReader parsing results (requires C++20)
+ *
+ * The generator yields each parsing result of the reader. When the reader needs more data
+ * ParsingResult_NeedMoreData is yielded and the generator is suspended until next() is called
+ * again, so the data can be written to the reader in between. The generator finishes after an
+ * error.
+ *
+ * Usage:
+ * \code
+ * XmlEventGenerator events = generateEvents(xmlReader);
+ *
+ * while (events.next())
+ * {
+ *     if (events.value() == XmlReader::ParsingResult_NeedMoreData)
+ *     {
+ *         xmlReader.writeData(receiveData());
+ *     }
+ * }
+ * \endcode
+ */
+class XmlEventGenerator
+{
+public:
+    // Public types
+    struct promise_type
+    {
+        XmlReader::ParsingResult value = XmlReader::ParsingResult_None;
+
+        XmlEventGenerator get_return_object()
+        {
+            return XmlEventGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(const XmlReader::ParsingResult result) noexcept
+        {
+            value = result;
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+
+public:
+    // Public API
+    XmlEventGenerator(XmlEventGenerator &&other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    XmlEventGenerator &operator=(XmlEventGenerator &&other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    XmlEventGenerator(const XmlEventGenerator &) = delete;
+    XmlEventGenerator &operator=(const XmlEventGenerator &) = delete;
+
+    ~XmlEventGenerator()
+    {
+        destroy();
+    }
+
+    /**
+     * Resume the generator
+     *
+     * \retval true     Next parsing result is available through value()
+     * \retval false    Generator is finished
+     */
+    bool next()
+    {
+        bool available = false;
+
+        if (m_handle && (!m_handle.done()))
+        {
+            m_handle.resume();
+            available = !m_handle.done();
+        }
+
+        return available;
+    }
+
+    /**
+     * Get the last parsing result
+     *
+     * \return Parsing result
+     */
+    XmlReader::ParsingResult value() const
+    {
+        return m_handle.promise().value;
+    }
+
+private:
+    // Private API
+    explicit XmlEventGenerator(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    void destroy()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+private:
+    // Private data
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * Asynchronous generator of the XmlReader parsing results (requires C++20)
+ *
+ * The generator reads its data from an input source: when the reader needs more data the
+ * generator awaits "co_await inputSource.read()" which must produce a std::string (an empty string
+ * means end of the input). The consumer awaits "co_await events.next()" so a single thread can
+ * drive any number of generators from an event loop.
+ *
+ * Usage (inside a coroutine):
+ * \code
+ * AsyncXmlEventGenerator events = generateEvents(xmlReader, socketInput);
+ * bool available = co_await events.next();
+ *
+ * while (available)
+ * {
+ *     handleEvent(events.value());
+ *     available = co_await events.next();
+ * }
+ * \endcode
+ *
+ * \note ParsingResult_NeedMoreData is never yielded by this generator.
+ */
+class AsyncXmlEventGenerator
+{
+public:
+    // Public types
+    struct promise_type
+    {
+        XmlReader::ParsingResult value = XmlReader::ParsingResult_None;
+        std::coroutine_handle<> consumer = std::noop_coroutine();
+
+        struct TransferToConsumer
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(
+                    std::coroutine_handle<promise_type> handle) const noexcept
+            {
+                return handle.promise().consumer;
+            }
+
+            void await_resume() const noexcept
+            {
+            }
+        };
+
+        AsyncXmlEventGenerator get_return_object()
+        {
+            return AsyncXmlEventGenerator(
+                    std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        TransferToConsumer final_suspend() noexcept
+        {
+            return {};
+        }
+
+        TransferToConsumer yield_value(const XmlReader::ParsingResult result) noexcept
+        {
+            value = result;
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+
+    class NextAwaitable
+    {
+    public:
+        explicit NextAwaitable(std::coroutine_handle<promise_type> handle)
+            : m_handle(handle)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return ((!m_handle) || m_handle.done());
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) const noexcept
+        {
+            m_handle.promise().consumer = consumer;
+            return m_handle;
+        }
+
+        bool await_resume() const noexcept
+        {
+            return (m_handle && (!m_handle.done()));
+        }
+
+    private:
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+public:
+    // Public API
+    AsyncXmlEventGenerator(AsyncXmlEventGenerator &&other) noexcept
+        : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    AsyncXmlEventGenerator &operator=(AsyncXmlEventGenerator &&other) noexcept
+    {
+        if (this != &other)
+        {
+            destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    AsyncXmlEventGenerator(const AsyncXmlEventGenerator &) = delete;
+    AsyncXmlEventGenerator &operator=(const AsyncXmlEventGenerator &) = delete;
+
+    ~AsyncXmlEventGenerator()
+    {
+        destroy();
+    }
+
+    /**
+     * Resume the generator
+     *
+     * \return Awaitable that produces true when the next parsing result is available through
+     *         value() or false when the generator is finished
+     */
+    NextAwaitable next()
+    {
+        return NextAwaitable(m_handle);
+    }
+
+    /**
+     * Get the last parsing result
+     *
+     * \return Parsing result
+     */
+    XmlReader::ParsingResult value() const
+    {
+        return m_handle.promise().value;
+    }
+
+private:
+    // Private API
+    explicit AsyncXmlEventGenerator(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    void destroy()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+private:
+    // Private data
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * Generate the parsing results of the reader
+ *
+ * \param xmlReader XML reader (it must outlive the generator)
+ *
+ * \return Generator
+ */
+inline XmlEventGenerator generateEvents(XmlReader &xmlReader)
+{
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_None;
+
+    do
+    {
+        result = xmlReader.parse();
+        co_yield result;
+    }
+    while ((result != XmlReader::ParsingResult_Error) &&
+           (result != XmlReader::ParsingResult_None));
+}
+
+/**
+ * Generate the parsing results of the reader with the data from the input source
+ *
+ * \param xmlReader     XML reader (it must outlive the generator)
+ * \param inputSource   Input source (it must outlive the generator)
+ *
+ * \return Generator
+ *
+ * Generator finishes at the end of the input (after the remaining buffered data is parsed) or
+ * after an error.
+ */
+template <typename InputSource>
+AsyncXmlEventGenerator generateEvents(XmlReader &xmlReader, InputSource &inputSource)
+{
+    bool finished = false;
+
+    while (!finished)
+    {
+        const XmlReader::ParsingResult result = xmlReader.parse();
+
+        if (result == XmlReader::ParsingResult_NeedMoreData)
+        {
+            const std::string data = co_await inputSource.read();
+
+            if (data.empty())
+            {
+                // End of input
+                finished = true;
+            }
+            else
+            {
+                xmlReader.writeData(data);
+            }
+        }
+        else
+        {
+            co_yield result;
+            finished = ((result == XmlReader::ParsingResult_Error) ||
+                        (result == XmlReader::ParsingResult_None));
+        }
+    }
+}
+}
+}
+
+#endif // (__cplusplus >= 202002L) && defined(__cpp_impl_coroutine)
+
+#endif // EMBEDDEDSTAX_XMLREADER_XMLEVENTGENERATOR_H
@@ -28,26 +28,37 @@
 #ifndef EMBEDDEDSTAX_XMLREADER_XMLREADER_H
 #define EMBEDDEDSTAX_XMLREADER_XMLREADER_H
 
+#include <EmbeddedStAX/XmlReader/NamespaceResolver.h>
+#include <EmbeddedStAX/XmlReader/ParserContext.h>
 #include <EmbeddedStAX/XmlReader/ParsingBuffer.h>
+#include <EmbeddedStAX/XmlReader/PathSelector.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/CDataParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/CommentParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/EndOfElementParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/DocumentTypeParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/ProcessingInstructionParser.h>
+#include <EmbeddedStAX/XmlReader/TokenParsers/SkipElementParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/StartOfElementParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/TextNodeParser.h>
 #include <EmbeddedStAX/XmlReader/TokenParsers/TokenTypeParser.h>
+#include <EmbeddedStAX/Common/Arena.h>
 #include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/BinaryStream.h>
 #include <EmbeddedStAX/Common/DocumentType.h>
 #include <EmbeddedStAX/Common/ProcessingInstruction.h>
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/TypedValue.h>
 #include <EmbeddedStAX/Common/Utf.h>
 #include <EmbeddedStAX/Common/XmlDeclaration.h>
-#include <list>
+#include <vector>
 
 namespace EmbeddedStAX
 {
 namespace XmlReader
 {
+class AbstractXmlHandler;
+class EventBuffer;
+
 /**
  * XML Reader class can be used to parse a XML document
  */
@@ -67,7 +78,33 @@ public:
         ParsingResult_StartOfElement,
         ParsingResult_EndOfElement,
         ParsingResult_TextNode,
-        ParsingResult_CData
+        ParsingResult_CData,
+        ParsingResult_TextChunk,
+        ParsingResult_EndOfDocument
+    };
+
+    enum EventMask
+    {
+        EventMask_XmlDeclaration = 1U << ParsingResult_XmlDeclaration,
+        EventMask_ProcessingInstruction = 1U << ParsingResult_ProcessingInstruction,
+        EventMask_DocumentType = 1U << ParsingResult_DocumentType,
+        EventMask_Comment = 1U << ParsingResult_Comment,
+        EventMask_StartOfElement = 1U << ParsingResult_StartOfElement,
+        EventMask_EndOfElement = 1U << ParsingResult_EndOfElement,
+        EventMask_TextNode = 1U << ParsingResult_TextNode,
+        EventMask_CData = 1U << ParsingResult_CData,
+        EventMask_EndOfDocument = 1U << ParsingResult_EndOfDocument,
+        EventMask_WhitespaceTextNode = 1U << 16U,
+        EventMask_All = EventMask_XmlDeclaration |
+                        EventMask_ProcessingInstruction |
+                        EventMask_DocumentType |
+                        EventMask_Comment |
+                        EventMask_StartOfElement |
+                        EventMask_EndOfElement |
+                        EventMask_TextNode |
+                        EventMask_CData |
+                        EventMask_EndOfDocument |
+                        EventMask_WhitespaceTextNode
     };
 
 public:
@@ -76,19 +113,65 @@ public:
 
     void clear();
     void startNewDocument();
+    bool releaseMemory();
+
+    Common::Arena *arena() const;
+    void setArena(Common::Arena *arena);
+
+    size_t textChunkSize() const;
+    void setTextChunkSize(const size_t textChunkSize);
+
+    uint32_t eventMask() const;
+    void setEventMask(const uint32_t eventMask);
+
+    const ParserContext *parserContext() const;
+    bool setParserContext(const ParserContext *parserContext);
+
+    bool addSelectedPath(const Common::UnicodeString &path);
+    void clearSelectedPaths();
+
+    uint32_t registerAttributeKey(const Common::UnicodeString &name);
+    void clearAttributeKeys();
+
+    bool namespaceAware() const;
+    void setNamespaceAware(const bool namespaceAware);
+    NamespaceResolver &namespaceResolver();
+    const NamespaceResolver &namespaceResolver() const;
 
     // TODO: replace writting data to XmlReader with reading data from an "AbstractXmlInputStream" or externally supplied string input?
     size_t writeData(const std::string &data);
+    size_t inputOffset() const;
+
+    bool saveCheckpoint(std::string *checkpoint) const;
+    bool restoreCheckpoint(const std::string &checkpoint);
 
     ParsingResult parse();
+    ParsingResult parse(AbstractXmlHandler *handler);
+    template <typename Handler>
+    ParsingResult parse(Handler &handler);
+    ParsingResult parseBatch(EventBuffer *eventBuffer);
     ParsingResult lastParsingResult();
+    bool skipElement();
 
     Common::XmlDeclaration xmlDeclaration() const;
     Common::ProcessingInstruction processingInstruction() const;
     Common::DocumentType documentType() const;
-    Common::UnicodeString text() const;
+    const Common::UnicodeString &text() const;
+    const Common::UnicodeString &rawText() const;
+    bool textHasReferences() const;
+    bool textAsInt64(int64_t *result) const;
+    bool textAsDouble(double *result) const;
+    bool textAsBool(bool *result) const;
+    bool textAsTimestamp(Common::Timestamp *result) const;
     Common::UnicodeString name() const;
     Common::AttributeList attributeList() const;
+    const Common::Attribute *attribute(const uint32_t key) const;
+    ExpandedName expandedName() const;
+    const std::vector<ExpandedName> &attributeExpandedNames() const;
+
+    Common::UnicodeString takeText();
+    Common::UnicodeString takeName();
+    Common::AttributeList takeAttributeList();
 
 private:
     // Private types
@@ -117,14 +200,54 @@ private:
         ParsingState_StartOfElementRead,
         ParsingState_EmptyElementRead,
         ParsingState_ReadingTextNode,
+        ParsingState_TextNodeChunkRead,
         ParsingState_TextNodeRead,
         ParsingState_ReadingCData,
+        ParsingState_CDataChunkRead,
         ParsingState_CDataRead,
         ParsingState_ReadingEndOfElement,
         ParsingState_EndOfElementRead,
+        ParsingState_SkippingElement,
+        ParsingState_EndOfDocumentRead,
         ParsingState_Error
     };
 
+    /**
+     * Parsing buffer, values of the last parsing result and token parsers
+     *
+     * Workspace is allocated on demand and it can be released while the reader is idle (see
+     * releaseMemory()), so an idle reader holds only its state and configuration.
+     */
+    struct Workspace
+    {
+        Workspace();
+
+        ParsingBuffer parsingBuffer;
+        Common::XmlDeclaration xmlDeclaration;
+        Common::ProcessingInstruction processingInstruction;
+        Common::DocumentType documentType;
+        Common::UnicodeString text;
+        bool textHasReferences;
+        mutable bool textDecoded;
+        mutable Common::UnicodeString decodedText;
+        Common::UnicodeString name;
+        Common::AttributeList attributeList;
+        std::vector<const Common::Attribute *> attributeSlots;
+        PathSelector::ElementNameList openElementList;
+        ExpandedName expandedName;
+        std::vector<ExpandedName> attributeExpandedNames;
+
+        CDataParser cDataParser;
+        CommentParser commentParser;
+        DocumentTypeParser documentTypeParser;
+        EndOfElementParser endOfElementParser;
+        ProcessingInstructionParser processingInstructionParser;
+        SkipElementParser skipElementParser;
+        StartOfElementParser startOfElementParser;
+        TextNodeParser textNodeParser;
+        TokenTypeParser tokenTypeParser;
+    };
+
 private:
     // Private API
     ParsingState executeParsingStateReadingTokenType();
@@ -135,32 +258,164 @@ private:
     ParsingState executeParsingStateReadingTextNode();
     ParsingState executeParsingStateReadingCData();
     ParsingState executeParsingStateReadingEndOfElement();
+    ParsingState executeParsingStateSkippingElement();
+
+    XmlReader(const XmlReader &);
+    XmlReader &operator=(const XmlReader &);
 
-    bool setTokenParser(AbstractTokenParser *tokenParser);
+    Workspace &workspace();
+    const Workspace &workspace() const;
+    bool isIdle() const;
+    void rebindData();
+    void resetDocument();
+    void clearText();
+    void clearAttributeList();
+    bool startNamespaceScope();
+    bool endNamespaceScope(const bool resolveName);
+    bool restoreCheckpointData(Common::BinaryReader *reader);
+    bool restoreNamespaceScopes(Common::BinaryReader *reader);
+    static bool isCheckpointState(const ParsingState parsingState);
+    void decodeText() const;
+    bool isEventDelivered(const ParsingResult result) const;
+    bool selectEvent(const ParsingResult result);
+    AbstractTokenParser::Option valueOption(const uint32_t eventMask) const;
+    void addEvent(const ParsingResult result, EventBuffer *eventBuffer) const;
+    bool dispatchEvent(const ParsingResult result, AbstractXmlHandler *handler) const;
+    static void takeString(Common::UnicodeString *value, Common::UnicodeString *output);
 
 private:
     // Private data
     DocumentState m_documentState;
     ParsingState m_parsingState;
-    ParsingBuffer m_parsingBuffer;
+    size_t m_inputOffset;
     ParsingResult m_lastParsingResult;
-    Common::XmlDeclaration m_xmlDeclaration;
-    Common::ProcessingInstruction m_processingInstruction;
-    Common::DocumentType m_documentType;
-    Common::UnicodeString m_text;
-    Common::UnicodeString m_name;
-    Common::AttributeList m_attributeList;
-    std::list<Common::UnicodeString> m_openElementList;
-
-    CDataParser m_cDataParser;
-    CommentParser m_commentParser;
-    DocumentTypeParser m_documentTypeParser;
-    EndOfElementParser m_endOfElementParser;
-    ProcessingInstructionParser m_processingInstructionParser;
-    StartOfElementParser m_startOfElementParser;
-    TextNodeParser m_textNodeParser;
-    TokenTypeParser m_tokenTypeParser;
+    Common::Arena *m_arena;
+    uint32_t m_eventMask;
+    size_t m_textChunkSize;
+    bool m_textChunkRead;
+    const ParserContext *m_parserContext;
+    Common::SymbolTable m_attributeKeyTable;
+    PathSelector m_pathSelector;
+    size_t m_selectedDepth;
+    bool m_namespaceAware;
+    NamespaceResolver *m_namespaceResolver;
+    Workspace *m_workspace;
 };
+
+/**
+ * Parse all of the buffered data and pass the parsing results to the handler (static dispatch)
+ *
+ * \param handler   XML handler (see StaticXmlHandler)
+ *
+ * \retval ParsingResult_NeedMoreData   All of the buffered data was parsed
+ * \retval ParsingResult_None           Parsing was stopped by the handler
+ * \retval ParsingResult_Error          Error
+ *
+ * Callbacks of the handler are resolved at compile time so they can be inlined into the parsing
+ * loop. For the duration of the call the event mask is intersected with Handler::HandlerEventMask
+ * (only the events that are in both masks are kept) so the values of the events that the handler
+ * does not handle are not stored.
+ *
+ * \note The same handler type should be used for the whole document because the values of the
+ *       tokens that were started with a different event mask could have been skipped.
+ */
+template <typename Handler>
+XmlReader::ParsingResult XmlReader::parse(Handler &handler)
+{
+    ParsingResult result = ParsingResult_Error;
+    const uint32_t eventMask = m_eventMask;
+    bool finishParsing = false;
+
+    m_eventMask &= static_cast<uint32_t>(Handler::HandlerEventMask);
+
+    while (!finishParsing)
+    {
+        bool continueParsing = true;
+        result = parse();
+
+        switch (result)
+        {
+            case ParsingResult_XmlDeclaration:
+            {
+                continueParsing = handler.onXmlDeclaration(m_workspace->xmlDeclaration);
+                break;
+            }
+
+            case ParsingResult_ProcessingInstruction:
+            {
+                continueParsing =
+                        handler.onProcessingInstruction(m_workspace->processingInstruction);
+                break;
+            }
+
+            case ParsingResult_DocumentType:
+            {
+                continueParsing = handler.onDocumentType(m_workspace->documentType);
+                break;
+            }
+
+            case ParsingResult_Comment:
+            {
+                continueParsing = handler.onComment(text());
+                break;
+            }
+
+            case ParsingResult_StartOfElement:
+            {
+                continueParsing = handler.onStartOfElement(m_workspace->name,
+                                                           m_workspace->attributeList);
+                break;
+            }
+
+            case ParsingResult_EndOfElement:
+            {
+                continueParsing = handler.onEndOfElement(m_workspace->name);
+                break;
+            }
+
+            case ParsingResult_TextNode:
+            {
+                continueParsing = handler.onTextNode(text());
+                break;
+            }
+
+            case ParsingResult_CData:
+            {
+                continueParsing = handler.onCData(text());
+                break;
+            }
+
+            case ParsingResult_TextChunk:
+            {
+                continueParsing = handler.onTextChunk(text());
+                break;
+            }
+
+            case ParsingResult_EndOfDocument:
+            {
+                continueParsing = handler.onEndOfDocument();
+                break;
+            }
+
+            default:
+            {
+                // None, error or need more data
+                finishParsing = true;
+                break;
+            }
+        }
+
+        if (!continueParsing)
+        {
+            // Stopped by the handler
+            result = ParsingResult_None;
+            finishParsing = true;
+        }
+    }
+
+    m_eventMask = eventMask;
+    return result;
+}
 }
 }
 
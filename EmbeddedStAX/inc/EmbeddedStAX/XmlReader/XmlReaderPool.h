@@ -0,0 +1,251 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLREADER_XMLREADERPOOL_H
+#define EMBEDDEDSTAX_XMLREADER_XMLREADERPOOL_H
+
+#if (__cplusplus >= 201103L)
+
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Thread-safe pool of reusable XML readers (requires C++11)
+ *
+ * Readers that are returned to the pool are cleared (see XmlReader::clear()) but they keep their
+ * configuration and the capacity of their buffers, so a reader taken from the pool is ready to
+ * parse without the cost of constructing and destroying the token parsers.
+ *
+ * \note All of the readers of the pool should have the same configuration: a reader that is
+ *       reconfigured while it is in use keeps the new configuration when it is returned.
+ */
+class XmlReaderPool
+{
+public:
+    // Public types
+    /**
+     * Reader that is returned to the pool when the lease goes out of scope
+     */
+    class Lease
+    {
+    public:
+        /**
+         * Constructor
+         *
+         * \param pool  Pool that the reader is taken from
+         */
+        explicit Lease(XmlReaderPool &pool)
+            : m_pool(pool),
+              m_xmlReader(pool.acquire())
+        {
+        }
+
+        /**
+         * Destructor
+         */
+        ~Lease()
+        {
+            m_pool.release(m_xmlReader);
+        }
+
+        Lease(const Lease &) = delete;
+        Lease &operator=(const Lease &) = delete;
+
+        /**
+         * Get reader
+         *
+         * \return Reader
+         */
+        XmlReader &operator*() const
+        {
+            return *m_xmlReader;
+        }
+
+        /**
+         * Access reader
+         *
+         * \return Reader
+         */
+        XmlReader *operator->() const
+        {
+            return m_xmlReader;
+        }
+
+    private:
+        XmlReaderPool &m_pool;
+        XmlReader *m_xmlReader;
+    };
+
+public:
+    // Public API
+    /**
+     * Constructor
+     *
+     * \param maxIdleCount  Maximum number of idle readers that are kept in the pool
+     */
+    explicit XmlReaderPool(const size_t maxIdleCount = 16U)
+        : m_maxIdleCount(maxIdleCount),
+          m_configuration(),
+          m_idleReaders(),
+          m_mutex()
+    {
+    }
+
+    /**
+     * Destructor
+     *
+     * \note All of the readers have to be returned to the pool before it is destroyed.
+     */
+    ~XmlReaderPool()
+    {
+        for (size_t i = 0U; i < m_idleReaders.size(); i++)
+        {
+            delete m_idleReaders[i];
+        }
+    }
+
+    XmlReaderPool(const XmlReaderPool &) = delete;
+    XmlReaderPool &operator=(const XmlReaderPool &) = delete;
+
+    /**
+     * Set configuration of the new readers
+     *
+     * \param configuration Function that is called once for each reader that is created by the
+     *                      pool (for example to set the event mask)
+     */
+    void setConfiguration(const std::function<void(XmlReader &)> &configuration)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_configuration = configuration;
+    }
+
+    /**
+     * Take a reader from the pool
+     *
+     * \return Idle reader or a new reader if there are no idle readers in the pool
+     *
+     * \note Reader has to be returned to the pool with release().
+     */
+    XmlReader *acquire()
+    {
+        XmlReader *xmlReader = NULL;
+        std::function<void(XmlReader &)> configuration;
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_idleReaders.empty())
+            {
+                configuration = m_configuration;
+            }
+            else
+            {
+                xmlReader = m_idleReaders.back();
+                m_idleReaders.pop_back();
+            }
+        }
+
+        if (xmlReader == NULL)
+        {
+            // New reader is created and configured outside of the lock
+            xmlReader = new XmlReader();
+
+            if (configuration)
+            {
+                configuration(*xmlReader);
+            }
+        }
+
+        return xmlReader;
+    }
+
+    /**
+     * Return a reader to the pool
+     *
+     * \param xmlReader Reader that was taken from the pool
+     *
+     * \note Reader is cleared before it is returned to the pool. It is destroyed if the pool is
+     *       already holding the maximum number of idle readers.
+     * \note Arena that was set by the user of the reader is removed (the arena may not outlive the
+     *       lease), the next user gets a reader that uses the global allocator.
+     */
+    void release(XmlReader *xmlReader)
+    {
+        if (xmlReader != NULL)
+        {
+            xmlReader->clear();
+            xmlReader->setArena(NULL);
+
+            bool pooled = false;
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+
+                if (m_idleReaders.size() < m_maxIdleCount)
+                {
+                    m_idleReaders.push_back(xmlReader);
+                    pooled = true;
+                }
+            }
+
+            if (!pooled)
+            {
+                delete xmlReader;
+            }
+        }
+    }
+
+    /**
+     * Get number of idle readers in the pool
+     *
+     * \return Number of idle readers
+     */
+    size_t idleCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_idleReaders.size();
+    }
+
+private:
+    // Private data
+    const size_t m_maxIdleCount;
+    std::function<void(XmlReader &)> m_configuration;
+    std::vector<XmlReader *> m_idleReaders;
+    mutable std::mutex m_mutex;
+};
+}
+}
+
+#endif // (__cplusplus >= 201103L)
+
+#endif // EMBEDDEDSTAX_XMLREADER_XMLREADERPOOL_H
@@ -0,0 +1,91 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLWRITER_ABSTRACTXMLOUTPUTSTREAM_H
+#define EMBEDDEDSTAX_XMLWRITER_ABSTRACTXMLOUTPUTSTREAM_H
+
+#include <EmbeddedStAX/Common/Utf.h>
+#include <vector>
+
+namespace EmbeddedStAX
+{
+namespace XmlWriter
+{
+/**
+ * Abstract XML output stream encodes the written text to UTF-8 and passes it to a sink in blocks
+ *
+ * Encoded data is collected in a buffer of a fixed size and the whole buffer is passed to
+ * writeData() when it gets full or when the stream is flushed, so the sink is called only once for
+ * many small writes and the document does not have to be kept in memory.
+ *
+ * \note After the sink reports an error the stream stays invalid and the rest of the data is
+ *       discarded.
+ * \note Derived classes should flush the stream in their destructor.
+ */
+class AbstractXmlOutputStream
+{
+public:
+    // Public constants
+    static const size_t DefaultBufferSize;
+
+public:
+    // Public API
+    explicit AbstractXmlOutputStream(const size_t bufferSize = DefaultBufferSize);
+    virtual ~AbstractXmlOutputStream();
+
+    bool isValid() const;
+    size_t bufferSize() const;
+    size_t bufferedSize() const;
+    size_t bytesWritten() const;
+
+    bool write(const uint32_t unicodeChar);
+    bool write(const Common::UnicodeString &text);
+    bool writeAscii(const char *text);
+    bool flush();
+
+protected:
+    // Protected API
+    virtual bool writeData(const char *data, const size_t size) = 0;
+
+private:
+    // Private API
+    AbstractXmlOutputStream(const AbstractXmlOutputStream &);
+    AbstractXmlOutputStream &operator=(const AbstractXmlOutputStream &);
+
+    bool reserve(const size_t size);
+
+private:
+    // Private data
+    std::vector<char> m_buffer;
+    size_t m_bufferedSize;
+    size_t m_bytesWritten;
+    bool m_valid;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLWRITER_ABSTRACTXMLOUTPUTSTREAM_H
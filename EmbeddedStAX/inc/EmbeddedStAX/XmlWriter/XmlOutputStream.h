@@ -0,0 +1,142 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#ifndef EMBEDDEDSTAX_XMLWRITER_XMLOUTPUTSTREAM_H
+#define EMBEDDEDSTAX_XMLWRITER_XMLOUTPUTSTREAM_H
+
+#include <EmbeddedStAX/XmlWriter/AbstractXmlOutputStream.h>
+#include <cstdio>
+#include <string>
+
+namespace EmbeddedStAX
+{
+namespace XmlWriter
+{
+/**
+ * String output stream appends the UTF-8 encoded data to a string in memory
+ */
+class StringOutputStream : public AbstractXmlOutputStream
+{
+public:
+    // Public API
+    explicit StringOutputStream(std::string *output,
+                                const size_t bufferSize = DefaultBufferSize);
+    virtual ~StringOutputStream();
+
+protected:
+    // Protected API
+    virtual bool writeData(const char *data, const size_t size);
+
+private:
+    // Private data
+    std::string *m_output;
+};
+
+/**
+ * File output stream writes the UTF-8 encoded data to a C stream (FILE)
+ *
+ * \note The file is not closed by the stream.
+ */
+class FileOutputStream : public AbstractXmlOutputStream
+{
+public:
+    // Public API
+    explicit FileOutputStream(std::FILE *file, const size_t bufferSize = DefaultBufferSize);
+    virtual ~FileOutputStream();
+
+protected:
+    // Protected API
+    virtual bool writeData(const char *data, const size_t size);
+
+private:
+    // Private data
+    std::FILE *m_file;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * File descriptor output stream writes the UTF-8 encoded data to a POSIX file descriptor
+ *
+ * \note The file descriptor is not closed by the stream.
+ */
+class FileDescriptorOutputStream : public AbstractXmlOutputStream
+{
+public:
+    // Public API
+    explicit FileDescriptorOutputStream(const int fileDescriptor,
+                                        const size_t bufferSize = DefaultBufferSize);
+    virtual ~FileDescriptorOutputStream();
+
+protected:
+    // Protected API
+    virtual bool writeData(const char *data, const size_t size);
+
+private:
+    // Private data
+    int m_fileDescriptor;
+};
+#endif
+
+/**
+ * Callback output stream passes the UTF-8 encoded data to a user supplied function
+ */
+class CallbackOutputStream : public AbstractXmlOutputStream
+{
+public:
+    // Public types
+    /**
+     * Callback function
+     *
+     * \param data      UTF-8 encoded data
+     * \param size      Size of the data
+     * \param userData  User data that was passed to the constructor
+     *
+     * \retval true     Data was written
+     * \retval false    Error
+     */
+    typedef bool (*Callback)(const char *data, const size_t size, void *userData);
+
+public:
+    // Public API
+    CallbackOutputStream(Callback callback,
+                         void *userData,
+                         const size_t bufferSize = DefaultBufferSize);
+    virtual ~CallbackOutputStream();
+
+protected:
+    // Protected API
+    virtual bool writeData(const char *data, const size_t size);
+
+private:
+    // Private data
+    Callback m_callback;
+    void *m_userData;
+};
+}
+}
+
+#endif // EMBEDDEDSTAX_XMLWRITER_XMLOUTPUTSTREAM_H
@@ -31,6 +31,7 @@
 #include <EmbeddedStAX/Common/Attribute.h>
 #include <EmbeddedStAX/Common/ProcessingInstruction.h>
 #include <EmbeddedStAX/Common/Utf.h>
+#include <EmbeddedStAX/XmlWriter/AbstractXmlOutputStream.h>
 #include <list>
 
 namespace EmbeddedStAX
@@ -39,18 +40,27 @@ namespace XmlWriter
 {
 /**
  * XML Writer class can be used to create a XML document
+ *
+ * By default the document is collected in memory and it can be read with xmlString(). When an
+ * output stream is set the document is instead encoded to UTF-8 and written to the stream while
+ * it is being created, so only the buffer of the stream is kept in memory.
  */
 class XmlWriter
 {
 public:
     // Public API
-    XmlWriter();
-
-    // TODO: replace writting to m_xmlString with writing to "AbstractXmlOutputStream" or externally supplied string output?
+    explicit XmlWriter(AbstractXmlOutputStream *outputStream = NULL);
 
     void clearDocument();
     Common::UnicodeString xmlString() const;
 
+    AbstractXmlOutputStream *outputStream() const;
+    void setOutputStream(AbstractXmlOutputStream *outputStream);
+
+    size_t flushDepth() const;
+    void setFlushDepth(const size_t flushDepth);
+    bool flush();
+
     bool writeXmlDeclaration();
     bool writeDocumentType(const Common::UnicodeString &documentType);
     bool writeComment(const Common::UnicodeString &commentText);
@@ -65,6 +75,12 @@ public:
 
 private:
     // Private API
+    void write(const uint32_t unicodeChar);
+    void write(const Common::UnicodeString &text);
+    void write(const char *text);
+    bool isOutputValid() const;
+    void flushEndOfElement(const size_t depth);
+
     bool writeAttributeList(const Common::AttributeList &attributeList);
     Common::UnicodeString escapeAttributeValue(const Common::UnicodeString &attributeValue,
                                                const Common::QuotationMark quotationMark) const;
@@ -87,6 +103,8 @@ private:
     Common::UnicodeString m_documentType;
     std::list<Common::UnicodeString> m_openedElementList;
     Common::UnicodeString m_xmlString;
+    AbstractXmlOutputStream *m_outputStream;
+    size_t m_flushDepth;
 };
 }
 }
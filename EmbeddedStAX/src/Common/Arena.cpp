@@ -0,0 +1,247 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/Common/Arena.h>
+#include <new>
+
+using namespace EmbeddedStAX::Common;
+
+namespace
+{
+/**
+ * Type with the strictest alignment requirement of the fundamental types
+ */
+union MaxAlignment
+{
+    long double longDoubleValue;
+    long long longLongValue;
+    void *pointerValue;
+    void (*functionPointerValue)();
+};
+}
+
+/**
+ * Constructor
+ *
+ * \param blockSize Size of a memory block that is reserved when arena runs out of memory
+ *
+ * \note No memory is reserved until the first allocation.
+ */
+Arena::Arena(const size_t blockSize)
+    : m_firstBlock(NULL),
+      m_currentBlock(NULL),
+      m_blockSize(alignSize(blockSize)),
+      m_bytesAllocated(0U)
+{
+}
+
+/**
+ * Destructor
+ */
+Arena::~Arena()
+{
+    clear();
+}
+
+/**
+ * Get block size
+ *
+ * \return Block size
+ */
+size_t Arena::blockSize() const
+{
+    return m_blockSize;
+}
+
+/**
+ * Get number of bytes allocated since the last reset
+ *
+ * \return Number of allocated bytes
+ */
+size_t Arena::bytesAllocated() const
+{
+    return m_bytesAllocated;
+}
+
+/**
+ * Get number of bytes reserved in all of the blocks
+ *
+ * \return Capacity
+ */
+size_t Arena::capacity() const
+{
+    size_t capacity = 0U;
+
+    for (const Block *block = m_firstBlock; block != NULL; block = block->next)
+    {
+        capacity += block->size;
+    }
+
+    return capacity;
+}
+
+/**
+ * Allocate memory
+ *
+ * \param size  Number of bytes to allocate
+ *
+ * \return Pointer to the allocated memory (aligned for any fundamental type)
+ *
+ * \note Throws std::bad_alloc if a new block can not be reserved.
+ */
+void *Arena::allocate(const size_t size)
+{
+    const size_t alignedSize = alignSize((size == 0U) ? 1U : size);
+
+    // Find a block with enough free space, starting at the current block
+    Block *block = m_currentBlock;
+
+    while ((block != NULL) && ((block->size - block->used) < alignedSize))
+    {
+        block = block->next;
+    }
+
+    if (block == NULL)
+    {
+        // Not enough free space, reserve a new block (large allocations get a block of their own)
+        block = createBlock((alignedSize > m_blockSize) ? alignedSize : m_blockSize);
+    }
+
+    // Blocks dedicated to large allocations never become the current block
+    if (block->size <= m_blockSize)
+    {
+        m_currentBlock = block;
+    }
+
+    void *memory = blockData(block) + block->used;
+    block->used += alignedSize;
+    m_bytesAllocated += alignedSize;
+
+    return memory;
+}
+
+/**
+ * Reset the arena
+ *
+ * All of the memory that was allocated from the arena is released in bulk, but the blocks are kept
+ * so that they can be reused.
+ *
+ * \note All of the memory allocated from the arena is invalid after this call!
+ */
+void Arena::reset()
+{
+    for (Block *block = m_firstBlock; block != NULL; block = block->next)
+    {
+        block->used = 0U;
+    }
+
+    m_currentBlock = m_firstBlock;
+    m_bytesAllocated = 0U;
+}
+
+/**
+ * Clear the arena
+ *
+ * All of the memory that was allocated from the arena is released and all of the blocks are freed.
+ *
+ * \note All of the memory allocated from the arena is invalid after this call!
+ */
+void Arena::clear()
+{
+    Block *block = m_firstBlock;
+
+    while (block != NULL)
+    {
+        Block *nextBlock = block->next;
+        ::operator delete(static_cast<void *>(block));
+        block = nextBlock;
+    }
+
+    m_firstBlock = NULL;
+    m_currentBlock = NULL;
+    m_bytesAllocated = 0U;
+}
+
+/**
+ * Align size to the strictest alignment of the fundamental types
+ *
+ * \param size  Size
+ *
+ * \return Aligned size
+ */
+size_t Arena::alignSize(const size_t size)
+{
+    const size_t alignment = sizeof(MaxAlignment);
+    return ((size + alignment - 1U) / alignment) * alignment;
+}
+
+/**
+ * Get start of block's data
+ *
+ * \param block Memory block
+ *
+ * \return Pointer to the first byte after the (aligned) block header
+ */
+unsigned char *Arena::blockData(Block *block)
+{
+    return reinterpret_cast<unsigned char *>(block) + alignSize(sizeof(Block));
+}
+
+/**
+ * Create a new block and append it to the end of the block chain
+ *
+ * \param size  Number of usable bytes in the block
+ *
+ * \return New block
+ */
+Arena::Block *Arena::createBlock(const size_t size)
+{
+    void *memory = ::operator new(alignSize(sizeof(Block)) + size);
+    Block *block = static_cast<Block *>(memory);
+    block->next = NULL;
+    block->size = size;
+    block->used = 0U;
+
+    if (m_firstBlock == NULL)
+    {
+        m_firstBlock = block;
+        m_currentBlock = block;
+    }
+    else
+    {
+        Block *lastBlock = m_firstBlock;
+
+        while (lastBlock->next != NULL)
+        {
+            lastBlock = lastBlock->next;
+        }
+
+        lastBlock->next = block;
+    }
+
+    return block;
+}
@@ -29,6 +29,10 @@
 #include <EmbeddedStAX/XmlValidator/Name.h>
 #include <EmbeddedStAX/XmlValidator/Attribute.h>
 
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
 using namespace EmbeddedStAX::Common;
 
 /**
@@ -46,7 +50,25 @@ Attribute::Attribute(const UnicodeString &name,
                      const QuotationMark quotationMark)
     : m_name(name),
       m_value(value),
-      m_quotationMark(quotationMark)
+      m_quotationMark(quotationMark),
+      m_valueHasReferences(false),
+      m_valueDecoded(false),
+      m_decodedValue()
+{
+}
+
+/**
+ * Constructor
+ *
+ * \param allocator Allocator for the attribute name and value
+ */
+Attribute::Attribute(const UnicodeString::allocator_type &allocator)
+    : m_name(allocator),
+      m_value(allocator),
+      m_quotationMark(QuotationMark_Quote),
+      m_valueHasReferences(false),
+      m_valueDecoded(false),
+      m_decodedValue(allocator)
 {
 }
 
@@ -54,11 +76,16 @@ Attribute::Attribute(const UnicodeString &name,
  * Copy constructor
  *
  * \param other Attribute
+ *
+ * \note The copy uses the global allocator (C++11 and later).
  */
 Attribute::Attribute(const Attribute &other)
     : m_name(other.m_name),
       m_value(other.m_value),
-      m_quotationMark(other.m_quotationMark)
+      m_quotationMark(other.m_quotationMark),
+      m_valueHasReferences(other.m_valueHasReferences),
+      m_valueDecoded(other.m_valueDecoded),
+      m_decodedValue(other.m_decodedValue)
 {
 }
 
@@ -74,11 +101,93 @@ Attribute &Attribute::operator=(const Attribute &other)
         m_name = other.m_name;
         m_value = other.m_value;
         m_quotationMark = other.m_quotationMark;
+        m_valueHasReferences = other.m_valueHasReferences;
+        m_valueDecoded = other.m_valueDecoded;
+        m_decodedValue = other.m_decodedValue;
     }
 
     return *this;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Move constructor
+ *
+ * \param other Attribute
+ *
+ * \note The attribute takes over the contents and the allocator of the other attribute.
+ */
+Attribute::Attribute(Attribute &&other) noexcept
+    : m_name(std::move(other.m_name)),
+      m_value(std::move(other.m_value)),
+      m_quotationMark(other.m_quotationMark),
+      m_valueHasReferences(other.m_valueHasReferences),
+      m_valueDecoded(other.m_valueDecoded),
+      m_decodedValue(std::move(other.m_decodedValue))
+{
+}
+
+/**
+ * Move assignment operator
+ *
+ * \param other Attribute
+ *
+ * \note Contents are copied if the allocators of the attributes are not equal.
+ */
+Attribute &Attribute::operator=(Attribute &&other)
+{
+    if (this != &other)
+    {
+        m_name = std::move(other.m_name);
+        m_value = std::move(other.m_value);
+        m_quotationMark = other.m_quotationMark;
+        m_valueHasReferences = other.m_valueHasReferences;
+        m_valueDecoded = other.m_valueDecoded;
+        m_decodedValue = std::move(other.m_decodedValue);
+    }
+
+    return *this;
+}
+#endif
+
+/**
+ * Get allocator
+ *
+ * \return Allocator of the attribute name and value
+ */
+UnicodeString::allocator_type Attribute::allocator() const
+{
+    return m_name.get_allocator();
+}
+
+/**
+ * Swap contents (and allocators) with another attribute
+ *
+ * \param other Attribute
+ */
+void Attribute::swap(Attribute &other)
+{
+    if (this != &other)
+    {
+        m_name.swap(other.m_name);
+        m_value.swap(other.m_value);
+
+        m_decodedValue.swap(other.m_decodedValue);
+
+        const QuotationMark quotationMark = m_quotationMark;
+        m_quotationMark = other.m_quotationMark;
+        other.m_quotationMark = quotationMark;
+
+        const bool valueHasReferences = m_valueHasReferences;
+        m_valueHasReferences = other.m_valueHasReferences;
+        other.m_valueHasReferences = valueHasReferences;
+
+        const bool valueDecoded = m_valueDecoded;
+        m_valueDecoded = other.m_valueDecoded;
+        other.m_valueDecoded = valueDecoded;
+    }
+}
+
 /**
  * Clear
  */
@@ -87,6 +196,9 @@ void Attribute::clear()
     m_name.clear();
     m_value.clear();
     m_quotationMark = QuotationMark_None;
+    m_valueHasReferences = false;
+    m_valueDecoded = false;
+    m_decodedValue.clear();
 }
 
 /**
@@ -94,7 +206,7 @@ void Attribute::clear()
  *
  * \return Attribute name
  */
-UnicodeString Attribute::name() const
+const UnicodeString &Attribute::name() const
 {
     return m_name;
 }
@@ -113,10 +225,31 @@ void Attribute::setName(const UnicodeString &name)
  * Get attribute value
  *
  * \return Attribute value
+ *
+ * \note If the value contains references then they are decoded on the first call and the decoded
+ *       value is cached. Otherwise the value is returned without copying it.
  */
-UnicodeString Attribute::value() const
+const UnicodeString &Attribute::value() const
 {
-    return m_value;
+    const UnicodeString *value = &m_value;
+
+    if (m_valueHasReferences)
+    {
+        if (!m_valueDecoded)
+        {
+            if (!decodeReferences(m_value, &m_decodedValue))
+            {
+                // Invalid reference, use the raw value
+                m_decodedValue = m_value;
+            }
+
+            m_valueDecoded = true;
+        }
+
+        value = &m_decodedValue;
+    }
+
+    return *value;
 }
 
 /**
@@ -132,6 +265,50 @@ void Attribute::setValue(const UnicodeString &value, const QuotationMark quotati
 {
     m_value = value;
     m_quotationMark = quotationMark;
+    m_valueHasReferences = false;
+    m_valueDecoded = false;
+    m_decodedValue.clear();
+}
+
+/**
+ * Get raw attribute value
+ *
+ * \return Attribute value with references that are not decoded
+ */
+const UnicodeString &Attribute::rawValue() const
+{
+    return m_value;
+}
+
+/**
+ * Check if the raw attribute value contains references
+ *
+ * \retval true    Raw value contains entity and/or character references
+ * \retval false   Raw value doesn't contain any references
+ */
+bool Attribute::valueHasReferences() const
+{
+    return m_valueHasReferences;
+}
+
+/**
+ * Set raw attribute value
+ *
+ * \param rawValue      Attribute value with references that are not decoded
+ * \param quotationMark Attribute value's quotation mark
+ * \param hasReferences Flag that indicates if the raw value contains references
+ *
+ * \note References are decoded only when the value is accessed (see value()).
+ */
+void Attribute::setRawValue(const UnicodeString &rawValue,
+                            const QuotationMark quotationMark,
+                            const bool hasReferences)
+{
+    m_value = rawValue;
+    m_quotationMark = quotationMark;
+    m_valueHasReferences = hasReferences;
+    m_valueDecoded = false;
+    m_decodedValue.clear();
 }
 
 /**
@@ -144,11 +321,65 @@ QuotationMark Attribute::valueQuotationMark() const
     return m_quotationMark;
 }
 
+/**
+ * Parse the attribute value as a 64-bit signed integer (see parseInt64())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool Attribute::valueAsInt64(int64_t *result) const
+{
+    return parseInt64(value(), result);
+}
+
+/**
+ * Parse the attribute value as a floating point value (see parseDouble())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool Attribute::valueAsDouble(double *result) const
+{
+    return parseDouble(value(), result);
+}
+
+/**
+ * Parse the attribute value as a boolean value (see parseBool())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool Attribute::valueAsBool(bool *result) const
+{
+    return parseBool(value(), result);
+}
+
+/**
+ * Parse the attribute value as a timestamp (see parseTimestamp())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool Attribute::valueAsTimestamp(Timestamp *result) const
+{
+    return parseTimestamp(value(), result);
+}
+
 /**
  * Constructor
+ *
+ * \param allocator Allocator for the list and for the attributes in it
  */
-AttributeList::AttributeList()
-    : m_attributeList()
+AttributeList::AttributeList(const UnicodeString::allocator_type &allocator)
+    : m_attributeList(ArenaAllocator<Attribute>(allocator))
 {
 }
 
@@ -156,6 +387,8 @@ AttributeList::AttributeList()
  * Copy constructor
  *
  * \param other The input instance
+ *
+ * \note The copy uses the global allocator (C++11 and later).
  */
 AttributeList::AttributeList(const AttributeList &other)
     : m_attributeList(other.m_attributeList)
@@ -181,12 +414,82 @@ AttributeList &AttributeList::operator=(const AttributeList &other)
 {
     if (&other != this)
     {
-        m_attributeList = other.m_attributeList;
+        // Attributes are added one by one so that they are copied with this list's allocator
+        m_attributeList.clear();
+
+        for (ConstIterator it = other.begin(); it != other.end(); it++)
+        {
+            add(*it);
+        }
     }
 
     return *this;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Move constructor
+ *
+ * \param other The input instance
+ *
+ * \note The list takes over the attributes and the allocator of the other list.
+ */
+AttributeList::AttributeList(AttributeList &&other) noexcept
+    : m_attributeList(std::move(other.m_attributeList))
+{
+}
+
+/**
+ * Move assignment operator
+ *
+ * \param other The input instance
+ *
+ * \return Constant reference to this instance
+ *
+ * \note Attributes are copied if the allocators of the lists are not equal.
+ */
+AttributeList &AttributeList::operator=(AttributeList &&other)
+{
+    if (&other != this)
+    {
+        if (allocator() == other.allocator())
+        {
+            m_attributeList.swap(other.m_attributeList);
+            other.m_attributeList.clear();
+        }
+        else
+        {
+            *this = static_cast<const AttributeList &>(other);
+        }
+    }
+
+    return *this;
+}
+#endif
+
+/**
+ * Get allocator
+ *
+ * \return Allocator of the list and of the attributes in it
+ */
+UnicodeString::allocator_type AttributeList::allocator() const
+{
+    return UnicodeString::allocator_type(m_attributeList.get_allocator());
+}
+
+/**
+ * Swap contents (and allocators) with another attribute list
+ *
+ * \param other The input instance
+ */
+void AttributeList::swap(AttributeList &other)
+{
+    if (&other != this)
+    {
+        m_attributeList.swap(other.m_attributeList);
+    }
+}
+
 /**
  * Clear the list
  */
@@ -207,10 +510,20 @@ size_t AttributeList::size() const
  * Add attribute to the list
  *
  * \param attribute Attribute to add
+ *
+ * \return Added attribute (it stays at the same address until it is removed from the list, even
+ *         if the list is swapped)
  */
-void AttributeList::add(const Attribute &attribute)
+const Attribute *AttributeList::add(const Attribute &attribute)
 {
-    m_attributeList.push_back(attribute);
+    // Copy the attribute with the list's allocator and then move it into the list
+    Attribute newAttribute(allocator());
+    newAttribute = attribute;
+
+    m_attributeList.push_back(Attribute());
+    m_attributeList.back().swap(newAttribute);
+
+    return &m_attributeList.back();
 }
 
 /**
@@ -224,7 +537,7 @@ const Attribute *AttributeList::attribute(const UnicodeString &name)
 {
     const Attribute *attribute = NULL;
 
-    for (std::list<Attribute>::const_iterator it = m_attributeList.begin();
+    for (ConstIterator it = m_attributeList.begin();
          it != m_attributeList.end();
          it++)
     {
@@ -0,0 +1,292 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/Common/BinaryStream.h>
+#include <cstring>
+
+using namespace EmbeddedStAX::Common;
+
+/**
+ * Constructor
+ *
+ * \param data  Output for the written data (values are appended to it)
+ */
+BinaryWriter::BinaryWriter(std::string *data)
+    : m_data(data)
+{
+}
+
+/**
+ * Write byte
+ *
+ * \param value Value (from 0 to 255)
+ */
+void BinaryWriter::writeByte(const uint32_t value)
+{
+    m_data->push_back(static_cast<char>(static_cast<uint8_t>(value)));
+}
+
+/**
+ * Write number as a variable length integer
+ *
+ * \param value Value
+ */
+void BinaryWriter::writeNumber(size_t value)
+{
+    while (value >= 0x80U)
+    {
+        writeByte(static_cast<uint32_t>((value & 0x7FU) | 0x80U));
+        value >>= 7U;
+    }
+
+    writeByte(static_cast<uint32_t>(value));
+}
+
+/**
+ * Write string as its UTF-8 size and UTF-8 data
+ *
+ * \param value String
+ */
+void BinaryWriter::writeString(const UnicodeString &value)
+{
+    writeNumber(Utf8::calculateSize(value, 0U, value.size()));
+
+    for (UnicodeString::const_iterator it = value.begin(); it != value.end(); ++it)
+    {
+        const uint32_t unicodeChar = *it;
+
+        if (unicodeChar < 0x80U)
+        {
+            writeByte(unicodeChar);
+        }
+        else if (unicodeChar < 0x800U)
+        {
+            writeByte(0xC0U | (unicodeChar >> 6U));
+            writeByte(0x80U | (unicodeChar & 0x3FU));
+        }
+        else if (unicodeChar < 0x10000U)
+        {
+            writeByte(0xE0U | (unicodeChar >> 12U));
+            writeByte(0x80U | ((unicodeChar >> 6U) & 0x3FU));
+            writeByte(0x80U | (unicodeChar & 0x3FU));
+        }
+        else
+        {
+            writeByte(0xF0U | (unicodeChar >> 18U));
+            writeByte(0x80U | ((unicodeChar >> 12U) & 0x3FU));
+            writeByte(0x80U | ((unicodeChar >> 6U) & 0x3FU));
+            writeByte(0x80U | (unicodeChar & 0x3FU));
+        }
+    }
+}
+
+/**
+ * Constructor
+ *
+ * \param data  Data to read
+ * \param size  Size of the data
+ */
+BinaryReader::BinaryReader(const char *data, const size_t size)
+    : m_data(data),
+      m_size((data != NULL) ? size : 0U),
+      m_position(0U)
+{
+}
+
+/**
+ * Get size of the data
+ *
+ * \return Size of the data
+ */
+size_t BinaryReader::size() const
+{
+    return m_size;
+}
+
+/**
+ * Get current position
+ *
+ * \return Position of the next byte to read
+ */
+size_t BinaryReader::position() const
+{
+    return m_position;
+}
+
+/**
+ * Check for end of data
+ *
+ * \retval true     All of the data was read
+ * \retval false    There is more data to read
+ */
+bool BinaryReader::isEndOfData() const
+{
+    return (m_position >= m_size);
+}
+
+/**
+ * Read byte
+ *
+ * \param[out] value    Output for the value
+ *
+ * \retval true     Success
+ * \retval false    Error, end of data
+ */
+bool BinaryReader::readByte(uint32_t *value)
+{
+    bool success = false;
+
+    if (m_position < m_size)
+    {
+        *value = static_cast<uint8_t>(m_data[m_position]);
+        m_position++;
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Read variable length integer
+ *
+ * \param[out] value    Output for the value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid or truncated number
+ */
+bool BinaryReader::readNumber(size_t *value)
+{
+    bool success = false;
+    bool finished = false;
+    size_t shift = 0U;
+    *value = 0U;
+
+    while ((!finished) && (shift < (sizeof(size_t) * 8U)))
+    {
+        uint32_t data = 0U;
+
+        if (readByte(&data))
+        {
+            *value |= static_cast<size_t>(data & 0x7FU) << shift;
+            shift += 7U;
+
+            if ((data & 0x80U) == 0U)
+            {
+                success = true;
+                finished = true;
+            }
+        }
+        else
+        {
+            finished = true;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Read string
+ *
+ * \param[out] value    Output for the value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid or truncated string
+ */
+bool BinaryReader::readString(UnicodeString *value)
+{
+    size_t size = 0U;
+    bool success = readNumber(&size);
+    value->clear();
+
+    if (success)
+    {
+        success = (size <= (m_size - m_position));
+    }
+
+    if (success)
+    {
+        const size_t endPosition = m_position + size;
+        Utf8 utf8;
+        value->reserve(size);
+
+        while (success && (m_position < endPosition))
+        {
+            const char data = m_data[m_position];
+
+            switch (utf8.write(data))
+            {
+                case Utf8::Result_Success:
+                {
+                    value->push_back(utf8.getChar());
+                    break;
+                }
+
+                case Utf8::Result_Incomplete:
+                {
+                    break;
+                }
+
+                default:
+                {
+                    // Error, invalid UTF-8 data
+                    success = false;
+                    break;
+                }
+            }
+
+            m_position++;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Read and compare raw data
+ *
+ * \param data  Expected data
+ * \param size  Size of the expected data
+ *
+ * \retval true     Data matches
+ * \retval false    Error, data does not match or end of data
+ */
+bool BinaryReader::readData(const char *data, const size_t size)
+{
+    bool success = false;
+
+    if (size <= (m_size - m_position))
+    {
+        if (std::memcmp(&m_data[m_position], data, size) == 0)
+        {
+            m_position += size;
+            success = true;
+        }
+    }
+
+    return success;
+}
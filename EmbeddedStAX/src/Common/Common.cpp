@@ -97,3 +97,163 @@ bool Common::parseDigit(const uint32_t digitCharacter, const uint32_t base, uint
 
     return success;
 }
+
+/**
+ * Decode references in a text or attribute value
+ *
+ * \param      value   Value with references
+ * \param[out] output  Output for the decoded value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid reference
+ *
+ * Predefined entity references and character references are replaced with the referenced
+ * character. Unknown entity references are kept as they are (same as in the token parsers).
+ */
+bool Common::decodeReferences(const UnicodeString &value, UnicodeString *output)
+{
+    bool success = false;
+
+    if (output != NULL)
+    {
+        success = true;
+        output->clear();
+        output->reserve(value.size());
+
+        size_t position = 0U;
+
+        while (success && (position < value.size()))
+        {
+            const uint32_t uchar = value[position];
+
+            if (uchar != static_cast<uint32_t>('&'))
+            {
+                output->push_back(uchar);
+                position++;
+            }
+            else
+            {
+                const size_t endPosition = value.find(static_cast<uint32_t>(';'), position + 1U);
+
+                if ((endPosition == UnicodeString::npos) || (endPosition == (position + 1U)))
+                {
+                    // Error, invalid reference
+                    success = false;
+                }
+                else if (value[position + 1U] == static_cast<uint32_t>('#'))
+                {
+                    // Character reference
+                    size_t digitPosition = position + 2U;
+                    uint32_t base = 10U;
+
+                    if ((digitPosition < endPosition) &&
+                        (value[digitPosition] == static_cast<uint32_t>('x')))
+                    {
+                        base = 16U;
+                        digitPosition++;
+                    }
+
+                    uint32_t charValue = 0U;
+                    success = (digitPosition < endPosition);
+
+                    for (; success && (digitPosition < endPosition); digitPosition++)
+                    {
+                        uint32_t digitValue = 0U;
+                        success = parseDigit(value[digitPosition], base, &digitValue) &&
+                                  (charValue <= 0x10FFFFU);
+                        charValue = (charValue * base) + digitValue;
+                    }
+
+                    if (success && isUnicodeChar(charValue))
+                    {
+                        output->push_back(charValue);
+                    }
+                    else
+                    {
+                        success = false;
+                    }
+                }
+                else
+                {
+                    // Entity reference
+                    const size_t nameSize = endPosition - position - 1U;
+                    const size_t namePosition = position + 1U;
+
+                    if ((nameSize == 3U) && compareUnicodeString(namePosition, value, "amp"))
+                    {
+                        output->push_back(static_cast<uint32_t>('&'));
+                    }
+                    else if ((nameSize == 2U) && compareUnicodeString(namePosition, value, "lt"))
+                    {
+                        output->push_back(static_cast<uint32_t>('<'));
+                    }
+                    else if ((nameSize == 2U) && compareUnicodeString(namePosition, value, "gt"))
+                    {
+                        output->push_back(static_cast<uint32_t>('>'));
+                    }
+                    else if ((nameSize == 4U) &&
+                             compareUnicodeString(namePosition, value, "apos"))
+                    {
+                        output->push_back(static_cast<uint32_t>('\''));
+                    }
+                    else if ((nameSize == 4U) &&
+                             compareUnicodeString(namePosition, value, "quot"))
+                    {
+                        output->push_back(static_cast<uint32_t>('"'));
+                    }
+                    else
+                    {
+                        // Unknown entity reference, keep the full entity reference
+                        output->append(value, position, endPosition + 1U - position);
+                    }
+                }
+
+                position = endPosition + 1U;
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Append a character reference (in hexadecimal format) for the selected character
+ *
+ * \param      unicodeChar Unicode character
+ * \param[out] output      Output string
+ *
+ * Format:
+ * \code{.unparsed}
+ * CharRef ::= '&#x' [0-9a-fA-F]+ ';'
+ * \endcode
+ */
+void Common::appendCharacterReference(const uint32_t unicodeChar, UnicodeString *output)
+{
+    if (output != NULL)
+    {
+        static const char hexDigits[] = "0123456789ABCDEF";
+        uint32_t digits[8];
+        size_t digitCount = 0U;
+        uint32_t value = unicodeChar;
+
+        do
+        {
+            digits[digitCount] = static_cast<uint32_t>(hexDigits[value & 0xFU]);
+            digitCount++;
+            value >>= 4U;
+        }
+        while (value != 0U);
+
+        output->push_back(static_cast<uint32_t>('&'));
+        output->push_back(static_cast<uint32_t>('#'));
+        output->push_back(static_cast<uint32_t>('x'));
+
+        while (digitCount > 0U)
+        {
+            digitCount--;
+            output->push_back(digits[digitCount]);
+        }
+
+        output->push_back(static_cast<uint32_t>(';'));
+    }
+}
@@ -28,6 +28,10 @@
 #include <EmbeddedStAX/Common/DocumentType.h>
 #include <EmbeddedStAX/XmlValidator/Name.h>
 
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
 using namespace EmbeddedStAX::Common;
 
 /**
@@ -40,10 +44,22 @@ DocumentType::DocumentType(const UnicodeString &name)
 {
 }
 
+/**
+ * Constructor
+ *
+ * \param allocator Allocator for the name of the root element
+ */
+DocumentType::DocumentType(const UnicodeString::allocator_type &allocator)
+    : m_name(allocator)
+{
+}
+
 /**
  * Copy constructor
  *
  * \param other Document type
+ *
+ * \note The copy uses the global allocator (C++11 and later).
  */
 DocumentType::DocumentType(const DocumentType &other)
     : m_name(other.m_name)
@@ -65,6 +81,60 @@ DocumentType &DocumentType::operator=(const DocumentType &other)
     return *this;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Move constructor
+ *
+ * \param other Document type
+ *
+ * \note The document type takes over the contents and the allocator of the other document type.
+ */
+DocumentType::DocumentType(DocumentType &&other) noexcept
+    : m_name(std::move(other.m_name))
+{
+}
+
+/**
+ * Move assignment operator
+ *
+ * \param other Document type
+ *
+ * \note Contents are copied if the allocators of the document types are not equal.
+ */
+DocumentType &DocumentType::operator=(DocumentType &&other)
+{
+    if (this != &other)
+    {
+        m_name = std::move(other.m_name);
+    }
+
+    return *this;
+}
+#endif
+
+/**
+ * Get allocator
+ *
+ * \return Allocator of the name of the root element
+ */
+UnicodeString::allocator_type DocumentType::allocator() const
+{
+    return m_name.get_allocator();
+}
+
+/**
+ * Swap contents (and allocators) with another document type
+ *
+ * \param other Document type
+ */
+void DocumentType::swap(DocumentType &other)
+{
+    if (this != &other)
+    {
+        m_name.swap(other.m_name);
+    }
+}
+
 /**
  * Check if processing instruction is valid
  *
@@ -89,7 +159,7 @@ void DocumentType::clear()
  *
  * \return Name of the root element
  */
-UnicodeString DocumentType::name() const
+const UnicodeString &DocumentType::name() const
 {
     return m_name;
 }
@@ -28,6 +28,10 @@
 #include <EmbeddedStAX/Common/ProcessingInstruction.h>
 #include <EmbeddedStAX/XmlValidator/ProcessingInstruction.h>
 
+#if __cplusplus >= 201103L
+#include <utility>
+#endif
+
 using namespace EmbeddedStAX::Common;
 
 /**
@@ -43,10 +47,23 @@ ProcessingInstruction::ProcessingInstruction(const UnicodeString &piTarget,
 {
 }
 
+/**
+ * Constructor
+ *
+ * \param allocator Allocator for the processing instruction name and data
+ */
+ProcessingInstruction::ProcessingInstruction(const UnicodeString::allocator_type &allocator)
+    : m_piTarget(allocator),
+      m_piData(allocator)
+{
+}
+
 /**
  * Copy constructor
  *
  * \param other Processing instruction
+ *
+ * \note The copy uses the global allocator (C++11 and later).
  */
 ProcessingInstruction::ProcessingInstruction(const ProcessingInstruction &other)
     : m_piTarget(other.m_piTarget),
@@ -70,6 +87,64 @@ ProcessingInstruction &ProcessingInstruction::operator=(const ProcessingInstruct
     return *this;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Move constructor
+ *
+ * \param other Processing instruction
+ *
+ * \note The processing instruction takes over the contents and the allocator of the other
+ *       processing instruction.
+ */
+ProcessingInstruction::ProcessingInstruction(ProcessingInstruction &&other) noexcept
+    : m_piTarget(std::move(other.m_piTarget)),
+      m_piData(std::move(other.m_piData))
+{
+}
+
+/**
+ * Move assignment operator
+ *
+ * \param other Processing instruction
+ *
+ * \note Contents are copied if the allocators of the processing instructions are not equal.
+ */
+ProcessingInstruction &ProcessingInstruction::operator=(ProcessingInstruction &&other)
+{
+    if (this != &other)
+    {
+        m_piTarget = std::move(other.m_piTarget);
+        m_piData = std::move(other.m_piData);
+    }
+
+    return *this;
+}
+#endif
+
+/**
+ * Get allocator
+ *
+ * \return Allocator of the processing instruction name and data
+ */
+UnicodeString::allocator_type ProcessingInstruction::allocator() const
+{
+    return m_piTarget.get_allocator();
+}
+
+/**
+ * Swap contents (and allocators) with another processing instruction
+ *
+ * \param other Processing instruction
+ */
+void ProcessingInstruction::swap(ProcessingInstruction &other)
+{
+    if (this != &other)
+    {
+        m_piTarget.swap(other.m_piTarget);
+        m_piData.swap(other.m_piData);
+    }
+}
+
 /**
  * Check if processing instruction is valid
  *
@@ -102,7 +177,7 @@ void ProcessingInstruction::clear()
  *
  * \return Processing instruction name
  */
-UnicodeString ProcessingInstruction::piTarget() const
+const UnicodeString &ProcessingInstruction::piTarget() const
 {
     return m_piTarget;
 }
@@ -122,7 +197,7 @@ void ProcessingInstruction::setPiTarget(const UnicodeString &piTarget)
  *
  * \return Processing instruction data
  */
-UnicodeString ProcessingInstruction::piData() const
+const UnicodeString &ProcessingInstruction::piData() const
 {
     return m_piData;
 }
@@ -0,0 +1,293 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/Common/SymbolTable.h>
+
+using namespace EmbeddedStAX::Common;
+
+/**
+ * Symbol ID that is returned when a symbol is not found
+ */
+const uint32_t SymbolTable::InvalidSymbol = 0xFFFFFFFFU;
+
+/**
+ * Constructor
+ */
+SymbolTable::SymbolTable()
+    : m_baseTable(NULL),
+      m_symbols(),
+      m_symbolHashes(),
+      m_buckets()
+{
+}
+
+/**
+ * Clear the table
+ *
+ * \note All of the previously returned symbol IDs become invalid (except for the IDs of the
+ *       symbols of the base table)
+ */
+void SymbolTable::clear()
+{
+    m_symbols.clear();
+    m_symbolHashes.clear();
+    m_buckets.clear();
+}
+
+/**
+ * Get number of symbols in the table
+ *
+ * \return Number of symbols
+ */
+size_t SymbolTable::size() const
+{
+    return baseSize() + m_symbols.size();
+}
+
+/**
+ * Get base table
+ *
+ * \return Base table or NULL if the table is not layered on top of a base table
+ */
+const SymbolTable *SymbolTable::baseTable() const
+{
+    return m_baseTable;
+}
+
+/**
+ * Set base table
+ *
+ * \param baseTable Base table (NULL for none)
+ *
+ * Symbols are first looked up in the base table and only the symbols that are not found there are
+ * added to this table. IDs of the added symbols follow the IDs of the symbols of the base table.
+ *
+ * \note The table is cleared
+ * \note Base table is only read so it can be shared by many tables (also from different threads),
+ *       but it must not be modified or destroyed while it is used by this table
+ */
+void SymbolTable::setBaseTable(const SymbolTable *baseTable)
+{
+    clear();
+    m_baseTable = baseTable;
+}
+
+/**
+ * Add symbol to the table
+ *
+ * \param name  Symbol
+ *
+ * \return Symbol ID (if the symbol is already in the table its existing ID is returned)
+ */
+uint32_t SymbolTable::add(const UnicodeString &name)
+{
+    const uint32_t nameHash = hash(name);
+    uint32_t id = InvalidSymbol;
+
+    if (m_baseTable != NULL)
+    {
+        id = m_baseTable->find(name);
+    }
+
+    if ((id == InvalidSymbol) && (!m_buckets.empty()))
+    {
+        const size_t bucket = findBucket(name, nameHash);
+
+        if (m_buckets[bucket] != 0U)
+        {
+            id = baseSize() + m_buckets[bucket] - 1U;
+        }
+    }
+
+    if (id == InvalidSymbol)
+    {
+        // Keep the load factor under 1/2
+        if (((m_symbols.size() + 1U) * 2U) > m_buckets.size())
+        {
+            rehash((m_buckets.size() == 0U) ? 64U : (m_buckets.size() * 2U));
+        }
+
+        // Symbol is copied with the global allocator so that it does not depend on the input
+        const uint32_t localId = static_cast<uint32_t>(m_symbols.size());
+        m_symbols.push_back(UnicodeString());
+        m_symbols.back().assign(name.begin(), name.end());
+        m_symbolHashes.push_back(nameHash);
+
+        m_buckets[findBucket(name, nameHash)] = localId + 1U;
+        id = baseSize() + localId;
+    }
+
+    return id;
+}
+
+/**
+ * Find symbol in the table
+ *
+ * \param name  Symbol
+ *
+ * \return Symbol ID or InvalidSymbol if the symbol is not in the table
+ */
+uint32_t SymbolTable::find(const UnicodeString &name) const
+{
+    uint32_t id = InvalidSymbol;
+
+    if (m_baseTable != NULL)
+    {
+        id = m_baseTable->find(name);
+    }
+
+    if ((id == InvalidSymbol) && (!m_buckets.empty()))
+    {
+        const size_t bucket = findBucket(name, hash(name));
+
+        if (m_buckets[bucket] != 0U)
+        {
+            id = baseSize() + m_buckets[bucket] - 1U;
+        }
+    }
+
+    return id;
+}
+
+/**
+ * Get symbol
+ *
+ * \param id    Symbol ID
+ *
+ * \return Symbol or an empty string if symbol ID is not valid
+ */
+const UnicodeString &SymbolTable::symbol(const uint32_t id) const
+{
+    static const UnicodeString emptySymbol;
+    const UnicodeString *symbol = &emptySymbol;
+    const uint32_t localIdStart = baseSize();
+
+    if (id < localIdStart)
+    {
+        symbol = &m_baseTable->symbol(id);
+    }
+    else if ((id - localIdStart) < m_symbols.size())
+    {
+        symbol = &m_symbols[id - localIdStart];
+    }
+    else
+    {
+        // Invalid symbol ID
+    }
+
+    return *symbol;
+}
+
+/**
+ * Calculate hash of the symbol (FNV-1a)
+ *
+ * \param name  Symbol
+ *
+ * \return Hash value
+ */
+uint32_t SymbolTable::hash(const UnicodeString &name)
+{
+    uint32_t value = 2166136261U;
+
+    for (size_t i = 0U; i < name.size(); i++)
+    {
+        value = (value ^ name[i]) * 16777619U;
+    }
+
+    return value;
+}
+
+/**
+ * Get number of symbols in the base table
+ *
+ * \return Number of symbols (0 if the table is not layered on top of a base table)
+ */
+uint32_t SymbolTable::baseSize() const
+{
+    uint32_t size = 0U;
+
+    if (m_baseTable != NULL)
+    {
+        size = static_cast<uint32_t>(m_baseTable->size());
+    }
+
+    return size;
+}
+
+/**
+ * Find bucket for the symbol (open addressing with linear probing)
+ *
+ * \param name      Symbol
+ * \param nameHash  Hash of the symbol
+ *
+ * \return Index of the bucket that holds the symbol or of the empty bucket where it can be added
+ *
+ * \note There must be at least one bucket
+ */
+size_t SymbolTable::findBucket(const UnicodeString &name, const uint32_t nameHash) const
+{
+    const size_t mask = m_buckets.size() - 1U;
+    size_t bucket = nameHash & mask;
+
+    while (m_buckets[bucket] != 0U)
+    {
+        const uint32_t id = m_buckets[bucket] - 1U;
+
+        if ((m_symbolHashes[id] == nameHash) && (m_symbols[id] == name))
+        {
+            break;
+        }
+
+        bucket = (bucket + 1U) & mask;
+    }
+
+    return bucket;
+}
+
+/**
+ * Rebuild the hash table
+ *
+ * \param bucketCount   New number of buckets (must be a power of 2)
+ */
+void SymbolTable::rehash(const size_t bucketCount)
+{
+    m_buckets.assign(bucketCount, 0U);
+
+    const size_t mask = bucketCount - 1U;
+
+    for (size_t id = 0U; id < m_symbols.size(); id++)
+    {
+        size_t bucket = m_symbolHashes[id] & mask;
+
+        while (m_buckets[bucket] != 0U)
+        {
+            bucket = (bucket + 1U) & mask;
+        }
+
+        m_buckets[bucket] = static_cast<uint32_t>(id + 1U);
+    }
+}
@@ -0,0 +1,685 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/Common/TypedValue.h>
+#include <EmbeddedStAX/Common/Common.h>
+#include <limits>
+#include <stdlib.h>
+#include <string>
+
+using namespace EmbeddedStAX;
+
+namespace
+{
+/**
+ * Largest integer that can be represented exactly with a double (2^53)
+ */
+const uint64_t maxExactDoubleMantissa = 0x20000000000000ULL;
+
+/**
+ * Powers of ten that can be represented exactly with a double
+ */
+const double exactPowersOfTen[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * Maximum exponent of the exact powers of ten
+ */
+const int32_t maxExactPowerOfTen = 22;
+
+/**
+ * Size of the stack buffer that is used for the values that are passed to strtod()
+ */
+const size_t doubleBufferSize = 64U;
+
+/**
+ * Find the value without the leading and trailing whitespace
+ *
+ * \param      value   Value
+ * \param[out] begin   Output for the position of the first non-whitespace character
+ * \param[out] end     Output for the position after the last non-whitespace character
+ */
+void trimWhitespace(const Common::UnicodeString &value, size_t *begin, size_t *end)
+{
+    *begin = 0U;
+    *end = value.size();
+
+    while ((*begin < *end) &&
+           ((value[*begin] == 0x20U) || (value[*begin] == 0x09U) ||
+            (value[*begin] == 0x0DU) || (value[*begin] == 0x0AU)))
+    {
+        (*begin)++;
+    }
+
+    while ((*begin < *end) &&
+           ((value[*end - 1U] == 0x20U) || (value[*end - 1U] == 0x09U) ||
+            (value[*end - 1U] == 0x0DU) || (value[*end - 1U] == 0x0AU)))
+    {
+        (*end)--;
+    }
+}
+
+/**
+ * Compare a part of the value with an ASCII string
+ *
+ * \param value     Value
+ * \param begin     Start position of the part
+ * \param end       End position of the part
+ * \param ascii     ASCII string
+ *
+ * \retval true     Equal
+ * \retval false    Not equal
+ */
+bool equalsAscii(const Common::UnicodeString &value,
+                 const size_t begin,
+                 const size_t end,
+                 const char *ascii)
+{
+    size_t position = begin;
+
+    while ((position < end) && (*ascii != '\0'))
+    {
+        if (value[position] != static_cast<uint32_t>(static_cast<unsigned char>(*ascii)))
+        {
+            break;
+        }
+
+        position++;
+        ascii++;
+    }
+
+    return ((position == end) && (*ascii == '\0'));
+}
+
+/**
+ * Read a number with a fixed number of decimal digits
+ *
+ * \param         value        Value
+ * \param         end          End position of the value
+ * \param[in,out] position     Position in the value (it is moved after the digits)
+ * \param         digitCount   Number of digits
+ * \param[out]    number       Output for the number
+ *
+ * \retval true     Success
+ * \retval false    Error, not enough digits
+ */
+bool readFixedNumber(const Common::UnicodeString &value,
+                     const size_t end,
+                     size_t *position,
+                     const size_t digitCount,
+                     uint32_t *number)
+{
+    bool success = ((*position + digitCount) <= end);
+    *number = 0U;
+
+    for (size_t i = 0U; success && (i < digitCount); i++)
+    {
+        uint32_t digitValue = 0U;
+        success = Common::parseDigit(value[*position], 10U, &digitValue);
+        *number = (*number * 10U) + digitValue;
+        (*position)++;
+    }
+
+    return success;
+}
+
+/**
+ * Read a character
+ *
+ * \param         value        Value
+ * \param         end          End position of the value
+ * \param[in,out] position     Position in the value (it is moved after the character)
+ * \param         character    Expected character
+ *
+ * \retval true     Success
+ * \retval false    Error, character does not match
+ */
+bool readCharacter(const Common::UnicodeString &value,
+                   const size_t end,
+                   size_t *position,
+                   const char character)
+{
+    bool success = false;
+
+    if (*position < end)
+    {
+        if (value[*position] == static_cast<uint32_t>(character))
+        {
+            (*position)++;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Convert a date to the number of days since 1970-01-01
+ *
+ * \param year  Year
+ * \param month Month (1 to 12)
+ * \param day   Day of the month (1 to 31)
+ *
+ * \return Number of days since 1970-01-01
+ */
+int64_t daysFromCivil(const int64_t year, const uint32_t month, const uint32_t day)
+{
+    const int64_t adjustedYear = (month <= 2U) ? (year - 1) : year;
+    const int64_t era = ((adjustedYear >= 0) ? adjustedYear : (adjustedYear - 399)) / 400;
+    const int64_t yearOfEra = adjustedYear - (era * 400);
+    const int64_t shiftedMonth = (month > 2U) ? (static_cast<int64_t>(month) - 3)
+                                              : (static_cast<int64_t>(month) + 9);
+    const int64_t dayOfYear = (((153 * shiftedMonth) + 2) / 5) + static_cast<int64_t>(day) - 1;
+    const int64_t dayOfEra =
+            (yearOfEra * 365) + (yearOfEra / 4) - (yearOfEra / 100) + dayOfYear;
+
+    return (era * 146097) + dayOfEra - 719468;
+}
+
+/**
+ * Get number of days in a month
+ *
+ * \param year  Year
+ * \param month Month (1 to 12)
+ *
+ * \return Number of days in the month
+ */
+uint32_t daysInMonth(const uint32_t year, const uint32_t month)
+{
+    static const uint32_t days[] = { 31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U };
+    uint32_t result = days[month - 1U];
+
+    if (month == 2U)
+    {
+        if ((((year % 4U) == 0U) && ((year % 100U) != 0U)) || ((year % 400U) == 0U))
+        {
+            result = 29U;
+        }
+    }
+
+    return result;
+}
+}
+
+/**
+ * Parse a 64-bit signed integer value
+ *
+ * \param      value    Value (for example "-1234"), leading and trailing whitespace is ignored
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value or value is out of range
+ */
+bool Common::parseInt64(const UnicodeString &value, int64_t *result)
+{
+    bool success = false;
+
+    if (result != NULL)
+    {
+        size_t position = 0U;
+        size_t end = 0U;
+        trimWhitespace(value, &position, &end);
+
+        // Sign
+        bool negative = false;
+
+        if (position < end)
+        {
+            if (value[position] == static_cast<uint32_t>('-'))
+            {
+                negative = true;
+                position++;
+            }
+            else if (value[position] == static_cast<uint32_t>('+'))
+            {
+                position++;
+            }
+            else
+            {
+                // No sign
+            }
+        }
+
+        // Digits
+        const uint64_t limit =
+                negative ? (static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + 1U)
+                         : static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        uint64_t magnitude = 0U;
+        success = (position < end);
+
+        while (success && (position < end))
+        {
+            uint32_t digitValue = 0U;
+            success = parseDigit(value[position], 10U, &digitValue);
+
+            if (success)
+            {
+                if (magnitude > ((limit - digitValue) / 10U))
+                {
+                    // Error, out of range
+                    success = false;
+                }
+                else
+                {
+                    magnitude = (magnitude * 10U) + digitValue;
+                    position++;
+                }
+            }
+        }
+
+        if (success)
+        {
+            if (!negative)
+            {
+                *result = static_cast<int64_t>(magnitude);
+            }
+            else if (magnitude == 0U)
+            {
+                *result = 0;
+            }
+            else
+            {
+                *result = -static_cast<int64_t>(magnitude - 1U) - 1;
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Parse a floating point value
+ *
+ * \param      value    Value (xs:double syntax, for example "-1.5E3", "INF" or "NaN"), leading and
+ *                      trailing whitespace is ignored
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ *
+ * Values with up to 2^53 as the mantissa and a small exponent are converted directly (the result
+ * is exact), other values are converted with strtod() from a buffer on the stack.
+ *
+ * \note strtod() uses the decimal point of the current C locale.
+ */
+bool Common::parseDouble(const UnicodeString &value, double *result)
+{
+    bool success = false;
+
+    if (result != NULL)
+    {
+        size_t begin = 0U;
+        size_t end = 0U;
+        trimWhitespace(value, &begin, &end);
+
+        size_t position = begin;
+        bool negative = false;
+        bool special = false;
+        bool exact = true;
+        uint64_t mantissa = 0U;
+        int32_t exponent = 0;
+        size_t digitCount = 0U;
+
+        // Sign
+        if (position < end)
+        {
+            if (value[position] == static_cast<uint32_t>('-'))
+            {
+                negative = true;
+                position++;
+            }
+            else if (value[position] == static_cast<uint32_t>('+'))
+            {
+                position++;
+            }
+            else
+            {
+                // No sign
+            }
+        }
+
+        if (equalsAscii(value, position, end, "INF"))
+        {
+            // Infinity
+            special = true;
+            success = true;
+        }
+        else if ((position == begin) && equalsAscii(value, position, end, "NaN"))
+        {
+            // Not a number (without a sign)
+            special = true;
+            success = true;
+        }
+        else
+        {
+            // Integer and fraction digits
+            bool fraction = false;
+            success = true;
+
+            while (success && (position < end))
+            {
+                uint32_t digitValue = 0U;
+
+                if (parseDigit(value[position], 10U, &digitValue))
+                {
+                    digitCount++;
+
+                    if (mantissa <= ((maxExactDoubleMantissa - digitValue) / 10U))
+                    {
+                        mantissa = (mantissa * 10U) + digitValue;
+
+                        if (fraction)
+                        {
+                            exponent--;
+                        }
+                    }
+                    else
+                    {
+                        exact = false;
+                    }
+
+                    position++;
+                }
+                else if ((value[position] == static_cast<uint32_t>('.')) && (!fraction))
+                {
+                    fraction = true;
+                    position++;
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            success = (digitCount > 0U);
+
+            // Exponent
+            if (success && (position < end))
+            {
+                success = ((value[position] == static_cast<uint32_t>('e')) ||
+                           (value[position] == static_cast<uint32_t>('E')));
+                position++;
+
+                if (success)
+                {
+                    // Exponent value is saturated (it is out of range anyway)
+                    const int32_t maxExponent = 100000;
+                    bool negativeExponent = false;
+                    int32_t exponentValue = 0;
+
+                    if (position < end)
+                    {
+                        if (value[position] == static_cast<uint32_t>('-'))
+                        {
+                            negativeExponent = true;
+                            position++;
+                        }
+                        else if (value[position] == static_cast<uint32_t>('+'))
+                        {
+                            position++;
+                        }
+                        else
+                        {
+                            // No sign
+                        }
+                    }
+
+                    success = (position < end);
+
+                    while (success && (position < end))
+                    {
+                        uint32_t digitValue = 0U;
+                        success = parseDigit(value[position], 10U, &digitValue);
+
+                        if (exponentValue < maxExponent)
+                        {
+                            exponentValue = (exponentValue * 10) + static_cast<int32_t>(digitValue);
+                        }
+
+                        position++;
+                    }
+
+                    exponent += negativeExponent ? -exponentValue : exponentValue;
+                }
+            }
+        }
+
+        if (success)
+        {
+            if ((!special) &&
+                exact &&
+                (exponent >= -maxExactPowerOfTen) &&
+                (exponent <= maxExactPowerOfTen))
+            {
+                // Fast path: both the mantissa and the power of ten are exact so the result is
+                // correctly rounded
+                double number = static_cast<double>(mantissa);
+
+                if (exponent < 0)
+                {
+                    number /= exactPowersOfTen[-exponent];
+                }
+                else
+                {
+                    number *= exactPowersOfTen[exponent];
+                }
+
+                *result = negative ? -number : number;
+            }
+            else
+            {
+                // Slow path: value is already validated so it contains only ASCII characters
+                const size_t size = end - begin;
+                char buffer[doubleBufferSize];
+                std::string longBuffer;
+                char *data = buffer;
+
+                if (size >= doubleBufferSize)
+                {
+                    longBuffer.resize(size + 1U);
+                    data = &longBuffer[0];
+                }
+
+                for (size_t i = 0U; i < size; i++)
+                {
+                    data[i] = static_cast<char>(value[begin + i]);
+                }
+
+                data[size] = '\0';
+                *result = strtod(data, NULL);
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Parse a boolean value
+ *
+ * \param      value    Value ("true", "false", "1" or "0"), leading and trailing whitespace is
+ *                      ignored
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool Common::parseBool(const UnicodeString &value, bool *result)
+{
+    bool success = false;
+
+    if (result != NULL)
+    {
+        size_t begin = 0U;
+        size_t end = 0U;
+        trimWhitespace(value, &begin, &end);
+
+        if (equalsAscii(value, begin, end, "true") || equalsAscii(value, begin, end, "1"))
+        {
+            *result = true;
+            success = true;
+        }
+        else if (equalsAscii(value, begin, end, "false") || equalsAscii(value, begin, end, "0"))
+        {
+            *result = false;
+            success = true;
+        }
+        else
+        {
+            // Error, invalid value
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Parse an ISO 8601 timestamp
+ *
+ * \param      value    Value in format "YYYY-MM-DDThh:mm:ss[.fraction][Z|(+|-)hh:mm]", leading
+ *                      and trailing whitespace is ignored
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ *
+ * \note Timestamp without a time zone is treated as UTC. Fraction digits after the first nine are
+ *       ignored.
+ */
+bool Common::parseTimestamp(const UnicodeString &value, Timestamp *result)
+{
+    bool success = false;
+
+    if (result != NULL)
+    {
+        size_t position = 0U;
+        size_t end = 0U;
+        trimWhitespace(value, &position, &end);
+
+        uint32_t year = 0U;
+        uint32_t month = 0U;
+        uint32_t day = 0U;
+        uint32_t hour = 0U;
+        uint32_t minute = 0U;
+        uint32_t second = 0U;
+        uint32_t nanoseconds = 0U;
+        int64_t offset = 0;
+
+        // Date and time
+        success = readFixedNumber(value, end, &position, 4U, &year) &&
+                  readCharacter(value, end, &position, '-') &&
+                  readFixedNumber(value, end, &position, 2U, &month) &&
+                  readCharacter(value, end, &position, '-') &&
+                  readFixedNumber(value, end, &position, 2U, &day) &&
+                  readCharacter(value, end, &position, 'T') &&
+                  readFixedNumber(value, end, &position, 2U, &hour) &&
+                  readCharacter(value, end, &position, ':') &&
+                  readFixedNumber(value, end, &position, 2U, &minute) &&
+                  readCharacter(value, end, &position, ':') &&
+                  readFixedNumber(value, end, &position, 2U, &second);
+
+        if (success)
+        {
+            success = ((1U <= month) && (month <= 12U) &&
+                       (1U <= day) && (day <= daysInMonth(year, month)) &&
+                       (hour <= 23U) && (minute <= 59U) && (second <= 59U));
+        }
+
+        // Fraction of the second
+        if (success && readCharacter(value, end, &position, '.'))
+        {
+            uint32_t digitCount = 0U;
+            uint32_t digitValue = 0U;
+
+            while ((position < end) && parseDigit(value[position], 10U, &digitValue))
+            {
+                if (digitCount < 9U)
+                {
+                    nanoseconds = (nanoseconds * 10U) + digitValue;
+                }
+
+                digitCount++;
+                position++;
+            }
+
+            success = (digitCount > 0U);
+
+            for (uint32_t i = digitCount; i < 9U; i++)
+            {
+                nanoseconds *= 10U;
+            }
+        }
+
+        // Time zone
+        if (success && (position < end))
+        {
+            if (readCharacter(value, end, &position, 'Z'))
+            {
+                // UTC
+            }
+            else
+            {
+                const bool negative = (value[position] == static_cast<uint32_t>('-'));
+                uint32_t offsetHour = 0U;
+                uint32_t offsetMinute = 0U;
+
+                success = (readCharacter(value, end, &position, '+') ||
+                           readCharacter(value, end, &position, '-')) &&
+                          readFixedNumber(value, end, &position, 2U, &offsetHour) &&
+                          readCharacter(value, end, &position, ':') &&
+                          readFixedNumber(value, end, &position, 2U, &offsetMinute) &&
+                          (offsetHour <= 14U) &&
+                          (offsetMinute <= 59U);
+
+                offset = (static_cast<int64_t>(offsetHour) * 3600) +
+                         (static_cast<int64_t>(offsetMinute) * 60);
+
+                if (negative)
+                {
+                    offset = -offset;
+                }
+            }
+
+            success = success && (position == end);
+        }
+
+        if (success)
+        {
+            result->seconds = (daysFromCivil(static_cast<int64_t>(year), month, day) * 86400) +
+                              (static_cast<int64_t>(hour) * 3600) +
+                              (static_cast<int64_t>(minute) * 60) +
+                              static_cast<int64_t>(second) -
+                              offset;
+            result->nanoseconds = nanoseconds;
+        }
+    }
+
+    return success;
+}
@@ -189,6 +189,16 @@ uint32_t Utf8::getChar() const
     return m_char;
 }
 
+/**
+ * Get size of the incomplete unicode character
+ *
+ * \return Number of bytes of the incomplete unicode character that were already written
+ */
+size_t Utf8::incompleteSize() const
+{
+    return m_index;
+}
+
 /**
  * Convert unicode character to UTF-8 string
  *
@@ -71,6 +71,54 @@ XmlDeclaration &XmlDeclaration::operator=(const XmlDeclaration &other)
     return *this;
 }
 
+#if __cplusplus >= 201103L
+/**
+ * Move constructor
+ *
+ * \param other XML declaration
+ *
+ * \note XML declaration holds only plain values so this is the same as a copy.
+ */
+XmlDeclaration::XmlDeclaration(XmlDeclaration &&other) noexcept
+    : m_version(other.m_version),
+      m_encoding(other.m_encoding),
+      m_standalone(other.m_standalone)
+{
+}
+
+/**
+ * Move assignment operator
+ *
+ * \param other XML declaration
+ */
+XmlDeclaration &XmlDeclaration::operator=(XmlDeclaration &&other)
+{
+    if (this != &other)
+    {
+        m_version = other.m_version;
+        m_encoding = other.m_encoding;
+        m_standalone = other.m_standalone;
+    }
+
+    return *this;
+}
+#endif
+
+/**
+ * Swap contents with another XML declaration
+ *
+ * \param other XML declaration
+ */
+void XmlDeclaration::swap(XmlDeclaration &other)
+{
+    if (this != &other)
+    {
+        const XmlDeclaration temp(*this);
+        *this = other;
+        other = temp;
+    }
+}
+
 /**
  * Check if processing instruction is valid
  *
@@ -0,0 +1,157 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/AbstractXmlHandler.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ */
+AbstractXmlHandler::AbstractXmlHandler()
+{
+}
+
+/**
+ * Destructor
+ */
+AbstractXmlHandler::~AbstractXmlHandler()
+{
+}
+
+/**
+ * Handle XML declaration
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onXmlDeclaration(const Common::XmlDeclaration &)
+{
+    return true;
+}
+
+/**
+ * Handle processing instruction
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onProcessingInstruction(const Common::ProcessingInstruction &)
+{
+    return true;
+}
+
+/**
+ * Handle document type
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onDocumentType(const Common::DocumentType &)
+{
+    return true;
+}
+
+/**
+ * Handle comment
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onComment(const Common::UnicodeString &)
+{
+    return true;
+}
+
+/**
+ * Handle start of element
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ *
+ * \note XmlReader::skipElement() can be called from this callback.
+ */
+bool AbstractXmlHandler::onStartOfElement(const Common::UnicodeString &,
+                                          const Common::AttributeList &)
+{
+    return true;
+}
+
+/**
+ * Handle end of element
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onEndOfElement(const Common::UnicodeString &)
+{
+    return true;
+}
+
+/**
+ * Handle text node
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onTextNode(const Common::UnicodeString &)
+{
+    return true;
+}
+
+/**
+ * Handle CDATA
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onCData(const Common::UnicodeString &)
+{
+    return true;
+}
+
+/**
+ * Handle text chunk (see XmlReader::setTextChunkSize())
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool AbstractXmlHandler::onTextChunk(const Common::UnicodeString &)
+{
+    return true;
+}
+
+/**
+ * Handle end of document (the reader then continues with the next document in the data stream)
+ *
+ * etval true     Continue parsing
+ * etval false    Stop parsing
+ */
+bool AbstractXmlHandler::onEndOfDocument()
+{
+    return true;
+}
@@ -0,0 +1,427 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/DocumentScanner.h>
+#include <string.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+/**
+ * Markup types that are recognized by the scanner
+ */
+enum Markup
+{
+    Markup_Incomplete,
+    Markup_Skipped,
+    Markup_StartTag,
+    Markup_EmptyElementTag,
+    Markup_EndTag
+};
+
+/**
+ * Compare the data with a sequence
+ *
+ * \param data      Data
+ * \param size      Size of the data
+ * \param position  Position in the data
+ * \param sequence  Sequence (null terminated)
+ *
+ * \retval 1    Data at the position starts with the sequence
+ * \retval 0    Data at the position does not start with the sequence
+ * \retval -1   Data at the position is a prefix of the sequence (more data is needed)
+ */
+int compareSequence(const char *data, const size_t size, const size_t position,
+                    const char *sequence)
+{
+    int result = 1;
+
+    for (size_t i = 0U; sequence[i] != '\0'; i++)
+    {
+        if ((position + i) >= size)
+        {
+            result = -1;
+            break;
+        }
+
+        if (data[position + i] != sequence[i])
+        {
+            result = 0;
+            break;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Find the end of a sequence in the data
+ *
+ * \param data      Data
+ * \param size      Size of the data
+ * \param position  Position in the data where the search is started
+ * \param sequence  Sequence (null terminated)
+ *
+ * \return Position right after the sequence
+ * \retval 0    Sequence was not found
+ */
+size_t findSequenceEnd(const char *data, const size_t size, const size_t position,
+                       const char *sequence)
+{
+    const size_t length = strlen(sequence);
+    size_t end = 0U;
+
+    for (size_t i = position; (i + length) <= size; i++)
+    {
+        const void *next = memchr(&data[i], sequence[0], size - i);
+
+        if (next == NULL)
+        {
+            break;
+        }
+
+        i = static_cast<size_t>(static_cast<const char *>(next) - data);
+
+        if (compareSequence(data, size, i, sequence) == 1)
+        {
+            end = i + length;
+            break;
+        }
+    }
+
+    return end;
+}
+
+/**
+ * Find the end of a tag or a document type declaration
+ *
+ * \param data      Data
+ * \param size      Size of the data
+ * \param position  Position in the data where the search is started
+ *
+ * \return Position right after the '>' character that ends the markup
+ * \retval 0    End of the markup was not found
+ *
+ * Quoted values and the internal subset of the document type declaration ("[...]") can contain
+ * '>' characters.
+ */
+size_t findMarkupEnd(const char *data, const size_t size, const size_t position)
+{
+    char quotationMark = '\0';
+    size_t subsetDepth = 0U;
+    size_t end = 0U;
+
+    for (size_t i = position; (i < size) && (end == 0U); i++)
+    {
+        const char character = data[i];
+
+        if (quotationMark != '\0')
+        {
+            if (character == quotationMark)
+            {
+                quotationMark = '\0';
+            }
+        }
+        else if ((character == '"') || (character == '\''))
+        {
+            quotationMark = character;
+        }
+        else if (character == '[')
+        {
+            subsetDepth++;
+        }
+        else if ((character == ']') && (subsetDepth > 0U))
+        {
+            subsetDepth--;
+        }
+        else if ((character == '>') && (subsetDepth == 0U))
+        {
+            end = i + 1U;
+        }
+        else
+        {
+            // Other characters are skipped
+        }
+    }
+
+    return end;
+}
+
+/**
+ * Scan the markup
+ *
+ * \param data          Data
+ * \param size          Size of the data
+ * \param[in,out] position  Position of the '<' character (updated to the end of the markup)
+ *
+ * \return Markup type
+ */
+Markup scanMarkup(const char *data, const size_t size, size_t *position)
+{
+    const size_t start = *position;
+    Markup markup = Markup_Incomplete;
+    size_t end = 0U;
+
+    if ((start + 1U) < size)
+    {
+        switch (data[start + 1U])
+        {
+            case '?':
+            {
+                // Processing instruction or XML declaration
+                end = findSequenceEnd(data, size, start + 2U, "?>");
+                markup = Markup_Skipped;
+                break;
+            }
+
+            case '!':
+            {
+                const int comment = compareSequence(data, size, start, "<!--");
+                const int cData = compareSequence(data, size, start, "<![CDATA[");
+
+                if (comment == 1)
+                {
+                    end = findSequenceEnd(data, size, start + 4U, "-->");
+                }
+                else if (cData == 1)
+                {
+                    end = findSequenceEnd(data, size, start + 9U, "]]>");
+                }
+                else if ((comment == 0) && (cData == 0))
+                {
+                    // Document type declaration
+                    end = findMarkupEnd(data, size, start + 2U);
+                }
+                else
+                {
+                    // More data is needed to recognize the markup
+                }
+
+                markup = Markup_Skipped;
+                break;
+            }
+
+            case '/':
+            {
+                end = findMarkupEnd(data, size, start + 2U);
+                markup = Markup_EndTag;
+                break;
+            }
+
+            default:
+            {
+                end = findMarkupEnd(data, size, start + 1U);
+
+                if ((end >= 2U) && (data[end - 2U] == '/'))
+                {
+                    markup = Markup_EmptyElementTag;
+                }
+                else
+                {
+                    markup = Markup_StartTag;
+                }
+                break;
+            }
+        }
+    }
+
+    if (end == 0U)
+    {
+        markup = Markup_Incomplete;
+    }
+    else
+    {
+        *position = end;
+    }
+
+    return markup;
+}
+}
+
+/**
+ * Constructor
+ */
+DocumentScanner::DocumentScanner()
+    : m_documents(),
+      m_scannedSize(0U)
+{
+}
+
+/**
+ * Clear the scanner
+ */
+void DocumentScanner::clear()
+{
+    m_documents.clear();
+    m_scannedSize = 0U;
+}
+
+/**
+ * Scan the data for the documents
+ *
+ * \param data  UTF-8 encoded XML documents
+ * \param size  Size of the data
+ *
+ * \retval true     Success
+ * \retval false    Error, end tag without an open element (documents before it were found)
+ *
+ * Only the complete documents are added to the scanner. Data after the end of the last complete
+ * document (see scannedSize()) contains the start of the next document, which can be scanned again
+ * together with more data.
+ */
+bool DocumentScanner::scan(const char *data, const size_t size)
+{
+    clear();
+
+    bool success = (data != NULL) || (size == 0U);
+    size_t position = 0U;
+    size_t depth = 0U;
+    bool finished = !success;
+
+    while (!finished)
+    {
+        const void *next = NULL;
+
+        if (position < size)
+        {
+            next = memchr(&data[position], '<', size - position);
+        }
+
+        if (next == NULL)
+        {
+            // Rest of the data is text or whitespace
+            finished = true;
+        }
+        else
+        {
+            position = static_cast<size_t>(static_cast<const char *>(next) - data);
+            bool endOfDocument = false;
+
+            switch (scanMarkup(data, size, &position))
+            {
+                case Markup_StartTag:
+                {
+                    depth++;
+                    break;
+                }
+
+                case Markup_EmptyElementTag:
+                {
+                    endOfDocument = (depth == 0U);
+                    break;
+                }
+
+                case Markup_EndTag:
+                {
+                    if (depth == 0U)
+                    {
+                        // Error, end tag without an open element
+                        success = false;
+                        finished = true;
+                    }
+                    else
+                    {
+                        depth--;
+                        endOfDocument = (depth == 0U);
+                    }
+                    break;
+                }
+
+                case Markup_Skipped:
+                {
+                    break;
+                }
+
+                default:
+                {
+                    // More data is needed
+                    finished = true;
+                    break;
+                }
+            }
+
+            if (endOfDocument)
+            {
+                // Whitespace between the documents is not a part of the next document
+                size_t start = m_scannedSize;
+
+                while ((data[start] == ' ') || (data[start] == '\t') ||
+                       (data[start] == '\r') || (data[start] == '\n'))
+                {
+                    start++;
+                }
+
+                const Extent extent = { start, position - start };
+                m_documents.push_back(extent);
+                m_scannedSize = position;
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Get number of complete documents
+ *
+ * \return Number of documents
+ */
+size_t DocumentScanner::documentCount() const
+{
+    return m_documents.size();
+}
+
+/**
+ * Get extent of a document
+ *
+ * \param index Index of the document
+ *
+ * \return Extent of the document
+ * \retval NULL Invalid index
+ */
+const DocumentScanner::Extent *DocumentScanner::document(const size_t index) const
+{
+    const Extent *extent = NULL;
+
+    if (index < m_documents.size())
+    {
+        extent = &m_documents[index];
+    }
+
+    return extent;
+}
+
+/**
+ * Get size of the scanned data
+ *
+ * \return Position right after the end of the last complete document
+ */
+size_t DocumentScanner::scannedSize() const
+{
+    return m_scannedSize;
+}
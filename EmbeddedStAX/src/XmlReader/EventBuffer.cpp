@@ -0,0 +1,299 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/EventBuffer.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ *
+ * \param capacity  Maximum number of events in the buffer
+ */
+EventBuffer::EventBuffer(const size_t capacity)
+    : m_capacity(0U),
+      m_events(),
+      m_attributes(),
+      m_stringPool(),
+      m_symbolTable(),
+      m_xmlDeclaration()
+{
+    setCapacity(capacity);
+}
+
+/**
+ * Get capacity
+ *
+ * \return Maximum number of events in the buffer
+ */
+size_t EventBuffer::capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * Set capacity
+ *
+ * \param capacity  Maximum number of events in the buffer (at least 1)
+ */
+void EventBuffer::setCapacity(const size_t capacity)
+{
+    m_capacity = (capacity > 0U) ? capacity : 1U;
+    m_events.reserve(m_capacity);
+}
+
+/**
+ * Clear all of the events
+ *
+ * \note Symbol table is not cleared so symbol IDs stay the same for all of the batches
+ */
+void EventBuffer::clear()
+{
+    m_events.clear();
+    m_attributes.clear();
+    m_stringPool.clear();
+    m_xmlDeclaration.clear();
+}
+
+/**
+ * Clear all of the events and the symbol table
+ */
+void EventBuffer::clearSymbolTable()
+{
+    clear();
+    m_symbolTable.clear();
+}
+
+/**
+ * Get number of events in the buffer
+ *
+ * \return Number of events
+ */
+size_t EventBuffer::size() const
+{
+    return m_events.size();
+}
+
+/**
+ * Check if buffer is empty
+ *
+ * \retval true     Empty
+ * \retval false    Not empty
+ */
+bool EventBuffer::isEmpty() const
+{
+    return m_events.empty();
+}
+
+/**
+ * Check if buffer is full
+ *
+ * \retval true     Full
+ * \retval false    Not full
+ */
+bool EventBuffer::isFull() const
+{
+    return (m_events.size() >= m_capacity);
+}
+
+/**
+ * Get event
+ *
+ * \param index Event index
+ *
+ * \return Event or NULL if index is out of range
+ */
+const EventBuffer::Event *EventBuffer::event(const size_t index) const
+{
+    const Event *event = NULL;
+
+    if (index < m_events.size())
+    {
+        event = &m_events[index];
+    }
+
+    return event;
+}
+
+/**
+ * Get attribute of a "start of element" event
+ *
+ * \param event Event
+ * \param index Attribute index
+ *
+ * \return Attribute or NULL if index is out of range
+ */
+const EventBuffer::AttributeRecord *EventBuffer::attribute(const Event &event,
+                                                           const size_t index) const
+{
+    const AttributeRecord *attribute = NULL;
+
+    if (index < event.attributeCount)
+    {
+        const size_t position = event.firstAttribute + index;
+
+        if (position < m_attributes.size())
+        {
+            attribute = &m_attributes[position];
+        }
+    }
+
+    return attribute;
+}
+
+/**
+ * Get name of the event (element name, PI target or document type name)
+ *
+ * \param event Event
+ *
+ * \return Name (empty string for events without a name)
+ */
+const EmbeddedStAX::Common::UnicodeString &EventBuffer::name(const Event &event) const
+{
+    return m_symbolTable.symbol(event.symbol);
+}
+
+/**
+ * Get attribute name
+ *
+ * \param attribute Attribute
+ *
+ * \return Attribute name
+ */
+const EmbeddedStAX::Common::UnicodeString &EventBuffer::name(
+        const AttributeRecord &attribute) const
+{
+    return m_symbolTable.symbol(attribute.symbol);
+}
+
+/**
+ * Get text of the event (text node, CDATA, comment text or PI data)
+ *
+ * \param event Event
+ *
+ * \return Text
+ */
+EmbeddedStAX::Common::UnicodeString EventBuffer::text(const Event &event) const
+{
+    return Common::UnicodeString(m_stringPool, event.textPosition, event.textSize);
+}
+
+/**
+ * Get attribute value
+ *
+ * \param attribute Attribute
+ *
+ * \return Attribute value
+ */
+EmbeddedStAX::Common::UnicodeString EventBuffer::value(const AttributeRecord &attribute) const
+{
+    return Common::UnicodeString(m_stringPool, attribute.valuePosition, attribute.valueSize);
+}
+
+/**
+ * Get XML declaration
+ *
+ * \return XML declaration (valid only if there is a "XML declaration" event in the buffer)
+ */
+const EmbeddedStAX::Common::XmlDeclaration &EventBuffer::xmlDeclaration() const
+{
+    return m_xmlDeclaration;
+}
+
+/**
+ * Get string pool
+ *
+ * \return String pool with all of the text and attribute values of the events in the buffer
+ */
+const EmbeddedStAX::Common::UnicodeString &EventBuffer::stringPool() const
+{
+    return m_stringPool;
+}
+
+/**
+ * Get symbol table
+ *
+ * \return Symbol table with all of the names
+ */
+const EmbeddedStAX::Common::SymbolTable &EventBuffer::symbolTable() const
+{
+    return m_symbolTable;
+}
+
+/**
+ * Add event
+ *
+ * \param type  Parsing result
+ * \param name  Element name, PI target or document type name (empty string for no name)
+ * \param text  Text or PI data (empty string for no text)
+ */
+void EventBuffer::addEvent(const XmlReader::ParsingResult type,
+                           const Common::UnicodeString &name,
+                           const Common::UnicodeString &text)
+{
+    Event event;
+    event.type = type;
+    event.symbol = name.empty() ? Common::SymbolTable::InvalidSymbol : m_symbolTable.add(name);
+    event.textPosition = m_stringPool.size();
+    event.textSize = text.size();
+    event.firstAttribute = m_attributes.size();
+    event.attributeCount = 0U;
+
+    m_stringPool.append(text);
+    m_events.push_back(event);
+}
+
+/**
+ * Add attribute to the last event
+ *
+ * \param attribute Attribute
+ */
+void EventBuffer::addAttribute(const Common::Attribute &attribute)
+{
+    if (!m_events.empty())
+    {
+        AttributeRecord attributeRecord;
+        attributeRecord.symbol = m_symbolTable.add(attribute.name());
+        attributeRecord.valuePosition = m_stringPool.size();
+        attributeRecord.valueSize = attribute.value().size();
+        attributeRecord.quotationMark = attribute.valueQuotationMark();
+
+        m_stringPool.append(attribute.value());
+        m_attributes.push_back(attributeRecord);
+        m_events.back().attributeCount++;
+    }
+}
+
+/**
+ * Set XML declaration
+ *
+ * \param xmlDeclaration    XML declaration
+ */
+void EventBuffer::setXmlDeclaration(const Common::XmlDeclaration &xmlDeclaration)
+{
+    m_xmlDeclaration = xmlDeclaration;
+}
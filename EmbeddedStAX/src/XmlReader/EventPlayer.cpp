@@ -0,0 +1,360 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/EventPlayer.h>
+#include <EmbeddedStAX/XmlReader/EventRecorder.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ */
+EventPlayer::EventPlayer()
+    : m_reader(),
+      m_lastParsingResult(XmlReader::ParsingResult_None),
+      m_names(),
+      m_xmlDeclaration(),
+      m_processingInstruction(),
+      m_documentType(),
+      m_text(),
+      m_name(),
+      m_value(),
+      m_attributeList()
+{
+}
+
+/**
+ * Clear internal state
+ */
+void EventPlayer::clear()
+{
+    m_reader = Common::BinaryReader();
+    m_lastParsingResult = XmlReader::ParsingResult_None;
+    m_names.clear();
+    m_xmlDeclaration.clear();
+    m_processingInstruction.clear();
+    m_documentType.clear();
+    m_text.clear();
+    m_name.clear();
+    m_value.clear();
+    m_attributeList.clear();
+}
+
+/**
+ * Open recording
+ *
+ * \param data  Recording (see EventRecorder::data())
+ * \param size  Size of the recording
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid header or unsupported format version
+ */
+bool EventPlayer::open(const char *data, const size_t size)
+{
+    bool success = false;
+    clear();
+
+    if (data != NULL)
+    {
+        uint32_t version = 0U;
+        m_reader = Common::BinaryReader(data, size);
+
+        if (m_reader.readData("ESX", 3U) && m_reader.readByte(&version))
+        {
+            success = (version == EventRecorder::FormatVersion);
+        }
+    }
+
+    if (!success)
+    {
+        m_lastParsingResult = XmlReader::ParsingResult_Error;
+    }
+
+    return success;
+}
+
+/**
+ * Replay the next event
+ *
+ * \retval ParsingResult_NeedMoreData   End of the recording
+ * \retval ParsingResult_Error          Error, invalid recording
+ * \return Parsing result of the recorded event
+ */
+XmlReader::ParsingResult EventPlayer::parse()
+{
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_Error;
+
+    if (m_lastParsingResult != XmlReader::ParsingResult_Error)
+    {
+        if (!m_reader.isEndOfData())
+        {
+            result = readEvent();
+        }
+        else
+        {
+            // End of the recording
+            result = XmlReader::ParsingResult_NeedMoreData;
+        }
+    }
+
+    m_lastParsingResult = result;
+    return result;
+}
+
+/**
+ * Get last parsing result
+ *
+ * \return Last parsing result
+ */
+XmlReader::ParsingResult EventPlayer::lastParsingResult() const
+{
+    return m_lastParsingResult;
+}
+
+/**
+ * Get XML declaration
+ *
+ * \return XML declaration
+ */
+const EmbeddedStAX::Common::XmlDeclaration &EventPlayer::xmlDeclaration() const
+{
+    return m_xmlDeclaration;
+}
+
+/**
+ * Get processing instruction
+ *
+ * \return Processing instruction (valid for ParsingResult_ProcessingInstruction)
+ */
+const EmbeddedStAX::Common::ProcessingInstruction &EventPlayer::processingInstruction() const
+{
+    return m_processingInstruction;
+}
+
+/**
+ * Get document type
+ *
+ * \return Document type
+ */
+const EmbeddedStAX::Common::DocumentType &EventPlayer::documentType() const
+{
+    return m_documentType;
+}
+
+/**
+ * Get text
+ *
+ * \return Text of a comment, text node, CDATA or text chunk
+ */
+const EmbeddedStAX::Common::UnicodeString &EventPlayer::text() const
+{
+    return m_text;
+}
+
+/**
+ * Get element name
+ *
+ * \return Element name (valid for start of element and end of element)
+ */
+const EmbeddedStAX::Common::UnicodeString &EventPlayer::name() const
+{
+    return m_name;
+}
+
+/**
+ * Get attribute list
+ *
+ * \return Attribute list (valid for start of element)
+ */
+const EmbeddedStAX::Common::AttributeList &EventPlayer::attributeList() const
+{
+    return m_attributeList;
+}
+
+/**
+ * Read event
+ *
+ * \retval ParsingResult_Error  Error, invalid recording
+ * \return Parsing result of the recorded event
+ */
+XmlReader::ParsingResult EventPlayer::readEvent()
+{
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_Error;
+    uint32_t type = 0U;
+    bool success = m_reader.readByte(&type);
+
+    if (m_lastParsingResult == XmlReader::ParsingResult_StartOfElement)
+    {
+        m_attributeList.clear();
+    }
+
+    if (success)
+    {
+        switch (type)
+        {
+            case XmlReader::ParsingResult_XmlDeclaration:
+            {
+                uint32_t version = 0U;
+                uint32_t encoding = 0U;
+                uint32_t standalone = 0U;
+                success = m_reader.readByte(&version) &&
+                          m_reader.readByte(&encoding) &&
+                          m_reader.readByte(&standalone);
+
+                if (success)
+                {
+                    m_xmlDeclaration.setVersion(
+                                static_cast<Common::XmlDeclaration::Version>(version));
+                    m_xmlDeclaration.setEncoding(
+                                static_cast<Common::XmlDeclaration::Encoding>(encoding));
+                    m_xmlDeclaration.setStandalone(
+                                static_cast<Common::XmlDeclaration::Standalone>(standalone));
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_ProcessingInstruction:
+            {
+                success = readName(&m_name) && m_reader.readString(&m_text);
+
+                if (success)
+                {
+                    m_processingInstruction.setPiTarget(m_name);
+                    m_processingInstruction.setPiData(m_text);
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_DocumentType:
+            {
+                success = readName(&m_name);
+
+                if (success)
+                {
+                    m_documentType.setName(m_name);
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_Comment:
+            case XmlReader::ParsingResult_TextNode:
+            case XmlReader::ParsingResult_CData:
+            case XmlReader::ParsingResult_TextChunk:
+            {
+                success = m_reader.readString(&m_text);
+                break;
+            }
+
+            case XmlReader::ParsingResult_StartOfElement:
+            {
+                size_t attributeCount = 0U;
+                success = readName(&m_name) && m_reader.readNumber(&attributeCount);
+
+                for (size_t i = 0U; success && (i < attributeCount); i++)
+                {
+                    Common::Attribute attribute;
+                    uint32_t quotationMark = 0U;
+                    success = readName(&m_value) &&
+                              m_reader.readByte(&quotationMark) &&
+                              m_reader.readString(&m_text);
+
+                    if (success)
+                    {
+                        attribute.setName(m_value);
+                        attribute.setValue(m_text,
+                                           static_cast<Common::QuotationMark>(quotationMark));
+                        m_attributeList.add(attribute);
+                    }
+                }
+
+                m_text.clear();
+                break;
+            }
+
+            case XmlReader::ParsingResult_EndOfElement:
+            {
+                success = readName(&m_name);
+                break;
+            }
+
+            case XmlReader::ParsingResult_EndOfDocument:
+            {
+                // No data
+                break;
+            }
+
+            default:
+            {
+                // Error, invalid event
+                success = false;
+                break;
+            }
+        }
+    }
+
+    if (success)
+    {
+        result = static_cast<XmlReader::ParsingResult>(type);
+    }
+
+    return result;
+}
+
+/**
+ * Read name from the name dictionary
+ *
+ * \param[out] name Output for the name
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid name index or invalid name
+ */
+bool EventPlayer::readName(Common::UnicodeString *name)
+{
+    size_t index = 0U;
+    bool success = m_reader.readNumber(&index);
+
+    if (success)
+    {
+        if (index == m_names.size())
+        {
+            // New name
+            m_names.push_back(Common::UnicodeString());
+            success = m_reader.readString(&m_names.back());
+        }
+        else
+        {
+            success = (index < m_names.size());
+        }
+    }
+
+    if (success)
+    {
+        *name = m_names[index];
+    }
+
+    return success;
+}
@@ -0,0 +1,357 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/EventRecorder.h>
+#include <EmbeddedStAX/XmlReader/StaticXmlHandler.h>
+#include <EmbeddedStAX/Common/BinaryStream.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Version of the recording format
+ */
+const uint8_t EventRecorder::FormatVersion = 1U;
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Builder writes the parsing results of the reader to the recording
+ */
+class EventRecorder::Builder : public StaticXmlHandler
+{
+public:
+    // Public API
+    /**
+     * Constructor
+     *
+     * \param recorder  Recording that the parsing results are written to
+     */
+    explicit Builder(EventRecorder *recorder)
+        : m_recorder(recorder)
+    {
+    }
+
+    /**
+     * Record XML declaration
+     *
+     * \param xmlDeclaration  XML declaration
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onXmlDeclaration(const Common::XmlDeclaration &xmlDeclaration)
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_XmlDeclaration);
+        m_recorder->writeByte(static_cast<uint32_t>(xmlDeclaration.version()));
+        m_recorder->writeByte(static_cast<uint32_t>(xmlDeclaration.encoding()));
+        m_recorder->writeByte(static_cast<uint32_t>(xmlDeclaration.standalone()));
+        return true;
+    }
+
+    /**
+     * Record processing instruction
+     *
+     * \param processingInstruction   Processing instruction
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onProcessingInstruction(const Common::ProcessingInstruction &processingInstruction)
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_ProcessingInstruction);
+        m_recorder->writeName(processingInstruction.piTarget());
+        m_recorder->writeString(processingInstruction.piData());
+        return true;
+    }
+
+    /**
+     * Record document type
+     *
+     * \param documentType    Document type
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onDocumentType(const Common::DocumentType &documentType)
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_DocumentType);
+        m_recorder->writeName(documentType.name());
+        return true;
+    }
+
+    /**
+     * Record comment
+     *
+     * \param text    Comment text
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onComment(const Common::UnicodeString &text)
+    {
+        writeText(XmlReader::ParsingResult_Comment, text);
+        return true;
+    }
+
+    /**
+     * Record start of element
+     *
+     * \param name            Element name
+     * \param attributeList   Attribute list (attribute values are recorded decoded)
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onStartOfElement(const Common::UnicodeString &name,
+                          const Common::AttributeList &attributeList)
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_StartOfElement);
+        m_recorder->writeName(name);
+        m_recorder->writeNumber(attributeList.size());
+
+        for (Common::AttributeList::ConstIterator it = attributeList.begin();
+             it != attributeList.end();
+             ++it)
+        {
+            m_recorder->writeName(it->name());
+            m_recorder->writeByte(static_cast<uint32_t>(it->valueQuotationMark()));
+            m_recorder->writeString(it->value());
+        }
+
+        return true;
+    }
+
+    /**
+     * Record end of element
+     *
+     * \param name    Element name
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onEndOfElement(const Common::UnicodeString &name)
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_EndOfElement);
+        m_recorder->writeName(name);
+        return true;
+    }
+
+    /**
+     * Record text node
+     *
+     * \param text    Text
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onTextNode(const Common::UnicodeString &text)
+    {
+        writeText(XmlReader::ParsingResult_TextNode, text);
+        return true;
+    }
+
+    /**
+     * Record CDATA section
+     *
+     * \param text    CDATA text
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onCData(const Common::UnicodeString &text)
+    {
+        writeText(XmlReader::ParsingResult_CData, text);
+        return true;
+    }
+
+    /**
+     * Record chunk of a text node
+     *
+     * \param text    Text chunk
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onTextChunk(const Common::UnicodeString &text)
+    {
+        writeText(XmlReader::ParsingResult_TextChunk, text);
+        return true;
+    }
+
+    /**
+     * Record end of document
+     *
+     * \retval true     Event was recorded (parsing continues)
+     */
+    bool onEndOfDocument()
+    {
+        m_recorder->writeEvent(XmlReader::ParsingResult_EndOfDocument);
+        return true;
+    }
+
+private:
+    // Private API
+    /**
+     * Write an event with a text
+     *
+     * \param type    Event type
+     * \param text    Text
+     */
+    void writeText(const XmlReader::ParsingResult type, const Common::UnicodeString &text)
+    {
+        m_recorder->writeEvent(type);
+        m_recorder->writeString(text);
+    }
+
+private:
+    // Private data
+    EventRecorder *m_recorder;
+};
+}
+}
+
+/**
+ * Constructor
+ */
+EventRecorder::EventRecorder()
+    : m_data(),
+      m_nameTable(),
+      m_eventCount(0U)
+{
+    clear();
+}
+
+/**
+ * Clear the recording
+ *
+ * \note Name dictionary is cleared too, so the recording can be replayed on its own.
+ */
+void EventRecorder::clear()
+{
+    m_data.clear();
+    m_nameTable.clear();
+    m_eventCount = 0U;
+
+    // Header
+    m_data.append("ESX");
+    writeByte(FormatVersion);
+}
+
+/**
+ * Parse all of the buffered data and record the parsing results
+ *
+ * \param xmlReader XML reader with the data of the document
+ *
+ * \retval ParsingResult_NeedMoreData   All of the buffered data was parsed and recorded
+ * \retval ParsingResult_Error          Error
+ */
+XmlReader::ParsingResult EventRecorder::record(XmlReader *xmlReader)
+{
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_Error;
+
+    if (xmlReader != NULL)
+    {
+        Builder builder(this);
+        result = xmlReader->parse(builder);
+    }
+
+    return result;
+}
+
+/**
+ * Get number of recorded events
+ *
+ * \return Number of recorded events
+ */
+size_t EventRecorder::eventCount() const
+{
+    return m_eventCount;
+}
+
+/**
+ * Get recording
+ *
+ * \return Recorded data (see EventPlayer)
+ */
+const std::string &EventRecorder::data() const
+{
+    return m_data;
+}
+
+/**
+ * Write the start of an event
+ *
+ * \param type  Parsing result
+ */
+void EventRecorder::writeEvent(const XmlReader::ParsingResult type)
+{
+    writeByte(static_cast<uint32_t>(type));
+    m_eventCount++;
+}
+
+/**
+ * Write byte
+ *
+ * \param value Value (from 0 to 255)
+ */
+void EventRecorder::writeByte(const uint32_t value)
+{
+    Common::BinaryWriter(&m_data).writeByte(value);
+}
+
+/**
+ * Write number as a variable length integer
+ *
+ * \param value Value
+ */
+void EventRecorder::writeNumber(const size_t value)
+{
+    Common::BinaryWriter(&m_data).writeNumber(value);
+}
+
+/**
+ * Write string as its UTF-8 size and UTF-8 data
+ *
+ * \param value String
+ */
+void EventRecorder::writeString(const Common::UnicodeString &value)
+{
+    Common::BinaryWriter(&m_data).writeString(value);
+}
+
+/**
+ * Write name as its index in the name dictionary
+ *
+ * \param name  Name
+ *
+ * A name that is not yet in the dictionary is written after its index.
+ */
+void EventRecorder::writeName(const Common::UnicodeString &name)
+{
+    const size_t nameCount = m_nameTable.size();
+    const uint32_t index = m_nameTable.add(name);
+    writeNumber(index);
+
+    if (index == nameCount)
+    {
+        // New name
+        writeString(name);
+    }
+}
@@ -0,0 +1,470 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/NamespaceResolver.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Namespace ID of the names that are not in any namespace (empty URI)
+ */
+const uint32_t NamespaceResolver::NoNamespace = 0U;
+
+/**
+ * Namespace ID of the "xml" prefix (http://www.w3.org/XML/1998/namespace)
+ */
+const uint32_t NamespaceResolver::XmlNamespace = 1U;
+
+/**
+ * Namespace ID of the namespace declaration attributes (http://www.w3.org/2000/xmlns/)
+ */
+const uint32_t NamespaceResolver::XmlnsNamespace = 2U;
+
+namespace
+{
+/**
+ * Prefix ID of the default namespace (empty prefix)
+ */
+const uint32_t defaultPrefixId = 0U;
+
+/**
+ * Prefix ID of the "xml" prefix
+ */
+const uint32_t xmlPrefixId = 1U;
+
+/**
+ * Prefix ID of the "xmlns" prefix
+ */
+const uint32_t xmlnsPrefixId = 2U;
+}
+
+/**
+ * Constructor
+ *
+ * \param baseResolver  Base resolver (NULL for none)
+ *
+ * \note Base resolver is only read so it can be shared by many resolvers (also from different
+ *       threads), but it must not be modified or destroyed while it is used by this resolver
+ */
+NamespaceResolver::NamespaceResolver(const NamespaceResolver *baseResolver)
+    : m_namespaceTable(),
+      m_prefixTable(),
+      m_localNameTable(),
+      m_bindings(),
+      m_savedBindings(),
+      m_scopes(),
+      m_prefix(),
+      m_localName()
+{
+    if (baseResolver != NULL)
+    {
+        // Predefined namespaces and prefixes are already in the base tables
+        m_namespaceTable.setBaseTable(&baseResolver->m_namespaceTable);
+        m_prefixTable.setBaseTable(&baseResolver->m_prefixTable);
+        m_localNameTable.setBaseTable(&baseResolver->m_localNameTable);
+    }
+    else
+    {
+        // Predefined namespaces and prefixes (IDs match the constants)
+        m_namespaceTable.add(Common::UnicodeString());
+        m_namespaceTable.add(
+                Common::Utf8::toUnicodeString("http://www.w3.org/XML/1998/namespace"));
+        m_namespaceTable.add(Common::Utf8::toUnicodeString("http://www.w3.org/2000/xmlns/"));
+
+        m_prefixTable.add(Common::UnicodeString());
+        m_prefixTable.add(Common::Utf8::toUnicodeString("xml"));
+        m_prefixTable.add(Common::Utf8::toUnicodeString("xmlns"));
+    }
+
+    reset();
+}
+
+/**
+ * End all of the scopes and restore the predefined namespace bindings
+ */
+void NamespaceResolver::reset()
+{
+    m_bindings.assign(m_prefixTable.size(), Common::SymbolTable::InvalidSymbol);
+    m_bindings[defaultPrefixId] = NoNamespace;
+    m_bindings[xmlPrefixId] = XmlNamespace;
+    m_bindings[xmlnsPrefixId] = XmlnsNamespace;
+    m_savedBindings.clear();
+    m_scopes.clear();
+}
+
+/**
+ * Add namespace
+ *
+ * \param uri   Namespace URI
+ *
+ * \return Namespace ID
+ */
+uint32_t NamespaceResolver::addNamespace(const Common::UnicodeString &uri)
+{
+    return m_namespaceTable.add(uri);
+}
+
+/**
+ * Find namespace
+ *
+ * \param uri   Namespace URI
+ *
+ * \return Namespace ID or Common::SymbolTable::InvalidSymbol if the namespace is not known
+ */
+uint32_t NamespaceResolver::findNamespace(const Common::UnicodeString &uri) const
+{
+    return m_namespaceTable.find(uri);
+}
+
+/**
+ * Get namespace URI
+ *
+ * \param namespaceId   Namespace ID
+ *
+ * \return Namespace URI or an empty string if namespace ID is not valid
+ */
+const EmbeddedStAX::Common::UnicodeString &NamespaceResolver::namespaceUri(
+        const uint32_t namespaceId) const
+{
+    return m_namespaceTable.symbol(namespaceId);
+}
+
+/**
+ * Add local name
+ *
+ * \param localName Local name
+ *
+ * \return Local name ID
+ */
+uint32_t NamespaceResolver::addLocalName(const Common::UnicodeString &localName)
+{
+    return m_localNameTable.add(localName);
+}
+
+/**
+ * Find local name
+ *
+ * \param localName Local name
+ *
+ * \return Local name ID or Common::SymbolTable::InvalidSymbol if the local name is not known
+ */
+uint32_t NamespaceResolver::findLocalName(const Common::UnicodeString &localName) const
+{
+    return m_localNameTable.find(localName);
+}
+
+/**
+ * Get local name
+ *
+ * \param localNameId   Local name ID
+ *
+ * \return Local name or an empty string if local name ID is not valid
+ */
+const EmbeddedStAX::Common::UnicodeString &NamespaceResolver::localName(
+        const uint32_t localNameId) const
+{
+    return m_localNameTable.symbol(localNameId);
+}
+
+/**
+ * Get number of the open scopes
+ *
+ * \return Number of the open scopes
+ */
+size_t NamespaceResolver::scopeDepth() const
+{
+    return m_scopes.size();
+}
+
+/**
+ * Start a new scope (start of an element)
+ */
+void NamespaceResolver::startScope()
+{
+    m_scopes.push_back(m_savedBindings.size());
+}
+
+/**
+ * Declare a namespace in the current scope
+ *
+ * \param prefix    Prefix (empty for the default namespace)
+ * \param uri       Namespace URI (empty URI undeclares the default namespace)
+ *
+ * \retval true     Success
+ * \retval false    Error, no scope or invalid declaration
+ */
+bool NamespaceResolver::declare(const Common::UnicodeString &prefix,
+                                const Common::UnicodeString &uri)
+{
+    bool success = !m_scopes.empty();
+    uint32_t prefixId = Common::SymbolTable::InvalidSymbol;
+    uint32_t namespaceId = NoNamespace;
+
+    if (success)
+    {
+        prefixId = m_prefixTable.add(prefix);
+
+        if (!uri.empty())
+        {
+            namespaceId = m_namespaceTable.add(uri);
+        }
+
+        if (prefixId >= m_bindings.size())
+        {
+            m_bindings.resize(prefixId + 1U, Common::SymbolTable::InvalidSymbol);
+        }
+
+        if (prefixId == xmlPrefixId)
+        {
+            // Prefix "xml" can only be (re)declared with its own namespace
+            success = (namespaceId == XmlNamespace);
+        }
+        else if (prefixId == xmlnsPrefixId)
+        {
+            // Error, prefix "xmlns" must not be declared
+            success = false;
+        }
+        else if ((namespaceId == XmlNamespace) || (namespaceId == XmlnsNamespace))
+        {
+            // Error, predefined namespaces must not be bound to other prefixes
+            success = false;
+        }
+        else if ((prefixId != defaultPrefixId) && (namespaceId == NoNamespace))
+        {
+            // Error, only the default namespace can be undeclared
+            success = false;
+        }
+        else
+        {
+            // Valid declaration
+        }
+    }
+
+    if (success)
+    {
+        SavedBinding savedBinding;
+        savedBinding.prefixId = prefixId;
+        savedBinding.namespaceId = m_bindings[prefixId];
+        m_savedBindings.push_back(savedBinding);
+        m_bindings[prefixId] = namespaceId;
+    }
+
+    return success;
+}
+
+/**
+ * End the current scope (end of an element) and restore the bindings that were overridden in it
+ */
+void NamespaceResolver::endScope()
+{
+    if (!m_scopes.empty())
+    {
+        const size_t scopeStart = m_scopes.back();
+        m_scopes.pop_back();
+
+        while (m_savedBindings.size() > scopeStart)
+        {
+            const SavedBinding &savedBinding = m_savedBindings.back();
+            m_bindings[savedBinding.prefixId] = savedBinding.namespaceId;
+            m_savedBindings.pop_back();
+        }
+    }
+}
+
+/**
+ * Get number of namespace declarations in a scope
+ *
+ * \param scope Scope index (0 is the outermost scope)
+ *
+ * \return Number of namespace declarations in the scope
+ */
+size_t NamespaceResolver::declarationCount(const size_t scope) const
+{
+    size_t count = 0U;
+
+    if (scope < m_scopes.size())
+    {
+        const size_t scopeEnd =
+                ((scope + 1U) < m_scopes.size()) ? m_scopes[scope + 1U] : m_savedBindings.size();
+        count = scopeEnd - m_scopes[scope];
+    }
+
+    return count;
+}
+
+/**
+ * Get namespace declaration
+ *
+ * \param      scope   Scope index (0 is the outermost scope)
+ * \param      index   Declaration index in the scope
+ * \param[out] prefix  Output for the declared prefix (empty for the default namespace)
+ * \param[out] uri     Output for the declared namespace URI
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid scope or declaration index
+ *
+ * Declarations can be used to rebuild the scopes in another resolver (see XmlReader checkpoints).
+ */
+bool NamespaceResolver::declaration(const size_t scope,
+                                    const size_t index,
+                                    Common::UnicodeString *prefix,
+                                    Common::UnicodeString *uri) const
+{
+    bool success = false;
+
+    if (index < declarationCount(scope))
+    {
+        const size_t position = m_scopes[scope] + index;
+        const uint32_t prefixId = m_savedBindings[position].prefixId;
+        uint32_t namespaceId = m_bindings[prefixId];
+
+        // Declared namespace was saved by the next declaration of the same prefix (if any)
+        for (size_t i = position + 1U; i < m_savedBindings.size(); i++)
+        {
+            if (m_savedBindings[i].prefixId == prefixId)
+            {
+                namespaceId = m_savedBindings[i].namespaceId;
+                break;
+            }
+        }
+
+        *prefix = m_prefixTable.symbol(prefixId);
+        *uri = m_namespaceTable.symbol(namespaceId);
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Resolve element name
+ *
+ * \param      name            Element name (with an optional prefix)
+ * \param[out] expandedName    Output for the expanded name
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid name or prefix is not declared
+ *
+ * Element names without a prefix are in the default namespace.
+ */
+bool NamespaceResolver::resolveElementName(const Common::UnicodeString &name,
+                                           ExpandedName *expandedName)
+{
+    bool success = resolveName(name, true, expandedName);
+
+    if (success)
+    {
+        // Elements must not have the prefix "xmlns"
+        success = (expandedName->namespaceId != XmlnsNamespace);
+    }
+
+    return success;
+}
+
+/**
+ * Resolve attribute name
+ *
+ * \param      name            Attribute name (with an optional prefix)
+ * \param[out] expandedName    Output for the expanded name
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid name or prefix is not declared
+ *
+ * Attribute names without a prefix are not in any namespace, except for the "xmlns" attribute
+ * which is in the XmlnsNamespace.
+ */
+bool NamespaceResolver::resolveAttributeName(const Common::UnicodeString &name,
+                                             ExpandedName *expandedName)
+{
+    bool success = resolveName(name, false, expandedName);
+
+    if (success && (expandedName->namespaceId == NoNamespace))
+    {
+        if (name == m_prefixTable.symbol(xmlnsPrefixId))
+        {
+            expandedName->namespaceId = XmlnsNamespace;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Resolve name
+ *
+ * \param      name                Name (with an optional prefix)
+ * \param      useDefaultNamespace Name without a prefix is in the default namespace
+ * \param[out] expandedName        Output for the expanded name
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid name or prefix is not declared
+ */
+bool NamespaceResolver::resolveName(const Common::UnicodeString &name,
+                                    const bool useDefaultNamespace,
+                                    ExpandedName *expandedName)
+{
+    bool success = false;
+
+    if (expandedName != NULL)
+    {
+        const size_t colonPosition = name.find(static_cast<uint32_t>(':'));
+
+        if (colonPosition == Common::UnicodeString::npos)
+        {
+            // Name without a prefix
+            expandedName->namespaceId =
+                    useDefaultNamespace ? m_bindings[defaultPrefixId] : NoNamespace;
+            expandedName->localNameId = m_localNameTable.add(name);
+            success = true;
+        }
+        else
+        {
+            // Prefixed name, the scratch strings keep their capacity between the calls
+            m_prefix.assign(name, 0U, colonPosition);
+            m_localName.assign(name, colonPosition + 1U, Common::UnicodeString::npos);
+
+            if ((!m_prefix.empty()) &&
+                (!m_localName.empty()) &&
+                (m_localName.find(static_cast<uint32_t>(':')) == Common::UnicodeString::npos))
+            {
+                const uint32_t prefixId = m_prefixTable.find(m_prefix);
+
+                if (prefixId < m_bindings.size())
+                {
+                    if (m_bindings[prefixId] != Common::SymbolTable::InvalidSymbol)
+                    {
+                        expandedName->namespaceId = m_bindings[prefixId];
+                        expandedName->localNameId = m_localNameTable.add(m_localName);
+                        success = true;
+                    }
+                }
+            }
+        }
+    }
+
+    return success;
+}
@@ -0,0 +1,110 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/ParserContext.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ */
+ParserContext::ParserContext()
+    : m_attributeKeyTable(),
+      m_pathSelector(),
+      m_namespaceResolver()
+{
+}
+
+/**
+ * Register an attribute key
+ *
+ * \param name  Attribute name
+ *
+ * \return Attribute key (it is valid in all of the readers that reference the context)
+ *
+ * \see XmlReader::registerAttributeKey()
+ */
+uint32_t ParserContext::registerAttributeKey(const Common::UnicodeString &name)
+{
+    return m_attributeKeyTable.add(name);
+}
+
+/**
+ * Get attribute key table
+ *
+ * \return Table of the registered attribute keys
+ */
+const EmbeddedStAX::Common::SymbolTable &ParserContext::attributeKeyTable() const
+{
+    return m_attributeKeyTable;
+}
+
+/**
+ * Add selected path
+ *
+ * \param path  Element path (see PathSelector)
+ *
+ * \retval true     Path was added
+ * \retval false    Error, invalid path
+ *
+ * \see XmlReader::addSelectedPath()
+ */
+bool ParserContext::addSelectedPath(const Common::UnicodeString &path)
+{
+    return m_pathSelector.addPath(path);
+}
+
+/**
+ * Get path selector
+ *
+ * \return Path selector with the selected paths
+ */
+const PathSelector &ParserContext::pathSelector() const
+{
+    return m_pathSelector;
+}
+
+/**
+ * Get namespace resolver
+ *
+ * \return Namespace resolver (can be used to intern the namespaces and local names of the known
+ *         schemas)
+ */
+NamespaceResolver &ParserContext::namespaceResolver()
+{
+    return m_namespaceResolver;
+}
+
+/**
+ * Get namespace resolver
+ *
+ * \return Namespace resolver
+ */
+const NamespaceResolver &ParserContext::namespaceResolver() const
+{
+    return m_namespaceResolver;
+}
@@ -198,6 +198,26 @@ EmbeddedStAX::Common::UnicodeString ParsingBuffer::substring(const size_t positi
     return data;
 }
 
+/**
+ * Append substring from the buffer to the output string
+ *
+ * \param      position    Start position
+ * \param      size        Number of characters
+ * \param[out] output      Output string
+ *
+ * \note Characters are copied directly into the output string (with the output string's allocator)
+ *       without creating a temporary string.
+ */
+void ParsingBuffer::appendSubstring(const size_t position,
+                                    const size_t size,
+                                    Common::UnicodeString *output) const
+{
+    if ((output != NULL) && (position < m_buffer.size()))
+    {
+        output->append(m_buffer, position, size);
+    }
+}
+
 /**
  * Write data to buffer
  *
@@ -233,3 +253,13 @@ size_t ParsingBuffer::writeData(const std::string &data)
 
     return charactersWritten;
 }
+
+/**
+ * Get size of the incomplete unicode character at the end of the written data
+ *
+ * \return Number of bytes of the incomplete unicode character
+ */
+size_t ParsingBuffer::incompleteSize() const
+{
+    return m_utf8.incompleteSize();
+}
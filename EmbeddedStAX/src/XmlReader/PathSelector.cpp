@@ -0,0 +1,318 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/PathSelector.h>
+#include <EmbeddedStAX/XmlValidator/Name.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ */
+PathSelector::PathSelector()
+    : m_baseSelector(NULL),
+      m_pathList()
+{
+}
+
+/**
+ * Remove all of the paths (paths of the base selector are kept)
+ */
+void PathSelector::clear()
+{
+    m_pathList.clear();
+}
+
+/**
+ * Get number of paths
+ *
+ * \return Number of paths (including the paths of the base selector)
+ */
+size_t PathSelector::size() const
+{
+    size_t pathCount = m_pathList.size();
+
+    if (m_baseSelector != NULL)
+    {
+        pathCount += m_baseSelector->size();
+    }
+
+    return pathCount;
+}
+
+/**
+ * Check if there are no paths
+ *
+ * \retval true     No paths
+ * \retval false    At least one path
+ */
+bool PathSelector::isEmpty() const
+{
+    return (size() == 0U);
+}
+
+/**
+ * Get base selector
+ *
+ * \return Base selector or NULL if the selector is not layered on top of a base selector
+ */
+const PathSelector *PathSelector::baseSelector() const
+{
+    return m_baseSelector;
+}
+
+/**
+ * Set base selector
+ *
+ * \param baseSelector  Base selector (NULL for none)
+ *
+ * \note The selector is cleared
+ * \note Base selector is only read so it can be shared by many selectors (also from different
+ *       threads), but it must not be modified or destroyed while it is used by this selector
+ */
+void PathSelector::setBaseSelector(const PathSelector *baseSelector)
+{
+    clear();
+    m_baseSelector = baseSelector;
+}
+
+/**
+ * Add a path
+ *
+ * \param path  Path (for example "/envelope/body/order/item" or "//price")
+ *
+ * \retval true     Path was added
+ * \retval false    Error, invalid path
+ */
+bool PathSelector::addPath(const Common::UnicodeString &path)
+{
+    Path newPath;
+    bool success = !path.empty();
+    size_t position = 0U;
+
+    while (success && (position < path.size()))
+    {
+        Step step;
+        step.descendant = false;
+
+        // Read step separator ("/" or "//")
+        if (path.at(position) != static_cast<uint32_t>('/'))
+        {
+            // Error, path must be absolute
+            success = false;
+            break;
+        }
+
+        position++;
+
+        if (position < path.size())
+        {
+            if (path.at(position) == static_cast<uint32_t>('/'))
+            {
+                step.descendant = true;
+                position++;
+            }
+        }
+
+        // Read element name
+        const size_t nameEnd = path.find(static_cast<uint32_t>('/'), position);
+        const size_t nameSize =
+                (nameEnd == Common::UnicodeString::npos) ? (path.size() - position)
+                                                         : (nameEnd - position);
+        step.name = path.substr(position, nameSize);
+        position += nameSize;
+
+        if (step.name == Common::Utf8::toUnicodeString("*"))
+        {
+            // Any element matches the step
+            step.name.clear();
+        }
+        else if (!XmlValidator::validateName(step.name))
+        {
+            // Error, invalid element name
+            success = false;
+            break;
+        }
+        else
+        {
+            // Valid element name
+        }
+
+        newPath.push_back(step);
+    }
+
+    if (success)
+    {
+        m_pathList.push_back(newPath);
+    }
+
+    return success;
+}
+
+/**
+ * Match the current element against the paths
+ *
+ * \param openElementList   List of the open elements (root element first)
+ * \param emptyElementName  Name of the current empty element (it is not in the list of the open
+ *                          elements) or NULL if the current element is the last open element
+ *
+ * \retval Match_Selected   Current element is selected by at least one of the paths
+ * \retval Match_Ancestor   Current element is not selected, but its descendants can be
+ * \retval Match_None       Neither the current element nor its descendants can be selected
+ */
+PathSelector::Match PathSelector::match(const ElementNameList &openElementList,
+                                        const Common::UnicodeString *emptyElementName) const
+{
+    Match result = Match_None;
+
+    if (m_baseSelector != NULL)
+    {
+        result = m_baseSelector->match(openElementList, emptyElementName);
+    }
+
+    for (std::vector<Path>::const_iterator it = m_pathList.begin();
+         (result != Match_Selected) && (it != m_pathList.end());
+         it++)
+    {
+        const Match pathMatch = matchPath(*it, openElementList, emptyElementName);
+
+        if (pathMatch == Match_Selected)
+        {
+            result = Match_Selected;
+            break;
+        }
+
+        if (pathMatch == Match_Ancestor)
+        {
+            result = Match_Ancestor;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Match the current element against a path
+ *
+ * \param path              Path
+ * \param openElementList   List of the open elements (root element first)
+ * \param emptyElementName  Name of the current empty element or NULL
+ *
+ * \return Match result
+ *
+ * The path is executed as a nondeterministic state machine where state N means that the first N
+ * steps of the path were matched.
+ */
+PathSelector::Match PathSelector::matchPath(const Path &path,
+                                            const ElementNameList &openElementList,
+                                            const Common::UnicodeString *emptyElementName)
+{
+    Match result = Match_None;
+    std::vector<bool> stateList(path.size() + 1U, false);
+    std::vector<bool> nextStateList(path.size() + 1U, false);
+    bool active = true;
+    stateList[0U] = true;
+
+    for (ElementNameList::const_iterator it = openElementList.begin();
+         it != openElementList.end();
+         it++)
+    {
+        active = executeStep(path, *it, stateList, &nextStateList);
+        stateList.swap(nextStateList);
+
+        if (!active)
+        {
+            break;
+        }
+    }
+
+    if (active && (emptyElementName != NULL))
+    {
+        active = executeStep(path, *emptyElementName, stateList, &nextStateList);
+        stateList.swap(nextStateList);
+    }
+
+    if (active)
+    {
+        if (stateList[path.size()])
+        {
+            result = Match_Selected;
+        }
+        else
+        {
+            result = Match_Ancestor;
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Execute one step of the path state machine
+ *
+ * \param path          Path
+ * \param name          Element name
+ * \param stateList     Current states
+ * \param nextStateList Output for the next states
+ *
+ * \retval true     At least one of the next states (other than the final state) is active
+ * \retval false    Path can not be matched anymore
+ *
+ * \note Final state is not carried forward because descendants of a selected element are already
+ *       part of the selected subtree.
+ */
+bool PathSelector::executeStep(const Path &path,
+                               const Common::UnicodeString &name,
+                               const std::vector<bool> &stateList,
+                               std::vector<bool> *nextStateList)
+{
+    bool active = false;
+    nextStateList->assign(stateList.size(), false);
+
+    for (size_t i = 0U; i < path.size(); i++)
+    {
+        if (stateList[i])
+        {
+            const Step &step = path[i];
+
+            if (step.descendant)
+            {
+                // Step can skip any number of elements
+                (*nextStateList)[i] = true;
+                active = true;
+            }
+
+            if (step.name.empty() || (step.name == name))
+            {
+                (*nextStateList)[i + 1U] = true;
+                active = true;
+            }
+        }
+    }
+
+    return active;
+}
@@ -0,0 +1,254 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/StructuralIndex.h>
+#include <string.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+/**
+ * Word with all bytes set to 0x01
+ */
+const uint64_t lowBits = 0x0101010101010101ULL;
+
+/**
+ * Word with all bytes set to 0x80
+ */
+const uint64_t highBits = 0x8080808080808080ULL;
+
+/**
+ * Find bytes with the selected value in a word
+ *
+ * \param word      Word
+ * \param character Byte value
+ *
+ * \return Word where the highest bit is set in all of the bytes that match the byte value
+ *
+ * \note A byte that follows a matching byte can also be marked as matching so the result has to be
+ *       checked byte by byte.
+ */
+inline uint64_t findByte(const uint64_t word, const char character)
+{
+    const uint64_t value = word ^ (lowBits * static_cast<unsigned char>(character));
+    return (value - lowBits) & ~value & highBits;
+}
+}
+
+/**
+ * Constructor
+ */
+StructuralIndex::StructuralIndex()
+    : m_positions()
+{
+}
+
+/**
+ * Clear the index
+ */
+void StructuralIndex::clear()
+{
+    m_positions.clear();
+}
+
+/**
+ * Build the index
+ *
+ * \param data  UTF-8 encoded XML document
+ * \param size  Size of the XML document
+ */
+void StructuralIndex::build(const char *data, const size_t size)
+{
+    m_positions.clear();
+
+    if (data != NULL)
+    {
+        m_positions.reserve(size / 16U);
+        append(data, 0U, size);
+    }
+}
+
+/**
+ * Append a range of the document to the index
+ *
+ * \param data          UTF-8 encoded XML document
+ * \param startPosition Start of the range
+ * \param endPosition   End of the range
+ *
+ * Range is scanned a word (8 bytes) at a time and only the words with at least one structural
+ * character candidate are checked byte by byte. This makes the scan of long text and attribute
+ * values a lot faster than a byte by byte scan.
+ *
+ * \note Positions in the index are relative to the start of the document so the ranges have to be
+ *       appended in order and they must not overlap.
+ */
+void StructuralIndex::append(const char *data, const size_t startPosition, const size_t endPosition)
+{
+    if (data != NULL)
+    {
+        size_t position = startPosition;
+
+        // Scan the range a word at a time
+        while ((position + sizeof(uint64_t)) <= endPosition)
+        {
+            uint64_t word = 0U;
+            memcpy(&word, &data[position], sizeof(uint64_t));
+
+            if (findCandidates(word) != 0U)
+            {
+                for (size_t i = 0U; i < sizeof(uint64_t); i++)
+                {
+                    if (isStructuralChar(data[position + i]))
+                    {
+                        m_positions.push_back(position + i);
+                    }
+                }
+            }
+
+            position += sizeof(uint64_t);
+        }
+
+        // Scan the rest of the range
+        for (; position < endPosition; position++)
+        {
+            if (isStructuralChar(data[position]))
+            {
+                m_positions.push_back(position);
+            }
+        }
+    }
+}
+
+/**
+ * Append a range of another index to the index
+ *
+ * \param index         Index of the same document
+ * \param startPosition Start of the range
+ * \param endPosition   End of the range
+ *
+ * This can be used to join indexes of parts of the document that were built separately.
+ */
+void StructuralIndex::append(const StructuralIndex &index,
+                             const size_t startPosition,
+                             const size_t endPosition)
+{
+    for (size_t i = 0U; i < index.m_positions.size(); i++)
+    {
+        const size_t position = index.m_positions[i];
+
+        if ((position >= startPosition) && (position < endPosition))
+        {
+            m_positions.push_back(position);
+        }
+    }
+}
+
+/**
+ * Get number of structural characters in the index
+ *
+ * \return Number of structural characters
+ */
+size_t StructuralIndex::size() const
+{
+    return m_positions.size();
+}
+
+/**
+ * Get position of a structural character
+ *
+ * \param index Index of the structural character
+ *
+ * \return Position of the structural character in the document or the maximum size_t value if
+ *         index is out of range
+ */
+size_t StructuralIndex::position(const size_t index) const
+{
+    size_t position = static_cast<size_t>(-1);
+
+    if (index < m_positions.size())
+    {
+        position = m_positions[index];
+    }
+
+    return position;
+}
+
+/**
+ * Check if character is a structural character
+ *
+ * \param character Character
+ *
+ * \retval true     Structural character
+ * \retval false    Not a structural character
+ */
+bool StructuralIndex::isStructuralChar(const char character)
+{
+    bool structuralChar = false;
+
+    switch (character)
+    {
+        case '<':
+        case '>':
+        case '&':
+        case '"':
+        case '\'':
+        case '/':
+        case '?':
+        case '!':
+        {
+            structuralChar = true;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return structuralChar;
+}
+
+/**
+ * Find structural character candidates in a word
+ *
+ * \param word  Word
+ *
+ * \return Non-zero value if there is at least one candidate in the word
+ */
+uint64_t StructuralIndex::findCandidates(const uint64_t word)
+{
+    return findByte(word, '<') |
+           findByte(word, '>') |
+           findByte(word, '&') |
+           findByte(word, '"') |
+           findByte(word, '\'') |
+           findByte(word, '/') |
+           findByte(word, '?') |
+           findByte(word, '!');
+}
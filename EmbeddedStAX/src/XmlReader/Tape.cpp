@@ -0,0 +1,1231 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/Tape.h>
+#include <string.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+/**
+ * Size of the block that is added to the structural index of a segment when a token continues
+ * past the end of the segment
+ */
+const size_t indexExtensionSize = 4096U;
+}
+
+/**
+ * Constructor
+ */
+Tape::Tape()
+    : m_data(NULL),
+      m_size(0U),
+      m_index(0U),
+      m_errorPosition(0U),
+      m_rootFound(false),
+      m_segment(false),
+      m_segmentValid(false),
+      m_segmentStart(0U),
+      m_segmentEnd(0U),
+      m_segmentStop(0U),
+      m_indexEnd(0U),
+      m_structuralIndex(),
+      m_entries(),
+      m_attributes(),
+      m_openElements(),
+      m_xmlDeclaration()
+{
+}
+
+/**
+ * Clear the tape
+ */
+void Tape::clear()
+{
+    m_data = NULL;
+    m_size = 0U;
+    m_index = 0U;
+    m_errorPosition = 0U;
+    m_rootFound = false;
+    m_segment = false;
+    m_segmentValid = false;
+    m_segmentStart = 0U;
+    m_segmentEnd = 0U;
+    m_segmentStop = 0U;
+    m_indexEnd = 0U;
+    m_structuralIndex.clear();
+    m_entries.clear();
+    m_attributes.clear();
+    m_openElements.clear();
+    m_xmlDeclaration.clear();
+}
+
+/**
+ * Build the tape
+ *
+ * \param data  UTF-8 encoded XML document
+ * \param size  Size of the XML document
+ *
+ * \retval true     Success
+ * \retval false    Error (see errorPosition(), entries before the error are on the tape)
+ */
+bool Tape::build(const char *data, const size_t size)
+{
+    clear();
+
+    bool success = false;
+
+    if (data != NULL)
+    {
+        m_data = data;
+        m_size = size;
+        success = true;
+
+        // First pass: find all of the structural characters
+        m_structuralIndex.build(data, size);
+        m_indexEnd = size;
+
+        // Second pass: build the tape from the structural index
+        success = readRange(0U, size);
+
+        if (success && ((!m_rootFound) || (!m_openElements.empty())))
+        {
+            // Error, document is not complete
+            m_errorPosition = m_size;
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Build a segment of the document
+ *
+ * \param data          UTF-8 encoded XML document
+ * \param size          Size of the XML document
+ * \param startPosition Start of the segment
+ * \param endPosition   End of the segment
+ *
+ * \retval true     Success
+ * \retval false    Error (see errorPosition(), entries before the error are on the tape)
+ *
+ * Segment is built speculatively without the context of the document before it: it holds all of
+ * the tokens that start inside of the segment (the last one can continue past the end) and the
+ * checks that depend on the context (nesting of the elements, root element, document type and
+ * whitespace outside of the root element) are left to merge().
+ *
+ * \note Start of a segment (except the first one) should be a '<' character. If it is inside of a
+ *       token of the previous segment (for example in a comment, CDATA section or attribute value)
+ *       then the segment is rebuilt by merge().
+ */
+bool Tape::buildSegment(const char *data,
+                        const size_t size,
+                        const size_t startPosition,
+                        const size_t endPosition)
+{
+    clear();
+
+    bool success = false;
+
+    if ((data != NULL) && (startPosition <= endPosition) && (endPosition <= size))
+    {
+        m_data = data;
+        m_size = size;
+        m_segment = true;
+
+        // Index of the segment is extended only when a token continues past the end of it
+        m_structuralIndex.append(data, startPosition, endPosition);
+        m_indexEnd = endPosition;
+
+        success = readRange(startPosition, endPosition);
+        m_segmentValid = success;
+    }
+
+    return success;
+}
+
+/**
+ * Merge segments into the tape
+ *
+ * \param segments      Segments built with buildSegment(), in the order of the document
+ * \param segmentCount  Number of segments
+ *
+ * \retval true     Success
+ * \retval false    Error (see errorPosition(), entries before the error are on the tape)
+ *
+ * Segments have to cover the whole document without gaps. Entries of the segments are checked in
+ * the context of the whole document. A segment that was started inside of the last token of the
+ * previous segment is rebuilt from the end of that token, or skipped if the token covers all of
+ * it. Result is the same as with build().
+ */
+bool Tape::merge(const Tape *segments, const size_t segmentCount)
+{
+    clear();
+
+    bool success = false;
+
+    if ((segments != NULL) && (segmentCount > 0U) && (segments[0].m_data != NULL))
+    {
+        m_data = segments[0].m_data;
+        m_size = segments[0].m_size;
+        m_indexEnd = m_size;
+        success = true;
+
+        size_t position = 0U;
+
+        for (size_t i = 0U; success && (i < segmentCount); i++)
+        {
+            const Tape &segment = segments[i];
+
+            if ((!segment.m_segment) ||
+                (segment.m_data != m_data) ||
+                (segment.m_segmentStart > position))
+            {
+                // Error, invalid segment
+                m_errorPosition = position;
+                success = false;
+            }
+            else if (position >= segment.m_segmentEnd)
+            {
+                // Segment is covered by the last token of the previous segment
+            }
+            else if (segment.m_segmentStart == position)
+            {
+                success = appendSegment(segment);
+                position = segment.m_segmentStop;
+            }
+            else
+            {
+                // Segment was started inside of a token, rebuild it from the end of the token
+                Tape fixedSegment;
+                fixedSegment.buildSegment(m_data, m_size, position, segment.m_segmentEnd);
+
+                success = appendSegment(fixedSegment);
+                position = fixedSegment.m_segmentStop;
+            }
+        }
+
+        if (success && (position < m_size))
+        {
+            // Error, segments do not cover the whole document
+            m_errorPosition = position;
+            success = false;
+        }
+
+        if (success && ((!m_rootFound) || (!m_openElements.empty())))
+        {
+            // Error, document is not complete
+            m_errorPosition = m_size;
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Get error position
+ *
+ * \return Position in the document where the error was found
+ */
+size_t Tape::errorPosition() const
+{
+    return m_errorPosition;
+}
+
+/**
+ * Get number of entries on the tape
+ *
+ * \return Number of entries
+ */
+size_t Tape::size() const
+{
+    return m_entries.size();
+}
+
+/**
+ * Get entry
+ *
+ * \param index Entry index
+ *
+ * \return Entry or NULL if index is out of range
+ */
+const Tape::Entry *Tape::entry(const size_t index) const
+{
+    const Entry *entry = NULL;
+
+    if (index < m_entries.size())
+    {
+        entry = &m_entries[index];
+    }
+
+    return entry;
+}
+
+/**
+ * Get attribute of a "start of element" entry
+ *
+ * \param entry Entry
+ * \param index Attribute index
+ *
+ * \return Attribute or NULL if index is out of range
+ */
+const Tape::AttributeEntry *Tape::attribute(const Entry &entry, const size_t index) const
+{
+    const AttributeEntry *attribute = NULL;
+
+    if (index < entry.attributeCount)
+    {
+        const size_t position = entry.firstAttribute + index;
+
+        if (position < m_attributes.size())
+        {
+            attribute = &m_attributes[position];
+        }
+    }
+
+    return attribute;
+}
+
+/**
+ * Get name of the entry (element name, PI target or document type name)
+ *
+ * \param entry Entry
+ *
+ * \return Name
+ */
+EmbeddedStAX::Common::UnicodeString Tape::name(const Entry &entry) const
+{
+    return decode(entry.namePosition, entry.nameSize, false);
+}
+
+/**
+ * Get text of the entry (text node, CDATA, comment text or PI data)
+ *
+ * \param entry Entry
+ *
+ * \return Text (references are decoded only in text nodes)
+ */
+EmbeddedStAX::Common::UnicodeString Tape::text(const Entry &entry) const
+{
+    return decode(entry.textPosition, entry.textSize, entry.textHasReferences);
+}
+
+/**
+ * Get attribute name
+ *
+ * \param attribute Attribute
+ *
+ * \return Attribute name
+ */
+EmbeddedStAX::Common::UnicodeString Tape::name(const AttributeEntry &attribute) const
+{
+    return decode(attribute.namePosition, attribute.nameSize, false);
+}
+
+/**
+ * Get attribute value
+ *
+ * \param attribute Attribute
+ *
+ * \return Attribute value (with decoded references)
+ */
+EmbeddedStAX::Common::UnicodeString Tape::value(const AttributeEntry &attribute) const
+{
+    return decode(attribute.valuePosition, attribute.valueSize, attribute.valueHasReferences);
+}
+
+/**
+ * Get XML declaration
+ *
+ * \return XML declaration
+ */
+const EmbeddedStAX::Common::XmlDeclaration &Tape::xmlDeclaration() const
+{
+    return m_xmlDeclaration;
+}
+
+/**
+ * Get structural index
+ *
+ * \return Structural index of the document
+ */
+const StructuralIndex &Tape::structuralIndex() const
+{
+    return m_structuralIndex;
+}
+
+/**
+ * Read a range of the document
+ *
+ * \param startPosition Start of the range
+ * \param endPosition   End of the range
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * All of the tokens that start inside of the range are read, position after the last token is
+ * stored as the stop position of the segment.
+ */
+bool Tape::readRange(const size_t startPosition, const size_t endPosition)
+{
+    bool success = true;
+    size_t textPosition = startPosition;
+
+    m_segmentStart = startPosition;
+    m_segmentEnd = endPosition;
+
+    while (success && (textPosition < endPosition))
+    {
+        bool hasReferences = false;
+        const size_t markupPosition = findStructuralChar(textPosition, '<', &hasReferences);
+
+        // Character data
+        if (markupPosition > textPosition)
+        {
+            if ((!m_openElements.empty()) || m_segment)
+            {
+                // Nesting of a segment is not known so its text is checked by merge()
+                addEntry(XmlReader::ParsingResult_TextNode,
+                         0U,
+                         0U,
+                         textPosition,
+                         markupPosition - textPosition,
+                         hasReferences);
+            }
+            else if (!isWhitespace(textPosition, markupPosition))
+            {
+                // Error, only whitespace is allowed outside of the root element
+                m_errorPosition = textPosition;
+                success = false;
+            }
+            else
+            {
+                // Whitespace outside of the root element is ignored
+            }
+        }
+
+        // Markup
+        if (success && (markupPosition < endPosition))
+        {
+            success = readMarkup(markupPosition, &textPosition);
+        }
+        else
+        {
+            textPosition = markupPosition;
+        }
+    }
+
+    m_segmentStop = textPosition;
+    return success;
+}
+
+/**
+ * Append entries of a segment to the tape
+ *
+ * \param segment   Segment
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * Entries are checked in the context of the tape (same checks as in build()).
+ */
+bool Tape::appendSegment(const Tape &segment)
+{
+    bool success = true;
+    const size_t firstAttribute = m_attributes.size();
+
+    m_attributes.insert(m_attributes.end(),
+                        segment.m_attributes.begin(),
+                        segment.m_attributes.end());
+
+    for (size_t i = 0U; success && (i < segment.m_entries.size()); i++)
+    {
+        Entry entry = segment.m_entries[i];
+        bool addToTape = true;
+
+        switch (entry.type)
+        {
+            case XmlReader::ParsingResult_XmlDeclaration:
+            {
+                m_xmlDeclaration = segment.m_xmlDeclaration;
+                break;
+            }
+
+            case XmlReader::ParsingResult_DocumentType:
+            {
+                // Document type is allowed only once and before the root element
+                bool documentTypeFound = m_rootFound;
+
+                for (size_t j = 0U; (!documentTypeFound) && (j < m_entries.size()); j++)
+                {
+                    documentTypeFound =
+                        (m_entries[j].type == XmlReader::ParsingResult_DocumentType);
+                }
+
+                if (documentTypeFound)
+                {
+                    size_t position = entry.namePosition;
+
+                    while (isWhitespace(m_data[position - 1U]))
+                    {
+                        position--;
+                    }
+
+                    m_errorPosition = position - 9U;
+                    success = false;
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_StartOfElement:
+            {
+                // Only one root element is allowed
+                if (m_rootFound && m_openElements.empty())
+                {
+                    m_errorPosition = entry.namePosition - 1U;
+                    success = false;
+                }
+                else
+                {
+                    m_rootFound = true;
+                    m_openElements.push_back(m_entries.size());
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_EndOfElement:
+            {
+                // End of element must match the currently open element
+                bool match = false;
+
+                if (!m_openElements.empty())
+                {
+                    const Entry &openElement = m_entries[m_openElements.back()];
+
+                    match = (openElement.nameSize == entry.nameSize) &&
+                            (memcmp(&m_data[openElement.namePosition],
+                                    &m_data[entry.namePosition],
+                                    entry.nameSize) == 0);
+                }
+
+                if (match)
+                {
+                    m_openElements.pop_back();
+                }
+                else
+                {
+                    m_errorPosition = entry.namePosition - 2U;
+                    success = false;
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_TextNode:
+            {
+                if (m_openElements.empty())
+                {
+                    // Only whitespace is allowed outside of the root element and it is ignored
+                    addToTape = false;
+
+                    if (!isWhitespace(entry.textPosition, entry.textPosition + entry.textSize))
+                    {
+                        m_errorPosition = entry.textPosition;
+                        success = false;
+                    }
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_CData:
+            {
+                // CDATA section is allowed only inside of the root element
+                if (m_openElements.empty())
+                {
+                    m_errorPosition = entry.textPosition - 9U;
+                    success = false;
+                }
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+
+        if (success && addToTape)
+        {
+            entry.firstAttribute += firstAttribute;
+            m_entries.push_back(entry);
+        }
+    }
+
+    // Index of the segment does not always cover the end of its last token
+    const size_t indexEnd = (segment.m_indexEnd < segment.m_segmentStop) ? segment.m_indexEnd :
+                                                                           segment.m_segmentStop;
+
+    m_structuralIndex.append(segment.m_structuralIndex, segment.m_segmentStart, indexEnd);
+    m_structuralIndex.append(m_data, indexEnd, segment.m_segmentStop);
+
+    if (success && (!segment.m_segmentValid))
+    {
+        m_errorPosition = segment.m_errorPosition;
+        success = false;
+    }
+
+    return success;
+}
+
+/**
+ * Read markup
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool Tape::readMarkup(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+
+    if (compare(position, "<?"))
+    {
+        success = readProcessingInstruction(position, endPosition);
+    }
+    else if (compare(position, "<!--"))
+    {
+        success = readComment(position, endPosition);
+    }
+    else if (compare(position, "<![CDATA["))
+    {
+        success = readCData(position, endPosition);
+    }
+    else if (compare(position, "<!DOCTYPE"))
+    {
+        success = readDocumentType(position, endPosition);
+    }
+    else if (compare(position, "</"))
+    {
+        success = readEndOfElement(position, endPosition);
+    }
+    else if (compare(position, "<!"))
+    {
+        // Error, unsupported markup
+    }
+    else
+    {
+        success = readStartOfElement(position, endPosition);
+    }
+
+    if (!success)
+    {
+        m_errorPosition = position;
+    }
+
+    return success;
+}
+
+/**
+ * Read processing instruction (or XML declaration)
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool Tape::readProcessingInstruction(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t targetPosition = position + 2U;
+    const size_t targetEnd = findNameEnd(targetPosition);
+    const size_t terminator = findTerminator(targetEnd, "?>");
+
+    if ((targetEnd > targetPosition) && (terminator < m_size))
+    {
+        if (((targetEnd - targetPosition) == 3U) && compare(targetPosition, "xml"))
+        {
+            // XML declaration is allowed only at the start of the document
+            if (position == 0U)
+            {
+                m_xmlDeclaration = Common::XmlDeclaration::fromPiData(
+                                       decode(targetEnd, terminator - targetEnd, false));
+
+                if (m_xmlDeclaration.isValid())
+                {
+                    addEntry(XmlReader::ParsingResult_XmlDeclaration, 0U, 0U);
+                    success = true;
+                }
+            }
+        }
+        else
+        {
+            addEntry(XmlReader::ParsingResult_ProcessingInstruction,
+                     targetPosition,
+                     targetEnd - targetPosition,
+                     targetEnd,
+                     terminator - targetEnd);
+            success = true;
+        }
+
+        *endPosition = terminator + 2U;
+    }
+
+    return success;
+}
+
+/**
+ * Read comment
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool Tape::readComment(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t textPosition = position + 4U;
+    const size_t terminator = findTerminator(textPosition, "-->");
+
+    if (terminator < m_size)
+    {
+        addEntry(XmlReader::ParsingResult_Comment,
+                 0U,
+                 0U,
+                 textPosition,
+                 terminator - textPosition);
+        *endPosition = terminator + 3U;
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Read CDATA section
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool Tape::readCData(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t textPosition = position + 9U;
+    const size_t terminator = findTerminator(textPosition, "]]>");
+
+    // CDATA section is allowed only inside of the root element
+    if ((m_segment || (!m_openElements.empty())) && (terminator < m_size))
+    {
+        addEntry(XmlReader::ParsingResult_CData,
+                 0U,
+                 0U,
+                 textPosition,
+                 terminator - textPosition);
+        *endPosition = terminator + 3U;
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Read document type
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * \note Only the root element name is supported (same as in DocumentTypeParser).
+ */
+bool Tape::readDocumentType(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t namePosition = skipWhitespace(position + 9U);
+    const size_t nameEnd = findNameEnd(namePosition);
+    const size_t end = skipWhitespace(nameEnd);
+
+    // Document type is allowed only once and before the root element
+    if ((m_segment || (!m_rootFound)) &&
+        (namePosition > (position + 9U)) &&
+        (nameEnd > namePosition) &&
+        (end < m_size) &&
+        (m_data[end] == '>'))
+    {
+        bool documentTypeFound = false;
+
+        for (size_t i = 0U; i < m_entries.size(); i++)
+        {
+            if (m_entries[i].type == XmlReader::ParsingResult_DocumentType)
+            {
+                documentTypeFound = true;
+                break;
+            }
+        }
+
+        if (m_segment || (!documentTypeFound))
+        {
+            addEntry(XmlReader::ParsingResult_DocumentType, namePosition, nameEnd - namePosition);
+            *endPosition = end + 1U;
+            success = true;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Read start of element (and its attributes)
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * \note For an empty element an additional "end of element" entry is added to the tape.
+ */
+bool Tape::readStartOfElement(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t namePosition = position + 1U;
+    const size_t nameEnd = findNameEnd(namePosition);
+
+    // Only one root element is allowed
+    if ((nameEnd > namePosition) && (m_segment || (!(m_rootFound && m_openElements.empty()))))
+    {
+        const size_t elementEntry = m_entries.size();
+        addEntry(XmlReader::ParsingResult_StartOfElement, namePosition, nameEnd - namePosition);
+        m_rootFound = true;
+
+        size_t cursor = nameEnd;
+        bool finished = false;
+
+        while (!finished)
+        {
+            const size_t itemPosition = skipWhitespace(cursor);
+            finished = true;
+
+            if (itemPosition >= m_size)
+            {
+                // Error, end of document
+            }
+            else if (m_data[itemPosition] == '>')
+            {
+                // End of start of element
+                m_openElements.push_back(elementEntry);
+                *endPosition = itemPosition + 1U;
+                success = true;
+            }
+            else if (compare(itemPosition, "/>"))
+            {
+                // End of empty element
+                addEntry(XmlReader::ParsingResult_EndOfElement,
+                         namePosition,
+                         nameEnd - namePosition);
+                *endPosition = itemPosition + 2U;
+                success = true;
+            }
+            else if (itemPosition > cursor)
+            {
+                // Attribute
+                const size_t attributeNameEnd = findNameEnd(itemPosition);
+                const size_t equalSign = skipWhitespace(attributeNameEnd);
+                const size_t quote = skipWhitespace(equalSign + 1U);
+
+                if ((attributeNameEnd > itemPosition) &&
+                    (equalSign < m_size) &&
+                    (m_data[equalSign] == '=') &&
+                    (quote < m_size) &&
+                    ((m_data[quote] == '"') || (m_data[quote] == '\'')))
+                {
+                    AttributeEntry attribute;
+                    attribute.namePosition = itemPosition;
+                    attribute.nameSize = attributeNameEnd - itemPosition;
+                    attribute.valuePosition = quote + 1U;
+                    attribute.valueHasReferences = false;
+                    attribute.quotationMark = (m_data[quote] == '"') ? Common::QuotationMark_Quote :
+                                                                       Common::QuotationMark_Apostrophe;
+
+                    const size_t valueEnd = findStructuralChar(attribute.valuePosition,
+                                                               m_data[quote],
+                                                               &attribute.valueHasReferences);
+
+                    if (valueEnd < m_size)
+                    {
+                        attribute.valueSize = valueEnd - attribute.valuePosition;
+                        m_attributes.push_back(attribute);
+                        m_entries[elementEntry].attributeCount++;
+
+                        cursor = valueEnd + 1U;
+                        finished = false;
+                    }
+                }
+            }
+            else
+            {
+                // Error, attributes must be separated with whitespace
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Read end of element
+ *
+ * \param      position     Position of the '<' character
+ * \param[out] endPosition  Position after the markup
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool Tape::readEndOfElement(const size_t position, size_t *endPosition)
+{
+    bool success = false;
+    const size_t namePosition = position + 2U;
+    const size_t nameEnd = findNameEnd(namePosition);
+    const size_t nameSize = nameEnd - namePosition;
+    const size_t end = skipWhitespace(nameEnd);
+
+    if (m_segment && m_openElements.empty() && (end < m_size) && (m_data[end] == '>'))
+    {
+        // Element was opened before the segment, it is matched by merge()
+        addEntry(XmlReader::ParsingResult_EndOfElement, namePosition, nameSize);
+        *endPosition = end + 1U;
+        success = true;
+    }
+    else if ((!m_openElements.empty()) && (end < m_size) && (m_data[end] == '>'))
+    {
+        // End of element must match the currently open element
+        const Entry &openElement = m_entries[m_openElements.back()];
+
+        if ((openElement.nameSize == nameSize) &&
+            (memcmp(&m_data[openElement.namePosition], &m_data[namePosition], nameSize) == 0))
+        {
+            m_openElements.pop_back();
+            addEntry(XmlReader::ParsingResult_EndOfElement, namePosition, nameSize);
+            *endPosition = end + 1U;
+            success = true;
+        }
+    }
+    else
+    {
+        // Error, no open element or invalid end of element
+    }
+
+    return success;
+}
+
+/**
+ * Add entry to the tape
+ *
+ * \param type              Parsing result
+ * \param namePosition      Position of the name
+ * \param nameSize          Size of the name
+ * \param textPosition      Position of the text
+ * \param textSize          Size of the text
+ * \param textHasReferences Text contains references
+ */
+void Tape::addEntry(const XmlReader::ParsingResult type,
+                    const size_t namePosition,
+                    const size_t nameSize,
+                    const size_t textPosition,
+                    const size_t textSize,
+                    const bool textHasReferences)
+{
+    Entry entry;
+    entry.type = type;
+    entry.namePosition = namePosition;
+    entry.nameSize = nameSize;
+    entry.textPosition = textPosition;
+    entry.textSize = textSize;
+    entry.textHasReferences = textHasReferences;
+    entry.firstAttribute = m_attributes.size();
+    entry.attributeCount = 0U;
+
+    m_entries.push_back(entry);
+}
+
+/**
+ * Find structural character with the structural index
+ *
+ * \param      startPosition    Position where the search is started
+ * \param      character        Structural character
+ * \param[out] hasReferences    Optional output that is set if a reference is found before the
+ *                              structural character
+ *
+ * \return Position of the structural character or size of the document if it was not found
+ *
+ * \note Search can only move forward in the document.
+ */
+size_t Tape::findStructuralChar(const size_t startPosition,
+                                const char character,
+                                bool *hasReferences)
+{
+    size_t position = m_size;
+    bool finished = false;
+
+    while (!finished)
+    {
+        for (; m_index < m_structuralIndex.size(); m_index++)
+        {
+            const size_t candidate = m_structuralIndex.position(m_index);
+
+            if (candidate >= startPosition)
+            {
+                if (m_data[candidate] == character)
+                {
+                    position = candidate;
+                    finished = true;
+                    break;
+                }
+
+                if ((m_data[candidate] == '&') && (hasReferences != NULL))
+                {
+                    *hasReferences = true;
+                }
+            }
+        }
+
+        if (finished)
+        {
+            // Structural character was found
+        }
+        else if (m_indexEnd < m_size)
+        {
+            // Token continues past the end of the segment, extend the index of the segment
+            const size_t indexEnd = ((m_size - m_indexEnd) > indexExtensionSize) ?
+                                    (m_indexEnd + indexExtensionSize) : m_size;
+
+            m_structuralIndex.append(m_data, m_indexEnd, indexEnd);
+            m_indexEnd = indexEnd;
+        }
+        else
+        {
+            finished = true;
+        }
+    }
+
+    return position;
+}
+
+/**
+ * Find markup terminator (a string that ends with a '>' character) with the structural index
+ *
+ * \param startPosition Position where the search is started
+ * \param terminator    Terminator (for example "-->")
+ *
+ * \return Position of the terminator or size of the document if it was not found
+ */
+size_t Tape::findTerminator(const size_t startPosition, const char *terminator)
+{
+    const size_t terminatorSize = strlen(terminator);
+    size_t position = m_size;
+    size_t searchPosition = startPosition + terminatorSize - 1U;
+    bool finished = false;
+
+    while (!finished)
+    {
+        const size_t end = findStructuralChar(searchPosition, '>');
+
+        if (end >= m_size)
+        {
+            finished = true;
+        }
+        else if (compare(end + 1U - terminatorSize, terminator))
+        {
+            position = end + 1U - terminatorSize;
+            finished = true;
+        }
+        else
+        {
+            searchPosition = end + 1U;
+        }
+    }
+
+    return position;
+}
+
+/**
+ * Find end of a name
+ *
+ * \param position  Position of the first character of the name
+ *
+ * \return Position after the last character of the name
+ */
+size_t Tape::findNameEnd(const size_t position) const
+{
+    size_t end = position;
+
+    while ((end < m_size) &&
+           (!isWhitespace(m_data[end])) &&
+           (m_data[end] != '>') &&
+           (m_data[end] != '/') &&
+           (m_data[end] != '?') &&
+           (m_data[end] != '='))
+    {
+        end++;
+    }
+
+    return end;
+}
+
+/**
+ * Skip whitespace
+ *
+ * \param position  Start position
+ *
+ * \return Position of the first non-whitespace character
+ */
+size_t Tape::skipWhitespace(const size_t position) const
+{
+    size_t end = position;
+
+    while ((end < m_size) && isWhitespace(m_data[end]))
+    {
+        end++;
+    }
+
+    return end;
+}
+
+/**
+ * Compare document data
+ *
+ * \param position  Position in the document
+ * \param value     Compare string
+ *
+ * \retval true     Match
+ * \retval false    No match
+ */
+bool Tape::compare(const size_t position, const char *value) const
+{
+    const size_t valueSize = strlen(value);
+    bool match = false;
+
+    if ((position <= m_size) && (valueSize <= (m_size - position)))
+    {
+        match = (memcmp(&m_data[position], value, valueSize) == 0);
+    }
+
+    return match;
+}
+
+/**
+ * Check if document data contains only whitespace
+ *
+ * \param startPosition Start position
+ * \param endPosition   End position
+ *
+ * \retval true     Only whitespace
+ * \retval false    Not only whitespace
+ */
+bool Tape::isWhitespace(const size_t startPosition, const size_t endPosition) const
+{
+    return (skipWhitespace(startPosition) >= endPosition);
+}
+
+/**
+ * Check if character is a whitespace character
+ *
+ * \param character Character
+ *
+ * \retval true     Whitespace character
+ * \retval false    Not a whitespace character
+ */
+bool Tape::isWhitespace(const char character)
+{
+    return ((character == ' ') ||
+            (character == '\t') ||
+            (character == '\n') ||
+            (character == '\r'));
+}
+
+/**
+ * Decode document data
+ *
+ * \param position      Position in the document
+ * \param size          Size of the data
+ * \param hasReferences Decode references
+ *
+ * \return Decoded string (empty string if UTF-8 data is not valid)
+ */
+EmbeddedStAX::Common::UnicodeString Tape::decode(const size_t position,
+                                                 const size_t size,
+                                                 const bool hasReferences) const
+{
+    Common::UnicodeString value;
+
+    if ((m_data != NULL) && (position <= m_size) && (size <= (m_size - position)))
+    {
+        Common::Utf8 utf8;
+        Common::Utf8::Result result = Common::Utf8::Result_Success;
+        value.reserve(size);
+
+        for (size_t i = 0U; (i < size) && (result != Common::Utf8::Result_Error); i++)
+        {
+            result = utf8.write(m_data[position + i]);
+
+            if (result == Common::Utf8::Result_Success)
+            {
+                value.push_back(utf8.getChar());
+            }
+        }
+
+        if (result != Common::Utf8::Result_Success)
+        {
+            value.clear();
+        }
+        else if (hasReferences)
+        {
+            Common::UnicodeString decodedValue;
+
+            if (Common::decodeReferences(value, &decodedValue))
+            {
+                value.swap(decodedValue);
+            }
+        }
+        else
+        {
+            // No references
+        }
+    }
+
+    return value;
+}
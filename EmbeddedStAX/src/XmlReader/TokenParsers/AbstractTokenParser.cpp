@@ -40,7 +40,8 @@ AbstractTokenParser::AbstractTokenParser(const ParserType parserType)
       m_option(Option_None),
       m_tokenType(TokenType_None),
       m_terminationChar(0U),
-      m_parserType(parserType)
+      m_parserType(parserType),
+      m_allocator()
 {
 }
 
@@ -135,15 +136,36 @@ bool AbstractTokenParser::initialize(ParsingBuffer *parsingBuffer,
 
 /**
  * Deinitialize the parser
+ *
+ * \note Parser that was not initialized since it was last deinitialized is left untouched: its
+ *       data can only change while it is initialized.
  */
 void AbstractTokenParser::deinitialize()
 {
-    deinitializeAdditionalData();
-    m_initialized = false;
-    m_parsingBuffer = NULL;
-    m_option = Option_None;
-    m_tokenType = TokenType_None;
-    m_terminationChar = 0U;
+    if (m_parsingBuffer != NULL)
+    {
+        deinitializeAdditionalData();
+        m_initialized = false;
+        m_parsingBuffer = NULL;
+        m_option = Option_None;
+        m_tokenType = TokenType_None;
+        m_terminationChar = 0U;
+    }
+}
+
+/**
+ * Set arena
+ *
+ * \param arena    Arena that should be used for all of the parser's data (NULL for global allocator)
+ *
+ * \note This will deinitialize the parser and release all of the memory held by it (this is needed
+ *       before the arena can be reset).
+ */
+void AbstractTokenParser::setArena(Common::Arena *arena)
+{
+    deinitialize();
+    m_allocator = Common::UnicodeString::allocator_type(arena);
+    rebindAdditionalData();
 }
 
 /**
@@ -202,3 +224,13 @@ void AbstractTokenParser::setTerminationChar(const uint32_t uchar)
 {
     m_terminationChar = uchar;
 }
+
+/**
+ * Get allocator
+ *
+ * \return Allocator that should be used for all of the parser's data
+ */
+const EmbeddedStAX::Common::UnicodeString::allocator_type &AbstractTokenParser::allocator() const
+{
+    return m_allocator;
+}
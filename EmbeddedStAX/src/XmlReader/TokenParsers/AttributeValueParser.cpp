@@ -39,6 +39,7 @@ AttributeValueParser::AttributeValueParser()
       m_state(State_ReadingQuotationMark),
       m_referenceParser(),
       m_value(),
+      m_valueHasReferences(false),
       m_quotationMark(Common::QuotationMark_None)
 {
 }
@@ -54,12 +55,25 @@ AttributeValueParser::~AttributeValueParser()
  * Get value string
  *
  * \return Value string
+ *
+ * \note References in the value are not decoded (see valueHasReferences()).
  */
-EmbeddedStAX::Common::UnicodeString AttributeValueParser::value() const
+const EmbeddedStAX::Common::UnicodeString &AttributeValueParser::value() const
 {
     return m_value;
 }
 
+/**
+ * Check if the value string contains references
+ *
+ * \retval true    Value contains entity and/or character references
+ * \retval false   Value doesn't contain any references
+ */
+bool AttributeValueParser::valueHasReferences() const
+{
+    return m_valueHasReferences;
+}
+
 /**
  * Parse
  *
@@ -252,6 +266,7 @@ bool AttributeValueParser::initializeAdditionalData()
 {
     m_state = State_ReadingQuotationMark;
     m_value.clear();
+    m_valueHasReferences = false;
     m_quotationMark = Common::QuotationMark_None;
     parsingBuffer()->eraseToCurrentPosition();
     m_referenceParser.deinitialize();
@@ -265,10 +280,20 @@ void AttributeValueParser::deinitializeAdditionalData()
 {
     m_state = State_ReadingQuotationMark;
     m_value.clear();
+    m_valueHasReferences = false;
     m_quotationMark = Common::QuotationMark_None;
     m_referenceParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void AttributeValueParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_value);
+    m_referenceParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading quotation mark
  *
@@ -294,7 +319,7 @@ AttributeValueParser::State AttributeValueParser::executeStateReadingQuotationMa
         if (parsingBuffer()->isMoreDataNeeded())
         {
             // More data is needed
-            nextState = State_ReadingAttributeValue;
+            nextState = State_ReadingQuotationMark;
         }
         else
         {
@@ -322,6 +347,7 @@ AttributeValueParser::State AttributeValueParser::executeStateReadingQuotationMa
                 if (option() == Option_IgnoreLeadingWhitespace)
                 {
                     // Ignore leading whitespace
+                    parsingBuffer()->incrementPosition();
                     finishParsing = false;
                 }
             }
@@ -466,50 +492,21 @@ AttributeValueParser::State AttributeValueParser::executeStateReadingReference()
             {
                 case TokenType_EntityReference:
                 {
-                    // Check the entity reference name
-                    const Common::UnicodeString name = m_referenceParser.value();
-
-                    if (Common::compareUnicodeString(0U, name, std::string("amp")))
-                    {
-                        // Reference to '&' character found, add it to the value
-                        m_value.push_back(static_cast<uint32_t>('&'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("lt")))
-                    {
-                        // Reference to '<' character found, add it to the value
-                        m_value.push_back(static_cast<uint32_t>('<'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("gt")))
-                    {
-                        // Reference to '>' character found, add it to the value
-                        m_value.push_back(static_cast<uint32_t>('>'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("apos")))
-                    {
-                        // Reference to "'" character found, add it to the value
-                        m_value.push_back(static_cast<uint32_t>('\''));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("quot")))
-                    {
-                        // Reference to '"' character found, add it to the value
-                        m_value.push_back(static_cast<uint32_t>('"'));
-                    }
-                    else
-                    {
-                        // Unknown entity reference, add the full entity reference to the value
-                        m_value.push_back(static_cast<uint32_t>('&'));
-                        m_value.append(name);
-                        m_value.push_back(static_cast<uint32_t>(';'));
-                    }
-
+                    // Keep the entity reference, it is decoded only when the value is accessed
+                    m_value.push_back(static_cast<uint32_t>('&'));
+                    m_value.append(m_referenceParser.value());
+                    m_value.push_back(static_cast<uint32_t>(';'));
+                    m_valueHasReferences = true;
                     nextState = State_ReadingAttributeValue;
                     break;
                 }
 
                 case TokenType_CharacterReference:
                 {
-                    // Add the character from the character reference to the value
-                    m_value.append(m_referenceParser.value());
+                    // Keep the character reference (in hexadecimal format), it is decoded only
+                    // when the value is accessed
+                    Common::appendCharacterReference(m_referenceParser.value()[0U], &m_value);
+                    m_valueHasReferences = true;
                     nextState = State_ReadingAttributeValue;
                     break;
                 }
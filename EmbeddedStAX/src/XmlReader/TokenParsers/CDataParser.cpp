@@ -36,7 +36,8 @@ using namespace EmbeddedStAX::XmlReader;
 CDataParser::CDataParser()
     : AbstractTokenParser(ParserType_CData),
       m_state(State_ReadingCData),
-      m_text()
+      m_text(),
+      m_chunkSize(0U)
 {
 }
 
@@ -52,17 +53,60 @@ CDataParser::~CDataParser()
  *
  * \return Text string
  */
-EmbeddedStAX::Common::UnicodeString CDataParser::text() const
+const EmbeddedStAX::Common::UnicodeString &CDataParser::text() const
 {
     return m_text;
 }
 
+/**
+ * Swap text string with the selected one
+ *
+ * \param text Text string that receives the parsed text string
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void CDataParser::swapText(Common::UnicodeString *text)
+{
+    if (text != NULL)
+    {
+        m_text.swap(*text);
+    }
+}
+
+/**
+ * Get chunk size
+ *
+ * \return Chunk size
+ * \retval 0   CDATA text is not split into chunks
+ */
+size_t CDataParser::chunkSize() const
+{
+    return m_chunkSize;
+}
+
+/**
+ * Set chunk size
+ *
+ * \param chunkSize Minimum size of a text chunk (0 disables splitting of the text into chunks)
+ *
+ * When the size of the read text reaches the chunk size a text chunk is made available (parse()
+ * returns Result_TextChunk) and the text string is cleared on the next parse() call.
+ */
+void CDataParser::setChunkSize(const size_t chunkSize)
+{
+    m_chunkSize = chunkSize;
+}
+
 /**
  * Parse
  *
  * \retval Result_Success       Success
  * \retval Result_NeedMoreData  More data is needed
+ * \retval Result_TextChunk     Text chunk was read (see setChunkSize())
  * \retval Result_Error         Error
+ *
+ * \note With Option_SkipValue the CDATA text is only scanned for the end of the CDATA and it is
+ *       not stored.
  */
 AbstractTokenParser::Result CDataParser::parse()
 {
@@ -93,6 +137,12 @@ AbstractTokenParser::Result CDataParser::parse()
                             break;
                         }
 
+                        case State_TextChunkRead:
+                        {
+                            result = Result_TextChunk;
+                            break;
+                        }
+
                         case State_Finished:
                         {
                             result = Result_Success;
@@ -109,6 +159,15 @@ AbstractTokenParser::Result CDataParser::parse()
                     break;
                 }
 
+                case State_TextChunkRead:
+                {
+                    // Start reading the next text chunk
+                    m_text.clear();
+                    nextState = State_ReadingCData;
+                    finishParsing = false;
+                    break;
+                }
+
                 case State_Finished:
                 {
                     result = Result_Success;
@@ -160,10 +219,19 @@ void CDataParser::deinitializeAdditionalData()
     m_text.clear();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void CDataParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_text);
+}
+
 /**
  * Execute state: Reading CDATA
  *
  * \retval State_ReadingCData   Wait for more data
+ * \retval State_TextChunkRead  Text chunk was read
  * \retval State_Finished       CDATA found
  * \retval State_Error          Error, unexpected character
  *
@@ -181,10 +249,29 @@ CDataParser::State CDataParser::executeStateReadingCData()
     while (!finishParsing)
     {
         finishParsing = true;
+        const size_t position = parsingBuffer()->currentPosition();
 
-        // Check if more data is needed
-        if (parsingBuffer()->isMoreDataNeeded())
+        // Check if a text chunk is ready
+        if ((m_chunkSize > 0U) &&
+            (option() != Option_SkipValue) &&
+            (position > 2U) &&
+            ((m_text.size() + position - 2U) >= m_chunkSize))
         {
+            // Add text, the last two characters are kept for detection of the "]]>" sequence
+            parsingBuffer()->appendSubstring(0U, position - 2U, &m_text);
+            parsingBuffer()->erase(position - 2U);
+            parsingBuffer()->setCurrentPosition(2U);
+            nextState = State_TextChunkRead;
+        }
+        else if (parsingBuffer()->isMoreDataNeeded())
+        {
+            if ((option() == Option_SkipValue) && (position > 2U))
+            {
+                // Skipped text is not needed, keep only the characters for the "]]>" sequence
+                parsingBuffer()->erase(position - 2U);
+                parsingBuffer()->setCurrentPosition(2U);
+            }
+
             // More data is needed
             nextState = State_ReadingCData;
         }
@@ -195,22 +282,24 @@ CDataParser::State CDataParser::executeStateReadingCData()
 
             if (uchar == static_cast<uint32_t>('>'))
             {
-                const size_t position = parsingBuffer()->currentPosition();
-
                 if (position < 2U)
                 {
                     // Valid text character, continue
+                    parsingBuffer()->incrementPosition();
                     finishParsing = false;
                 }
                 else
                 {
                     const Common::UnicodeString sequence =
-                            parsingBuffer()->substring(position - 2U, position - 1U);
+                            parsingBuffer()->substring(position - 2U, 2U);
 
                     if (Common::compareUnicodeString(0U, sequence, std::string("]]")))
                     {
                         // End of CDATA found
-                        m_text.append(parsingBuffer()->substring(0U, position - 2U));
+                        if (option() != Option_SkipValue)
+                        {
+                            parsingBuffer()->appendSubstring(0U, position - 2U, &m_text);
+                        }
 
                         parsingBuffer()->incrementPosition();
                         parsingBuffer()->eraseToCurrentPosition();
@@ -52,17 +52,35 @@ CommentParser::~CommentParser()
  *
  * \return Text string
  */
-EmbeddedStAX::Common::UnicodeString CommentParser::text() const
+const EmbeddedStAX::Common::UnicodeString &CommentParser::text() const
 {
     return m_text;
 }
 
+/**
+ * Swap text string with the selected one
+ *
+ * \param text Text string that receives the parsed text string
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void CommentParser::swapText(Common::UnicodeString *text)
+{
+    if (text != NULL)
+    {
+        m_text.swap(*text);
+    }
+}
+
 /**
  * Parse
  *
  * \retval Result_Success       Success
  * \retval Result_NeedMoreData  More data is needed
  * \retval Result_Error         Error
+ *
+ * \note With Option_SkipValue the comment text is only scanned for the end of the comment and it
+ *       is not stored.
  */
 AbstractTokenParser::Result CommentParser::parse()
 {
@@ -160,6 +178,14 @@ void CommentParser::deinitializeAdditionalData()
     m_text.clear();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void CommentParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_text);
+}
+
 /**
  * Execute state: Reading comment
  *
@@ -181,17 +207,24 @@ CommentParser::State CommentParser::executeStateReadingComment()
     {
         finishParsing = true;
 
+        const size_t position = parsingBuffer()->currentPosition();
+
         // Check if more data is needed
         if (parsingBuffer()->isMoreDataNeeded())
         {
+            if ((option() == Option_SkipValue) && (position > 2U))
+            {
+                // Skipped text is not needed, keep only the characters for the "--" sequence
+                parsingBuffer()->erase(position - 2U);
+                parsingBuffer()->setCurrentPosition(2U);
+            }
+
             // More data is needed
             nextState = State_ReadingComment;
         }
         else
         {
             // Check for "-->" sequence
-            const size_t position = parsingBuffer()->currentPosition();
-
             if (position > 1U)
             {
                 const uint32_t minusChar = static_cast<uint32_t>('-');
@@ -203,7 +236,13 @@ CommentParser::State CommentParser::executeStateReadingComment()
                     if (parsingBuffer()->currentChar() == static_cast<uint32_t>('>'))
                     {
                         // End of comment found
-                        m_text = parsingBuffer()->substring(0U, position - 2U);
+                        m_text.clear();
+
+                        if (option() != Option_SkipValue)
+                        {
+                            parsingBuffer()->appendSubstring(0U, position - 2U, &m_text);
+                        }
+
                         parsingBuffer()->incrementPosition();
                         nextState = State_Finished;
                     }
@@ -54,11 +54,26 @@ DocumentTypeParser::~DocumentTypeParser()
  *
  * \return Processing instruction
  */
-EmbeddedStAX::Common::DocumentType DocumentTypeParser::documentType() const
+const EmbeddedStAX::Common::DocumentType &DocumentTypeParser::documentType() const
 {
     return m_documentType;
 }
 
+/**
+ * Swap document type with the selected one
+ *
+ * \param documentType Document type that receives the parsed document type
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void DocumentTypeParser::swapDocumentType(Common::DocumentType *documentType)
+{
+    if (documentType != NULL)
+    {
+        m_documentType.swap(*documentType);
+    }
+}
+
 /**
  * Parse
  *
@@ -195,6 +210,16 @@ void DocumentTypeParser::deinitializeAdditionalData()
     m_nameParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void DocumentTypeParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_piTarget);
+    Common::DocumentType(allocator()).swap(m_documentType);
+    m_nameParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading name of the root element
  *
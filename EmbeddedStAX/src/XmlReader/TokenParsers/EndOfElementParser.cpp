@@ -53,11 +53,26 @@ EndOfElementParser::~EndOfElementParser()
  *
  * \return Element name
  */
-EmbeddedStAX::Common::UnicodeString EndOfElementParser::name() const
+const EmbeddedStAX::Common::UnicodeString &EndOfElementParser::name() const
 {
     return m_elementName;
 }
 
+/**
+ * Swap element name with the selected one
+ *
+ * \param name Element name that receives the parsed element name
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void EndOfElementParser::swapName(Common::UnicodeString *name)
+{
+    if (name != NULL)
+    {
+        m_elementName.swap(*name);
+    }
+}
+
 /**
  * Parse
  *
@@ -200,6 +215,15 @@ void EndOfElementParser::deinitializeAdditionalData()
     m_nameParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void EndOfElementParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_elementName);
+    m_nameParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading element name
  *
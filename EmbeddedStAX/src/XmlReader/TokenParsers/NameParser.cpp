@@ -53,7 +53,7 @@ NameParser::~NameParser()
  *
  * \return Value string
  */
-EmbeddedStAX::Common::UnicodeString NameParser::value() const
+const EmbeddedStAX::Common::UnicodeString &NameParser::value() const
 {
     return m_value;
 }
@@ -225,6 +225,14 @@ void NameParser::deinitializeAdditionalData()
     m_value.clear();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void NameParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_value);
+}
+
 /**
  * Execute state: Reading name start character
  *
@@ -325,7 +333,8 @@ NameParser::State NameParser::executeStateReadingNameChars()
             {
                 // End of name found
                 const size_t size = parsingBuffer()->currentPosition();
-                m_value = parsingBuffer()->substring(0U, size);
+                m_value.clear();
+                parsingBuffer()->appendSubstring(0U, size, &m_value);
 
                 parsingBuffer()->eraseToCurrentPosition();
                 nextState = State_Finished;
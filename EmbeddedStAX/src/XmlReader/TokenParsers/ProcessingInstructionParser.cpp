@@ -55,18 +55,33 @@ ProcessingInstructionParser::~ProcessingInstructionParser()
  *
  * \return Processing instruction
  */
-EmbeddedStAX::Common::ProcessingInstruction
+const EmbeddedStAX::Common::ProcessingInstruction &
 ProcessingInstructionParser::processingInstruction() const
 {
     return m_processingInstruction;
 }
 
+/**
+ * Swap processing instruction with the selected one
+ *
+ * \param processingInstruction Processing instruction that receives the parsed processing instruction
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void ProcessingInstructionParser::swapProcessingInstruction(Common::ProcessingInstruction *processingInstruction)
+{
+    if (processingInstruction != NULL)
+    {
+        m_processingInstruction.swap(*processingInstruction);
+    }
+}
+
 /**
  * Get XML declaration
  *
  * \return XML declaration
  */
-EmbeddedStAX::Common::XmlDeclaration ProcessingInstructionParser::xmlDeclaration() const
+const EmbeddedStAX::Common::XmlDeclaration &ProcessingInstructionParser::xmlDeclaration() const
 {
     return m_xmlDeclaration;
 }
@@ -77,6 +92,9 @@ EmbeddedStAX::Common::XmlDeclaration ProcessingInstructionParser::xmlDeclaration
  * \retval Result_Success       Success
  * \retval Result_NeedMoreData  More data is needed
  * \retval Result_Error         Error
+ *
+ * \note With Option_SkipValue the PI data is only scanned for the end of the processing
+ *       instruction and it is not stored (except for a XML declaration).
  */
 AbstractTokenParser::Result ProcessingInstructionParser::parse()
 {
@@ -209,6 +227,16 @@ void ProcessingInstructionParser::deinitializeAdditionalData()
     m_nameParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void ProcessingInstructionParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_piTarget);
+    Common::ProcessingInstruction(allocator()).swap(m_processingInstruction);
+    m_nameParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading PITarget
  *
@@ -281,6 +309,17 @@ ProcessingInstructionParser::State ProcessingInstructionParser::executeStateRead
         // Check if more data is needed
         if (parsingBuffer()->isMoreDataNeeded())
         {
+            const size_t currentPosition = parsingBuffer()->currentPosition();
+
+            if ((option() == Option_SkipValue) &&
+                (currentPosition > 1U) &&
+                (!XmlValidator::isXmlDeclaration(m_piTarget)))
+            {
+                // Skipped PI data is not needed, keep only the character for the "?>" sequence
+                parsingBuffer()->erase(currentPosition - 1U);
+                parsingBuffer()->setCurrentPosition(1U);
+            }
+
             // More data is needed
             nextState = State_ReadingPiData;
         }
@@ -306,8 +345,14 @@ ProcessingInstructionParser::State ProcessingInstructionParser::executeStateRead
                         (parsingBuffer()->at(currentPosition - 1U) == static_cast<uint32_t>('?')))
                     {
                         // End of PI Data found
-                        const Common::UnicodeString piData =
-                                parsingBuffer()->substring(0U, currentPosition - 1U);
+                        Common::UnicodeString piData;
+
+                        if ((option() != Option_SkipValue) ||
+                            XmlValidator::isXmlDeclaration(m_piTarget))
+                        {
+                            piData = parsingBuffer()->substring(0U, currentPosition - 1U);
+                        }
+
                         parsingBuffer()->incrementPosition();
                         parsingBuffer()->eraseToCurrentPosition();
 
@@ -324,6 +369,13 @@ ProcessingInstructionParser::State ProcessingInstructionParser::executeStateRead
                                 nextState = State_Finished;
                             }
                         }
+                        else if (option() == Option_SkipValue)
+                        {
+                            // Processing instruction skipped, only its target is kept
+                            m_processingInstruction.setPiTarget(m_piTarget);
+                            setTokenType(TokenType_ProcessingInstruction);
+                            nextState = State_Finished;
+                        }
                         else
                         {
                             m_processingInstruction.setPiTarget(m_piTarget);
@@ -56,7 +56,7 @@ ReferenceParser::~ReferenceParser()
  *
  * \return Value string
  */
-EmbeddedStAX::Common::UnicodeString ReferenceParser::value() const
+const EmbeddedStAX::Common::UnicodeString &ReferenceParser::value() const
 {
     return m_value;
 }
@@ -323,6 +323,15 @@ void ReferenceParser::deinitializeAdditionalData()
     m_nameParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void ReferenceParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_value);
+    m_nameParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading start of reference
  *
@@ -383,7 +392,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingReferenceType()
     if (parsingBuffer()->isMoreDataNeeded())
     {
         // More data is needed
-        nextState = State_ReadingStartOfReference;
+        nextState = State_ReadingReferenceType;
     }
     else
     {
@@ -498,7 +507,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingCharacterReferenceTyp
     if (parsingBuffer()->isMoreDataNeeded())
     {
         // More data is needed
-        nextState = State_ReadingStartOfReference;
+        nextState = State_ReadingCharacterReferenceType;
     }
     else
     {
@@ -566,7 +575,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingCharacterReferenceDec
             {
                 // End of character reference (in decimal format) found
                 m_value.clear();
-                m_value.push_back(uchar);
+                m_value.push_back(m_charRefValue);
 
                 parsingBuffer()->incrementPosition();
                 parsingBuffer()->eraseToCurrentPosition();
@@ -576,7 +585,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingCharacterReferenceDec
             else if (Common::parseDigit(uchar, 10U, &digitValue))
             {
                 // Digit found
-                m_charRefValue = (m_charRefValue * 10U) + uchar;
+                m_charRefValue = (m_charRefValue * 10U) + digitValue;
 
                 if (Common::isUnicodeChar(m_charRefValue))
                 {
@@ -637,7 +646,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingCharacterReferenceHex
             {
                 // End of character reference (in hexadecimal format) found
                 m_value.clear();
-                m_value.push_back(uchar);
+                m_value.push_back(m_charRefValue);
 
                 parsingBuffer()->incrementPosition();
                 parsingBuffer()->eraseToCurrentPosition();
@@ -647,7 +656,7 @@ ReferenceParser::State ReferenceParser::executeStateReadingCharacterReferenceHex
             else if (Common::parseDigit(uchar, 16U, &digitValue))
             {
                 // Digit found
-                m_charRefValue = (m_charRefValue * 16U) + uchar;
+                m_charRefValue = (m_charRefValue * 16U) + digitValue;
 
                 if (Common::isUnicodeChar(m_charRefValue))
                 {
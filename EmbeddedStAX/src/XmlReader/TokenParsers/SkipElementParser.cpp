@@ -0,0 +1,537 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/TokenParsers/SkipElementParser.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Constructor
+ */
+SkipElementParser::SkipElementParser()
+    : AbstractTokenParser(ParserType_SkipElement),
+      m_state(State_ReadingContent),
+      m_depth(0U),
+      m_matchCount(0U),
+      m_quotationMark(0U),
+      m_previousChar(0U)
+{
+}
+
+/**
+ * Destructor
+ */
+SkipElementParser::~SkipElementParser()
+{
+}
+
+/**
+ * Parse
+ *
+ * \retval Result_Success       Success, end tag of the skipped element was read
+ * \retval Result_NeedMoreData  More data is needed
+ * \retval Result_Error         Error
+ *
+ * \note Parsing starts after the start tag of the element that needs to be skipped.
+ */
+AbstractTokenParser::Result SkipElementParser::parse()
+{
+    Result result = Result_Error;
+
+    if (isInitialized())
+    {
+        bool finishParsing = false;
+
+        while (!finishParsing)
+        {
+            finishParsing = true;
+            State nextState = State_Error;
+
+            switch (m_state)
+            {
+                case State_ReadingContent:
+                {
+                    nextState = executeStateReadingContent();
+                    break;
+                }
+
+                case State_ReadingMarkup:
+                {
+                    nextState = executeStateReadingMarkup();
+                    break;
+                }
+
+                case State_ReadingMarkupDeclaration:
+                {
+                    nextState = executeStateReadingMarkupDeclaration();
+                    break;
+                }
+
+                case State_ReadingCommentStart:
+                {
+                    nextState = executeStateReadingCommentStart();
+                    break;
+                }
+
+                case State_ReadingComment:
+                {
+                    // Comment end ::= '-->'
+                    nextState = executeStateReadingTerminator(State_ReadingComment,
+                                                              static_cast<uint32_t>('-'),
+                                                              2U);
+                    break;
+                }
+
+                case State_ReadingCData:
+                {
+                    // CDATA end ::= ']]>'
+                    nextState = executeStateReadingTerminator(State_ReadingCData,
+                                                              static_cast<uint32_t>(']'),
+                                                              2U);
+                    break;
+                }
+
+                case State_ReadingProcessingInstruction:
+                {
+                    // PI end ::= '?>'
+                    nextState = executeStateReadingTerminator(State_ReadingProcessingInstruction,
+                                                              static_cast<uint32_t>('?'),
+                                                              1U);
+                    break;
+                }
+
+                case State_ReadingStartTag:
+                {
+                    nextState = executeStateReadingStartTag();
+                    break;
+                }
+
+                case State_ReadingEndTag:
+                {
+                    nextState = executeStateReadingEndTag();
+                    break;
+                }
+
+                case State_Finished:
+                {
+                    nextState = State_Finished;
+                    break;
+                }
+
+                default:
+                {
+                    // Error, invalid state
+                    break;
+                }
+            }
+
+            // Check transitions (a state stays the same only if more data is needed)
+            if (nextState == State_Finished)
+            {
+                result = Result_Success;
+            }
+            else if (nextState == State_Error)
+            {
+                // Error
+            }
+            else if (nextState == m_state)
+            {
+                result = Result_NeedMoreData;
+            }
+            else
+            {
+                // Execute another cycle
+                finishParsing = false;
+            }
+
+            // Update state
+            m_state = nextState;
+        }
+    }
+
+    // Skipped data is not needed anymore
+    parsingBuffer()->eraseToCurrentPosition();
+
+    return result;
+}
+
+/**
+ * Initialize parser's additional data
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool SkipElementParser::initializeAdditionalData()
+{
+    m_state = State_ReadingContent;
+    m_depth = 1U;
+    m_matchCount = 0U;
+    m_quotationMark = 0U;
+    m_previousChar = 0U;
+    parsingBuffer()->eraseToCurrentPosition();
+    return true;
+}
+
+/**
+ * Deinitialize parser's additional data
+ */
+void SkipElementParser::deinitializeAdditionalData()
+{
+    m_state = State_ReadingContent;
+    m_depth = 0U;
+    m_matchCount = 0U;
+    m_quotationMark = 0U;
+    m_previousChar = 0U;
+}
+
+/**
+ * Rebind parser's additional data to the parser's allocator
+ *
+ * \note Parser doesn't have any data that would use the allocator.
+ */
+void SkipElementParser::rebindAdditionalData()
+{
+}
+
+/**
+ * Execute state: Reading content
+ *
+ * \retval State_ReadingContent Wait for more data
+ * \retval State_ReadingMarkup  Start of markup found
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingContent()
+{
+    State nextState = State_ReadingContent;
+    bool finishParsing = false;
+
+    while (!finishParsing)
+    {
+        if (parsingBuffer()->isMoreDataNeeded())
+        {
+            // More data is needed
+            finishParsing = true;
+        }
+        else
+        {
+            const uint32_t uchar = parsingBuffer()->currentChar();
+            parsingBuffer()->incrementPosition();
+
+            if (uchar == static_cast<uint32_t>('<'))
+            {
+                // Start of markup found
+                nextState = State_ReadingMarkup;
+                finishParsing = true;
+            }
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading markup
+ *
+ * \retval State_ReadingMarkup                  Wait for more data
+ * \retval State_ReadingMarkupDeclaration       Start of a comment or CDATA found
+ * \retval State_ReadingProcessingInstruction   Start of a processing instruction found
+ * \retval State_ReadingStartTag                Start of a start tag found
+ * \retval State_ReadingEndTag                  Start of an end tag found
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingMarkup()
+{
+    State nextState = State_ReadingMarkup;
+
+    if (!parsingBuffer()->isMoreDataNeeded())
+    {
+        const uint32_t uchar = parsingBuffer()->currentChar();
+
+        if (uchar == static_cast<uint32_t>('/'))
+        {
+            parsingBuffer()->incrementPosition();
+            nextState = State_ReadingEndTag;
+        }
+        else if (uchar == static_cast<uint32_t>('!'))
+        {
+            parsingBuffer()->incrementPosition();
+            nextState = State_ReadingMarkupDeclaration;
+        }
+        else if (uchar == static_cast<uint32_t>('?'))
+        {
+            parsingBuffer()->incrementPosition();
+            m_matchCount = 0U;
+            nextState = State_ReadingProcessingInstruction;
+        }
+        else
+        {
+            // Character is part of the element name so it is handled by the start tag state
+            m_quotationMark = 0U;
+            m_previousChar = 0U;
+            nextState = State_ReadingStartTag;
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading markup declaration
+ *
+ * \retval State_ReadingMarkupDeclaration   Wait for more data
+ * \retval State_ReadingCommentStart        Possible start of a comment found
+ * \retval State_ReadingCData               Start of CDATA found
+ * \retval State_Error                      Error, unexpected character
+ *
+ * Format:
+ * \code{.unparsed}
+ * Comment start ::= '<!--'
+ * CDATA start   ::= '<![CDATA['
+ * \endcode
+ *
+ * \note The "CDATA[" part of the CDATA start is not checked, it can't contain the end of CDATA.
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingMarkupDeclaration()
+{
+    State nextState = State_ReadingMarkupDeclaration;
+
+    if (!parsingBuffer()->isMoreDataNeeded())
+    {
+        const uint32_t uchar = parsingBuffer()->currentChar();
+        parsingBuffer()->incrementPosition();
+
+        if (uchar == static_cast<uint32_t>('-'))
+        {
+            nextState = State_ReadingCommentStart;
+        }
+        else if (uchar == static_cast<uint32_t>('['))
+        {
+            m_matchCount = 0U;
+            nextState = State_ReadingCData;
+        }
+        else
+        {
+            // Error, unexpected character (document type is not allowed in an element)
+            setTerminationChar(uchar);
+            nextState = State_Error;
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading comment start
+ *
+ * \retval State_ReadingCommentStart    Wait for more data
+ * \retval State_ReadingComment         Start of comment found
+ * \retval State_Error                  Error, unexpected character
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingCommentStart()
+{
+    State nextState = State_ReadingCommentStart;
+
+    if (!parsingBuffer()->isMoreDataNeeded())
+    {
+        const uint32_t uchar = parsingBuffer()->currentChar();
+        parsingBuffer()->incrementPosition();
+
+        if (uchar == static_cast<uint32_t>('-'))
+        {
+            m_matchCount = 0U;
+            nextState = State_ReadingComment;
+        }
+        else
+        {
+            // Error, unexpected character
+            setTerminationChar(uchar);
+            nextState = State_Error;
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading up to a terminator (end of comment, CDATA or processing instruction)
+ *
+ * \param currentState          Current state
+ * \param terminatorChar        Character that has to precede the '>' character
+ * \param terminatorCharCount   Number of terminator characters that have to precede '>'
+ *
+ * \retval currentState         Wait for more data
+ * \retval State_ReadingContent Terminator found
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingTerminator(
+        const State currentState,
+        const uint32_t terminatorChar,
+        const size_t terminatorCharCount)
+{
+    State nextState = currentState;
+    bool finishParsing = false;
+
+    while (!finishParsing)
+    {
+        if (parsingBuffer()->isMoreDataNeeded())
+        {
+            // More data is needed
+            finishParsing = true;
+        }
+        else
+        {
+            const uint32_t uchar = parsingBuffer()->currentChar();
+            parsingBuffer()->incrementPosition();
+
+            if (uchar == terminatorChar)
+            {
+                if (m_matchCount < terminatorCharCount)
+                {
+                    m_matchCount++;
+                }
+            }
+            else if ((uchar == static_cast<uint32_t>('>')) &&
+                     (m_matchCount == terminatorCharCount))
+            {
+                // Terminator found
+                nextState = State_ReadingContent;
+                finishParsing = true;
+            }
+            else
+            {
+                m_matchCount = 0U;
+            }
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading start tag
+ *
+ * \retval State_ReadingStartTag    Wait for more data
+ * \retval State_ReadingContent     End of start tag (or empty element tag) found
+ *
+ * \note Attribute values are tracked so that a '>' character in them is not mistaken for the end
+ *       of the tag.
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingStartTag()
+{
+    State nextState = State_ReadingStartTag;
+    bool finishParsing = false;
+
+    while (!finishParsing)
+    {
+        if (parsingBuffer()->isMoreDataNeeded())
+        {
+            // More data is needed
+            finishParsing = true;
+        }
+        else
+        {
+            const uint32_t uchar = parsingBuffer()->currentChar();
+            parsingBuffer()->incrementPosition();
+
+            if (m_quotationMark != 0U)
+            {
+                if (uchar == m_quotationMark)
+                {
+                    // End of attribute value
+                    m_quotationMark = 0U;
+                }
+            }
+            else if ((uchar == static_cast<uint32_t>('"')) ||
+                     (uchar == static_cast<uint32_t>('\'')))
+            {
+                // Start of attribute value
+                m_quotationMark = uchar;
+            }
+            else if (uchar == static_cast<uint32_t>('>'))
+            {
+                if (m_previousChar != static_cast<uint32_t>('/'))
+                {
+                    // Start tag of a nested element
+                    m_depth++;
+                }
+
+                nextState = State_ReadingContent;
+                finishParsing = true;
+            }
+            else
+            {
+                // Other characters of the tag are not needed
+            }
+
+            m_previousChar = uchar;
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Execute state: Reading end tag
+ *
+ * \retval State_ReadingEndTag  Wait for more data
+ * \retval State_ReadingContent End tag of a nested element found
+ * \retval State_Finished       End tag of the skipped element found
+ */
+SkipElementParser::State SkipElementParser::executeStateReadingEndTag()
+{
+    State nextState = State_ReadingEndTag;
+    bool finishParsing = false;
+
+    while (!finishParsing)
+    {
+        if (parsingBuffer()->isMoreDataNeeded())
+        {
+            // More data is needed
+            finishParsing = true;
+        }
+        else
+        {
+            const uint32_t uchar = parsingBuffer()->currentChar();
+            parsingBuffer()->incrementPosition();
+
+            if (uchar == static_cast<uint32_t>('>'))
+            {
+                m_depth--;
+
+                if (m_depth == 0U)
+                {
+                    nextState = State_Finished;
+                }
+                else
+                {
+                    nextState = State_ReadingContent;
+                }
+
+                finishParsing = true;
+            }
+        }
+    }
+
+    return nextState;
+}
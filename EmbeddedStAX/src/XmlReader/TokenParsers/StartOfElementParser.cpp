@@ -41,7 +41,9 @@ StartOfElementParser::StartOfElementParser()
       m_attributeValueParser(),
       m_elementName(),
       m_attributeName(),
-      m_attributeList()
+      m_attributeList(),
+      m_attributeKeyTable(NULL),
+      m_attributeSlots()
 {
 }
 
@@ -57,11 +59,26 @@ StartOfElementParser::~StartOfElementParser()
  *
  * \return Element name
  */
-EmbeddedStAX::Common::UnicodeString StartOfElementParser::name() const
+const EmbeddedStAX::Common::UnicodeString &StartOfElementParser::name() const
 {
     return m_elementName;
 }
 
+/**
+ * Swap element name with the selected one
+ *
+ * \param name Element name that receives the parsed element name
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void StartOfElementParser::swapName(Common::UnicodeString *name)
+{
+    if (name != NULL)
+    {
+        m_elementName.swap(*name);
+    }
+}
+
 /**
  * Get attribute list
  *
@@ -72,6 +89,56 @@ const EmbeddedStAX::Common::AttributeList &StartOfElementParser::attributeList()
     return m_attributeList;
 }
 
+/**
+ * Swap attribute list with the selected one
+ *
+ * \param attributeList Attribute list that receives the parsed attribute list
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void StartOfElementParser::swapAttributeList(Common::AttributeList *attributeList)
+{
+    if (attributeList != NULL)
+    {
+        m_attributeList.swap(*attributeList);
+    }
+}
+
+/**
+ * Set attribute key table
+ *
+ * \param attributeKeyTable Table of the attribute names (keys) that are looked up during parsing
+ *                          or NULL
+ *
+ * Attribute with a name that is in the key table is stored in the attribute slot with the same
+ * index as the symbol ID of the name (see swapAttributeSlots()).
+ *
+ * \note Key table is not owned by the parser and it must not be changed during parsing.
+ */
+void StartOfElementParser::setAttributeKeyTable(const Common::SymbolTable *attributeKeyTable)
+{
+    m_attributeKeyTable = attributeKeyTable;
+}
+
+/**
+ * Swap attribute slots with the selected ones
+ *
+ * \param attributeSlots    Attribute slots that receive the parsed attribute slots
+ *
+ * Each slot points to the attribute (in the attribute list) with the name from the attribute key
+ * table or it is NULL if the element does not have that attribute.
+ *
+ * \note Slots must be swapped together with the attribute list (see swapAttributeList()).
+ */
+void StartOfElementParser::swapAttributeSlots(
+        std::vector<const Common::Attribute *> *attributeSlots)
+{
+    if (attributeSlots != NULL)
+    {
+        m_attributeSlots.swap(*attributeSlots);
+    }
+}
+
 /**
  * Parse
  *
@@ -344,6 +411,11 @@ bool StartOfElementParser::initializeAdditionalData()
     parsingBuffer()->eraseToCurrentPosition();
     m_attributeValueParser.deinitialize();
 
+    if (m_attributeKeyTable != NULL)
+    {
+        m_attributeSlots.assign(m_attributeKeyTable->size(), NULL);
+    }
+
     return m_nameParser.initialize(parsingBuffer());
 }
 
@@ -360,6 +432,18 @@ void StartOfElementParser::deinitializeAdditionalData()
     m_attributeValueParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void StartOfElementParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_elementName);
+    Common::UnicodeString(allocator()).swap(m_attributeName);
+    Common::AttributeList(allocator()).swap(m_attributeList);
+    m_nameParser.setArena(allocator().arena());
+    m_attributeValueParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading element name
  *
@@ -669,8 +753,23 @@ StartOfElementParser::State StartOfElementParser::executeStateReadingAttributeVa
         case Result_Success:
         {
             // Add attribute to the attribute list
-            const Common::Attribute attribute(m_attributeName, m_attributeValueParser.value());
-            m_attributeList.add(attribute);
+            Common::Attribute attribute(m_attributeName);
+            attribute.setRawValue(m_attributeValueParser.value(),
+                                  Common::QuotationMark_Quote,
+                                  m_attributeValueParser.valueHasReferences());
+            const Common::Attribute *addedAttribute = m_attributeList.add(attribute);
+
+            if (!m_attributeSlots.empty())
+            {
+                // Fill the slot of a registered attribute key
+                const uint32_t key = m_attributeKeyTable->find(addedAttribute->name());
+
+                if (key < m_attributeSlots.size())
+                {
+                    m_attributeSlots[key] = addedAttribute;
+                }
+            }
+
             m_attributeName.clear();
             m_attributeValueParser.deinitialize();
             nextState = State_ReadingNextItem;
@@ -26,6 +26,7 @@
  */
 
 #include <EmbeddedStAX/XmlReader/TokenParsers/TextNodeParser.h>
+#include <EmbeddedStAX/Common/Common.h>
 #include <EmbeddedStAX/XmlValidator/Common.h>
 
 using namespace EmbeddedStAX::XmlReader;
@@ -37,7 +38,9 @@ TextNodeParser::TextNodeParser()
     : AbstractTokenParser(ParserType_TextNode),
       m_state(State_ReadingText),
       m_referenceParser(),
-      m_text()
+      m_text(),
+      m_textHasReferences(false),
+      m_chunkSize(0U)
 {
 }
 
@@ -52,23 +55,79 @@ TextNodeParser::~TextNodeParser()
  * Get text string
  *
  * \return Text string
+ *
+ * \note References in the text are not decoded (see textHasReferences()).
  */
-EmbeddedStAX::Common::UnicodeString TextNodeParser::text() const
+const EmbeddedStAX::Common::UnicodeString &TextNodeParser::text() const
 {
     return m_text;
 }
 
+/**
+ * Check if the text string contains references
+ *
+ * \retval true    Text contains entity and/or character references
+ * \retval false   Text doesn't contain any references
+ */
+bool TextNodeParser::textHasReferences() const
+{
+    return m_textHasReferences;
+}
+
+/**
+ * Swap text string with the selected one
+ *
+ * \param text Text string that receives the parsed text string
+ *
+ * \note This transfers the parsed value out of the parser without copying it.
+ */
+void TextNodeParser::swapText(Common::UnicodeString *text)
+{
+    if (text != NULL)
+    {
+        m_text.swap(*text);
+    }
+}
+
+/**
+ * Get chunk size
+ *
+ * \return Chunk size
+ * \retval 0   Text is not split into chunks
+ */
+size_t TextNodeParser::chunkSize() const
+{
+    return m_chunkSize;
+}
+
+/**
+ * Set chunk size
+ *
+ * \param chunkSize Minimum size of a text chunk (0 disables splitting of the text into chunks)
+ *
+ * When the size of the read text reaches the chunk size a text chunk is made available (parse()
+ * returns Result_TextChunk) and the text string is cleared on the next parse() call.
+ */
+void TextNodeParser::setChunkSize(const size_t chunkSize)
+{
+    m_chunkSize = chunkSize;
+}
+
 /**
  * Parse
  *
  * \retval Result_Success       Success
  * \retval Result_NeedMoreData  More data is needed
+ * \retval Result_TextChunk     Text chunk was read (see setChunkSize())
  * \retval Result_Error         Error
  *
  * Format:
  * \code{.unparsed}
  * content ::= CharData? ((element | Reference | CDSect | PI | Comment) CharData?)*
  * \endcode
+ *
+ * \note With Option_SkipValue the text is only scanned for the end of the text node (references
+ *       are not parsed) and it is not stored.
  */
 AbstractTokenParser::Result TextNodeParser::parse()
 {
@@ -106,6 +165,12 @@ AbstractTokenParser::Result TextNodeParser::parse()
                             break;
                         }
 
+                        case State_TextChunkRead:
+                        {
+                            result = Result_TextChunk;
+                            break;
+                        }
+
                         case State_Finished:
                         {
                             result = Result_Success;
@@ -153,6 +218,16 @@ AbstractTokenParser::Result TextNodeParser::parse()
                     break;
                 }
 
+                case State_TextChunkRead:
+                {
+                    // Start reading the next text chunk
+                    m_text.clear();
+                    m_textHasReferences = false;
+                    nextState = State_ReadingText;
+                    finishParsing = false;
+                    break;
+                }
+
                 case State_Finished:
                 {
                     result = Result_Success;
@@ -191,6 +266,7 @@ bool TextNodeParser::initializeAdditionalData()
 {
     m_state = State_ReadingText;
     m_text.clear();
+    m_textHasReferences = false;
     parsingBuffer()->eraseToCurrentPosition();
     m_referenceParser.deinitialize();
     return true;
@@ -203,14 +279,25 @@ void TextNodeParser::deinitializeAdditionalData()
 {
     m_state = State_ReadingText;
     m_text.clear();
+    m_textHasReferences = false;
     m_referenceParser.deinitialize();
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void TextNodeParser::rebindAdditionalData()
+{
+    Common::UnicodeString(allocator()).swap(m_text);
+    m_referenceParser.setArena(allocator().arena());
+}
+
 /**
  * Execute state: Reading text
  *
  * \retval State_ReadingText        Wait for more data
  * \retval State_ReadingReference   Start of reference found
+ * \retval State_TextChunkRead      Text chunk was read
  * \retval State_Finished           End of text node found
  * \retval State_Error              Error, unexpected character
  *
@@ -228,10 +315,29 @@ TextNodeParser::State TextNodeParser::executeStateReadingText()
     while (!finishParsing)
     {
         finishParsing = true;
+        const size_t position = parsingBuffer()->currentPosition();
 
-        // Check if more data is needed
-        if (parsingBuffer()->isMoreDataNeeded())
+        // Check if a text chunk is ready
+        if ((m_chunkSize > 0U) &&
+            (option() != Option_SkipValue) &&
+            (position > 2U) &&
+            ((m_text.size() + position - 2U) >= m_chunkSize))
+        {
+            // Add text, the last two characters are kept for detection of the "]]>" sequence
+            parsingBuffer()->appendSubstring(0U, position - 2U, &m_text);
+            parsingBuffer()->erase(position - 2U);
+            parsingBuffer()->setCurrentPosition(2U);
+            nextState = State_TextChunkRead;
+        }
+        else if (parsingBuffer()->isMoreDataNeeded())
         {
+            if ((option() == Option_SkipValue) && (position > 2U))
+            {
+                // Skipped text is not needed, keep only the characters for the "]]>" sequence
+                parsingBuffer()->erase(position - 2U);
+                parsingBuffer()->setCurrentPosition(2U);
+            }
+
             // More data is needed
             nextState = State_ReadingText;
         }
@@ -242,19 +348,20 @@ TextNodeParser::State TextNodeParser::executeStateReadingText()
 
             if (uchar == static_cast<uint32_t>('<'))
             {
-                // Add text
-                const size_t size = parsingBuffer()->currentPosition();
-                m_text.append(parsingBuffer()->substring(0U, size));
+                if (option() != Option_SkipValue)
+                {
+                    // Add text
+                    parsingBuffer()->appendSubstring(0U, position, &m_text);
+                }
 
                 // End of text node found ()
                 parsingBuffer()->eraseToCurrentPosition();
                 nextState = State_Finished;
             }
-            else if (uchar == static_cast<uint32_t>('&'))
+            else if ((uchar == static_cast<uint32_t>('&')) && (option() != Option_SkipValue))
             {
                 // Add text
-                const size_t size = parsingBuffer()->currentPosition();
-                m_text.append(parsingBuffer()->substring(0U, size));
+                parsingBuffer()->appendSubstring(0U, position, &m_text);
 
                 // Possible start of Reference found, parse it
                 parsingBuffer()->eraseToCurrentPosition();
@@ -264,13 +371,12 @@ TextNodeParser::State TextNodeParser::executeStateReadingText()
             else if (uchar == static_cast<uint32_t>('>'))
             {
                 // Check if this character is part of the "]]>" sequence
-                const size_t position = parsingBuffer()->currentPosition();
                 bool validChar = true;
 
-                if (position > 2U)
+                if (position >= 2U)
                 {
                     const Common::UnicodeString sequence =
-                            parsingBuffer()->substring(position - 2U, position - 1U);
+                            parsingBuffer()->substring(position - 2U, 2U);
 
                     if (Common::compareUnicodeString(0U, sequence, std::string("]]")))
                     {
@@ -328,50 +434,21 @@ TextNodeParser::State TextNodeParser::executeStateReadingReference()
             {
                 case TokenType_EntityReference:
                 {
-                    // Check the entity reference name
-                    const Common::UnicodeString name = m_referenceParser.value();
-
-                    if (Common::compareUnicodeString(0U, name, std::string("amp")))
-                    {
-                        // Reference to '&' character found, add it to the value
-                        m_text.push_back(static_cast<uint32_t>('&'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("lt")))
-                    {
-                        // Reference to '<' character found, add it to the value
-                        m_text.push_back(static_cast<uint32_t>('<'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("gt")))
-                    {
-                        // Reference to '>' character found, add it to the value
-                        m_text.push_back(static_cast<uint32_t>('>'));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("apos")))
-                    {
-                        // Reference to "'" character found, add it to the value
-                        m_text.push_back(static_cast<uint32_t>('\''));
-                    }
-                    else if (Common::compareUnicodeString(0U, name, std::string("quot")))
-                    {
-                        // Reference to '"' character found, add it to the value
-                        m_text.push_back(static_cast<uint32_t>('"'));
-                    }
-                    else
-                    {
-                        // Unknown entity reference, add the full entity reference to the value
-                        m_text.push_back(static_cast<uint32_t>('&'));
-                        m_text.append(name);
-                        m_text.push_back(static_cast<uint32_t>(';'));
-                    }
-
+                    // Keep the entity reference, it is decoded only when the value is accessed
+                    m_text.push_back(static_cast<uint32_t>('&'));
+                    m_text.append(m_referenceParser.value());
+                    m_text.push_back(static_cast<uint32_t>(';'));
+                    m_textHasReferences = true;
                     nextState = State_ReadingText;
                     break;
                 }
 
                 case TokenType_CharacterReference:
                 {
-                    // Add the character from the character reference to the value
-                    m_text.append(m_referenceParser.value());
+                    // Keep the character reference (in hexadecimal format), it is decoded only
+                    // when the value is accessed
+                    Common::appendCharacterReference(m_referenceParser.value()[0U], &m_text);
+                    m_textHasReferences = true;
                     nextState = State_ReadingText;
                     break;
                 }
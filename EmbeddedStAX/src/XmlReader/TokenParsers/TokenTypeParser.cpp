@@ -294,6 +294,17 @@ AbstractTokenParser::Result TokenTypeParser::parse()
     return result;
 }
 
+/**
+ * Check if the parser is waiting for the start of a token
+ *
+ * \retval true     Parser is initialized and no part of a token was read yet
+ * \retval false    Parser is not initialized or it is reading a token
+ */
+bool TokenTypeParser::isWaitingForToken() const
+{
+    return isInitialized() && (m_state == State_WaitingForStartOfToken);
+}
+
 /**
  * Set parsing option
  *
@@ -348,6 +359,14 @@ void TokenTypeParser::deinitializeAdditionalData()
     m_state = State_WaitingForStartOfToken;
 }
 
+/**
+ * Rebind parser's additional data to the parser's allocator
+ */
+void TokenTypeParser::rebindAdditionalData()
+{
+    // Nothing to rebind, parser does not hold any data
+}
+
 /**
  * Execute state: Waiting for start of token
  *
@@ -0,0 +1,699 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlReader/XmlDocument.h>
+#include <EmbeddedStAX/XmlReader/StaticXmlHandler.h>
+
+using namespace EmbeddedStAX::XmlReader;
+
+/**
+ * Invalid node or attribute index
+ */
+const uint32_t XmlDocument::InvalidIndex = 0xFFFFFFFFU;
+
+namespace EmbeddedStAX
+{
+namespace XmlReader
+{
+/**
+ * Builder appends the parsing results of the reader to the document
+ */
+class XmlDocument::Builder : public StaticXmlHandler
+{
+public:
+    // Public types
+    enum
+    {
+        HandlerEventMask = XmlReader::EventMask_All &
+                           ~(XmlReader::EventMask_XmlDeclaration |
+                             XmlReader::EventMask_DocumentType)
+    };
+
+public:
+    // Public API
+    explicit Builder(XmlDocument *document)
+        : m_document(document)
+    {
+    }
+
+    bool onProcessingInstruction(const Common::ProcessingInstruction &processingInstruction)
+    {
+        m_document->finishText();
+        m_document->addNode(NodeType_ProcessingInstruction,
+                            processingInstruction.piTarget(),
+                            processingInstruction.piData());
+        return true;
+    }
+
+    bool onComment(const Common::UnicodeString &text)
+    {
+        m_document->finishText();
+        m_document->addNode(NodeType_Comment, Common::UnicodeString(), text);
+        return true;
+    }
+
+    bool onStartOfElement(const Common::UnicodeString &name,
+                          const Common::AttributeList &attributeList)
+    {
+        m_document->finishText();
+        const uint32_t element = m_document->addNode(NodeType_Element,
+                                                     name,
+                                                     Common::UnicodeString());
+
+        for (Common::AttributeList::ConstIterator it = attributeList.begin();
+             it != attributeList.end();
+             ++it)
+        {
+            m_document->addAttribute(*it);
+        }
+
+        m_document->m_currentElement = element;
+        return true;
+    }
+
+    bool onEndOfElement(const Common::UnicodeString &)
+    {
+        m_document->finishText();
+        m_document->m_currentElement = m_document->m_nodes[m_document->m_currentElement].parent;
+
+        // Stop at the end of the root element
+        m_document->m_complete = (m_document->m_currentElement == 0U);
+        return !m_document->m_complete;
+    }
+
+    bool onTextNode(const Common::UnicodeString &text)
+    {
+        m_document->endText(NodeType_TextNode, text);
+        return true;
+    }
+
+    bool onCData(const Common::UnicodeString &text)
+    {
+        m_document->endText(NodeType_CData, text);
+        return true;
+    }
+
+    bool onTextChunk(const Common::UnicodeString &text)
+    {
+        m_document->appendText(text);
+        return true;
+    }
+
+private:
+    // Private data
+    XmlDocument *m_document;
+};
+}
+}
+
+/**
+ * Constructor
+ */
+XmlDocument::XmlDocument()
+    : m_nodes(),
+      m_attributes(),
+      m_stringPool(),
+      m_currentElement(0U),
+      m_pendingText(InvalidIndex),
+      m_complete(false)
+{
+    clear();
+}
+
+/**
+ * Clear the document
+ *
+ * \note Capacity of the node array, the attribute array and the string pool is kept.
+ */
+void XmlDocument::clear()
+{
+    m_nodes.clear();
+    m_attributes.clear();
+    m_stringPool.clear();
+    m_currentElement = 0U;
+    m_pendingText = InvalidIndex;
+    m_complete = false;
+
+    // Document node
+    addNode(NodeType_Document, Common::UnicodeString(), Common::UnicodeString());
+    m_nodes[0].parent = InvalidIndex;
+}
+
+/**
+ * Reserve capacity
+ *
+ * \param nodeCount         Expected number of nodes
+ * \param attributeCount    Expected number of attributes
+ * \param stringSize        Expected size of all of the strings
+ */
+void XmlDocument::reserve(const size_t nodeCount,
+                          const size_t attributeCount,
+                          const size_t stringSize)
+{
+    m_nodes.reserve(nodeCount);
+    m_attributes.reserve(attributeCount);
+    m_stringPool.reserve(stringSize);
+}
+
+/**
+ * Build the document from the parsing results of the reader
+ *
+ * \param xmlReader XML reader with the data of the document
+ *
+ * \retval Result_NeedMoreData  All of the buffered data was parsed, write more data to the reader
+ *                              and call this method again
+ * \retval Result_Success       End of the root element was read
+ * \retval Result_Error         Parsing error or the document is already complete
+ *
+ * \note XML declaration and document type are not stored in the document and the parsing is
+ *       stopped at the end of the root element so the comments and processing instructions after
+ *       the root element are not read.
+ */
+XmlDocument::Result XmlDocument::build(XmlReader *xmlReader)
+{
+    Result result = Result_Error;
+
+    if ((xmlReader != NULL) && (!m_complete))
+    {
+        Builder builder(this);
+
+        switch (xmlReader->parse(builder))
+        {
+            case XmlReader::ParsingResult_NeedMoreData:
+            {
+                result = Result_NeedMoreData;
+                break;
+            }
+
+            case XmlReader::ParsingResult_None:
+            {
+                if (m_complete)
+                {
+                    result = Result_Success;
+                }
+                break;
+            }
+
+            default:
+            {
+                // Error
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Check if the document is complete
+ *
+ * \retval true     End of the root element was read
+ * \retval false    Document is not complete
+ */
+bool XmlDocument::isComplete() const
+{
+    return m_complete;
+}
+
+/**
+ * Get number of nodes
+ *
+ * \return Number of nodes (including the document node)
+ */
+size_t XmlDocument::nodeCount() const
+{
+    return m_nodes.size();
+}
+
+/**
+ * Get document node
+ *
+ * \return Index of the document node
+ */
+uint32_t XmlDocument::documentNode() const
+{
+    return 0U;
+}
+
+/**
+ * Get root element
+ *
+ * \return Index of the root element or InvalidIndex if the root element was not read yet
+ */
+uint32_t XmlDocument::rootElement() const
+{
+    uint32_t child = m_nodes[0].firstChild;
+
+    while ((child != InvalidIndex) && (m_nodes[child].type != NodeType_Element))
+    {
+        child = m_nodes[child].nextSibling;
+    }
+
+    return child;
+}
+
+/**
+ * Get node type
+ *
+ * \param node  Node index
+ *
+ * \return Node type (NodeType_Document for an invalid node index)
+ */
+XmlDocument::NodeType XmlDocument::nodeType(const uint32_t node) const
+{
+    NodeType type = NodeType_Document;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        type = nodeData->type;
+    }
+
+    return type;
+}
+
+/**
+ * Get parent node
+ *
+ * \param node  Node index
+ *
+ * \return Index of the parent node or InvalidIndex
+ */
+uint32_t XmlDocument::parent(const uint32_t node) const
+{
+    uint32_t index = InvalidIndex;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        index = nodeData->parent;
+    }
+
+    return index;
+}
+
+/**
+ * Get first child node
+ *
+ * \param node  Node index
+ *
+ * \return Index of the first child node or InvalidIndex
+ */
+uint32_t XmlDocument::firstChild(const uint32_t node) const
+{
+    uint32_t index = InvalidIndex;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        index = nodeData->firstChild;
+    }
+
+    return index;
+}
+
+/**
+ * Get next sibling node
+ *
+ * \param node  Node index
+ *
+ * \return Index of the next sibling node or InvalidIndex
+ */
+uint32_t XmlDocument::nextSibling(const uint32_t node) const
+{
+    uint32_t index = InvalidIndex;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        index = nodeData->nextSibling;
+    }
+
+    return index;
+}
+
+/**
+ * Find child element
+ *
+ * \param node  Node index
+ * \param name  Element name
+ *
+ * \return Index of the first child element with the name or InvalidIndex
+ */
+uint32_t XmlDocument::findChildElement(const uint32_t node,
+                                       const Common::UnicodeString &name) const
+{
+    uint32_t child = firstChild(node);
+
+    while ((child != InvalidIndex) &&
+           ((m_nodes[child].type != NodeType_Element) ||
+            (!compareString(m_nodes[child].name, name))))
+    {
+        child = m_nodes[child].nextSibling;
+    }
+
+    return child;
+}
+
+/**
+ * Get node name
+ *
+ * \param node  Node index
+ *
+ * \return Element name, processing instruction target or an empty string for the other nodes
+ */
+EmbeddedStAX::Common::UnicodeString XmlDocument::name(const uint32_t node) const
+{
+    Common::UnicodeString value;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        value = m_stringPool.substr(nodeData->name.position, nodeData->name.size);
+    }
+
+    return value;
+}
+
+/**
+ * Compare node name
+ *
+ * \param node  Node index
+ * \param name  Name to compare with
+ *
+ * \retval true     Node name is equal to the name
+ * \retval false    Node name is not equal to the name or node index is not valid
+ *
+ * \note Unlike name() this does not copy the node name.
+ */
+bool XmlDocument::nameEquals(const uint32_t node, const Common::UnicodeString &name) const
+{
+    bool equal = false;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        equal = compareString(nodeData->name, name);
+    }
+
+    return equal;
+}
+
+/**
+ * Get node value
+ *
+ * \param node  Node index
+ *
+ * \return Text of a text node, CDATA section or comment, processing instruction data or an empty
+ *         string for the other nodes
+ */
+EmbeddedStAX::Common::UnicodeString XmlDocument::value(const uint32_t node) const
+{
+    Common::UnicodeString value;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        value = m_stringPool.substr(nodeData->value.position, nodeData->value.size);
+    }
+
+    return value;
+}
+
+/**
+ * Get number of attributes
+ *
+ * \param node  Node index
+ *
+ * \return Number of attributes of the element
+ */
+size_t XmlDocument::attributeCount(const uint32_t node) const
+{
+    size_t count = 0U;
+    const Node *nodeData = this->node(node);
+
+    if (nodeData != NULL)
+    {
+        count = nodeData->attributeCount;
+    }
+
+    return count;
+}
+
+/**
+ * Get attribute name
+ *
+ * \param node  Node index
+ * \param index Attribute index (from 0 to attributeCount() - 1)
+ *
+ * \return Attribute name or an empty string if the attribute does not exist
+ */
+EmbeddedStAX::Common::UnicodeString XmlDocument::attributeName(const uint32_t node,
+                                                               const size_t index) const
+{
+    Common::UnicodeString value;
+
+    if (index < attributeCount(node))
+    {
+        const AttributeNode &attribute = m_attributes[m_nodes[node].firstAttribute + index];
+        value = m_stringPool.substr(attribute.name.position, attribute.name.size);
+    }
+
+    return value;
+}
+
+/**
+ * Get attribute value
+ *
+ * \param node  Node index
+ * \param index Attribute index (from 0 to attributeCount() - 1)
+ *
+ * \return Attribute value or an empty string if the attribute does not exist
+ */
+EmbeddedStAX::Common::UnicodeString XmlDocument::attributeValue(const uint32_t node,
+                                                                const size_t index) const
+{
+    Common::UnicodeString value;
+
+    if (index < attributeCount(node))
+    {
+        const AttributeNode &attribute = m_attributes[m_nodes[node].firstAttribute + index];
+        value = m_stringPool.substr(attribute.value.position, attribute.value.size);
+    }
+
+    return value;
+}
+
+/**
+ * Find attribute
+ *
+ * \param node  Node index
+ * \param name  Attribute name
+ *
+ * \return Attribute index (see attributeValue()) or InvalidIndex if the element does not have
+ *         the attribute
+ */
+uint32_t XmlDocument::findAttribute(const uint32_t node, const Common::UnicodeString &name) const
+{
+    uint32_t index = InvalidIndex;
+    const size_t count = attributeCount(node);
+
+    for (size_t i = 0U; (index == InvalidIndex) && (i < count); i++)
+    {
+        if (compareString(m_attributes[m_nodes[node].firstAttribute + i].name, name))
+        {
+            index = static_cast<uint32_t>(i);
+        }
+    }
+
+    return index;
+}
+
+/**
+ * Get string pool
+ *
+ * \return String pool with all of the strings of the document
+ */
+const EmbeddedStAX::Common::UnicodeString &XmlDocument::stringPool() const
+{
+    return m_stringPool;
+}
+
+/**
+ * Get node
+ *
+ * \param index Node index
+ *
+ * \return Node or NULL if the node index is not valid
+ */
+const XmlDocument::Node *XmlDocument::node(const uint32_t index) const
+{
+    const Node *nodeData = NULL;
+
+    if (index < m_nodes.size())
+    {
+        nodeData = &m_nodes[index];
+    }
+
+    return nodeData;
+}
+
+/**
+ * Add string to the string pool
+ *
+ * \param value String
+ *
+ * \return Reference to the string in the string pool
+ */
+XmlDocument::StringRef XmlDocument::addString(const Common::UnicodeString &value)
+{
+    StringRef stringRef;
+    stringRef.position = m_stringPool.size();
+    stringRef.size = value.size();
+    m_stringPool.append(value);
+    return stringRef;
+}
+
+/**
+ * Add node as the last child of the current element
+ *
+ * \param type  Node type
+ * \param name  Node name
+ * \param value Node value
+ *
+ * \return Index of the new node
+ */
+uint32_t XmlDocument::addNode(const NodeType type,
+                              const Common::UnicodeString &name,
+                              const Common::UnicodeString &value)
+{
+    const uint32_t index = static_cast<uint32_t>(m_nodes.size());
+
+    Node nodeData;
+    nodeData.type = type;
+    nodeData.parent = m_currentElement;
+    nodeData.firstChild = InvalidIndex;
+    nodeData.lastChild = InvalidIndex;
+    nodeData.nextSibling = InvalidIndex;
+    nodeData.firstAttribute = static_cast<uint32_t>(m_attributes.size());
+    nodeData.attributeCount = 0U;
+    nodeData.name = addString(name);
+    nodeData.value = addString(value);
+    m_nodes.push_back(nodeData);
+
+    if (index != 0U)
+    {
+        // Link the node to its parent
+        Node &parentData = m_nodes[m_currentElement];
+
+        if (parentData.lastChild == InvalidIndex)
+        {
+            parentData.firstChild = index;
+        }
+        else
+        {
+            m_nodes[parentData.lastChild].nextSibling = index;
+        }
+
+        parentData.lastChild = index;
+    }
+
+    return index;
+}
+
+/**
+ * Add attribute to the last node
+ *
+ * \param attribute Attribute
+ */
+void XmlDocument::addAttribute(const Common::Attribute &attribute)
+{
+    AttributeNode attributeNode;
+    attributeNode.name = addString(attribute.name());
+    attributeNode.value = addString(attribute.value());
+    m_attributes.push_back(attributeNode);
+    m_nodes.back().attributeCount++;
+}
+
+/**
+ * Append text chunk to the pending text node
+ *
+ * \param text  Text chunk
+ *
+ * \note Text chunks are appended to the end of the string pool so the text stays contiguous.
+ */
+void XmlDocument::appendText(const Common::UnicodeString &text)
+{
+    if (m_pendingText == InvalidIndex)
+    {
+        m_pendingText = addNode(NodeType_TextNode, Common::UnicodeString(), text);
+    }
+    else
+    {
+        m_stringPool.append(text);
+        m_nodes[m_pendingText].value.size += text.size();
+    }
+}
+
+/**
+ * Append the final part of the text and finish the pending text node
+ *
+ * \param type  Node type (text node or CDATA section)
+ * \param text  Final part of the text
+ */
+void XmlDocument::endText(const NodeType type, const Common::UnicodeString &text)
+{
+    appendText(text);
+    m_nodes[m_pendingText].type = type;
+    m_pendingText = InvalidIndex;
+}
+
+/**
+ * Finish the pending text node
+ *
+ * \note This is needed only if the final part of a chunked text node was empty and the reader did
+ *       not report it.
+ */
+void XmlDocument::finishText()
+{
+    m_pendingText = InvalidIndex;
+}
+
+/**
+ * Compare string from the string pool
+ *
+ * \param value String in the string pool
+ * \param other String to compare with
+ *
+ * \retval true     Strings are equal
+ * \retval false    Strings are not equal
+ */
+bool XmlDocument::compareString(const StringRef &value, const Common::UnicodeString &other) const
+{
+    return (m_stringPool.compare(value.position, value.size, other) == 0);
+}
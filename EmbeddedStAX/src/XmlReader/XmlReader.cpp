@@ -26,21 +26,67 @@
  */
 
 #include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/XmlReader/AbstractXmlHandler.h>
+#include <EmbeddedStAX/XmlReader/EventBuffer.h>
+#include <EmbeddedStAX/Common/TypedValue.h>
+#include <EmbeddedStAX/XmlValidator/Common.h>
 
 using namespace EmbeddedStAX::XmlReader;
 
+/**
+ * Constructor of the workspace
+ */
+XmlReader::Workspace::Workspace()
+    : parsingBuffer(),
+      xmlDeclaration(),
+      processingInstruction(),
+      documentType(),
+      text(),
+      textHasReferences(false),
+      textDecoded(true),
+      decodedText(),
+      name(),
+      attributeList(),
+      attributeSlots(),
+      openElementList(),
+      expandedName(),
+      attributeExpandedNames(),
+      cDataParser(),
+      commentParser(),
+      documentTypeParser(),
+      endOfElementParser(),
+      processingInstructionParser(),
+      skipElementParser(),
+      startOfElementParser(),
+      textNodeParser(),
+      tokenTypeParser()
+{
+    expandedName.namespaceId = NamespaceResolver::NoNamespace;
+    expandedName.localNameId = Common::SymbolTable::InvalidSymbol;
+}
+
 /**
  * Constructor
+ *
+ * \note Workspace (parsing buffer, values and token parsers) is allocated when the reader is first
+ *       used, so a reader that was not used yet holds only its state and configuration.
  */
 XmlReader::XmlReader()
-    : m_cDataParser(),
-      m_commentParser(),
-      m_documentTypeParser(),
-      m_endOfElementParser(),
-      m_processingInstructionParser(),
-      m_startOfElementParser(),
-      m_textNodeParser(),
-      m_tokenTypeParser()
+    : m_documentState(DocumentState_PrologWaitForXmlDeclaration),
+      m_parsingState(ParsingState_Idle),
+      m_inputOffset(0U),
+      m_lastParsingResult(ParsingResult_None),
+      m_arena(NULL),
+      m_eventMask(EventMask_All),
+      m_textChunkSize(0U),
+      m_textChunkRead(false),
+      m_parserContext(NULL),
+      m_attributeKeyTable(),
+      m_pathSelector(),
+      m_selectedDepth(0U),
+      m_namespaceAware(false),
+      m_namespaceResolver(NULL),
+      m_workspace(NULL)
 {
     clear();
 }
@@ -50,44 +96,400 @@ XmlReader::XmlReader()
  */
 XmlReader::~XmlReader()
 {
-    clear();
+    delete m_workspace;
+    m_workspace = NULL;
+
+    delete m_namespaceResolver;
+    m_namespaceResolver = NULL;
 }
 
 /**
  * Clear internal state
+ *
+ * \note Workspace is kept (with the capacity of its buffers) so a cleared reader is ready to parse
+ *       the next input. Use releaseMemory() to release it.
  */
 void XmlReader::clear()
 {
-    m_parsingBuffer.clear();
+    if (m_workspace != NULL)
+    {
+        m_workspace->parsingBuffer.clear();
+    }
+
+    m_inputOffset = 0U;
 
     startNewDocument();
 }
 
 /**
  * Start a new document
+ *
+ * Data that was already parsed is erased and the parsing is restarted at the current position in
+ * the parsing buffer (for example after an error or after the document was abandoned).
+ *
+ * \note This is not needed between the documents in a data stream: after
+ *       ParsingResult_EndOfDocument the reader continues with the next document on its own.
  */
 void XmlReader::startNewDocument()
 {
-    m_documentState = DocumentState_PrologWaitForXmlDeclaration;
     m_parsingState = ParsingState_Idle;
     m_lastParsingResult = ParsingResult_None;
-    m_parsingBuffer.eraseToCurrentPosition();
-    m_xmlDeclaration.clear();
-    m_processingInstruction.clear();
-    m_documentType.clear();
-    m_text.clear();
-    m_name.clear();
-    m_attributeList.clear();
-    m_openElementList.clear();
-
-    m_cDataParser.deinitialize();
-    m_commentParser.deinitialize();
-    m_documentTypeParser.deinitialize();
-    m_endOfElementParser.deinitialize();
-    m_processingInstructionParser.deinitialize();
-    m_startOfElementParser.deinitialize();
-    m_tokenTypeParser.deinitialize();
-    m_textNodeParser.deinitialize();
+
+    if (m_workspace != NULL)
+    {
+        m_workspace->parsingBuffer.eraseToCurrentPosition();
+
+        m_workspace->cDataParser.deinitialize();
+        m_workspace->commentParser.deinitialize();
+        m_workspace->documentTypeParser.deinitialize();
+        m_workspace->endOfElementParser.deinitialize();
+        m_workspace->processingInstructionParser.deinitialize();
+        m_workspace->skipElementParser.deinitialize();
+        m_workspace->startOfElementParser.deinitialize();
+        m_workspace->tokenTypeParser.deinitialize();
+        m_workspace->textNodeParser.deinitialize();
+    }
+
+    resetDocument();
+}
+
+/**
+ * Release the memory of an idle reader
+ *
+ * \retval true     Workspace was released (or it was not allocated)
+ * \retval false    Reader is not idle
+ *
+ * Reader is idle when it is not inside of a document: before any data was written to it or after
+ * ParsingResult_EndOfDocument when all of the written data was parsed (only whitespace was left
+ * after the end of the document). Workspace of an idle reader (parsing buffer, values of the last
+ * parsing result and token parsers) can be released, the reader then holds only its state and
+ * configuration until more data is written to it.
+ *
+ * \note Values of the last parsing result are not available after this call.
+ */
+bool XmlReader::releaseMemory()
+{
+    bool success = true;
+
+    if (m_workspace != NULL)
+    {
+        if (isIdle())
+        {
+            if (m_parsingState == ParsingState_ReadingTokenType)
+            {
+                // Token type parser is waiting for the start of the first token of the next
+                // document, this continues the same way when the workspace is allocated again
+                m_parsingState = ParsingState_EndOfDocumentRead;
+            }
+
+            delete m_workspace;
+            m_workspace = NULL;
+        }
+        else
+        {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Get arena
+ *
+ * \return Arena that is used for the values produced by the reader
+ * \retval NULL Global allocator is used
+ */
+EmbeddedStAX::Common::Arena *XmlReader::arena() const
+{
+    return m_arena;
+}
+
+/**
+ * Set arena
+ *
+ * \param arena Arena that should be used for the values produced by the reader (NULL for global
+ *              allocator)
+ *
+ * All of the strings and lists that the reader and its token parsers produce for a document are
+ * taken from the arena and they are released in bulk by startNewDocument() which also resets the
+ * arena. The arena is owned by the caller and it must not be shared with other readers.
+ *
+ * \note This will also start a new document!
+ * \note Values returned by the accessors are copies that use the global allocator so they stay
+ *       valid after the arena is reset.
+ */
+void XmlReader::setArena(Common::Arena *arena)
+{
+    m_arena = arena;
+    startNewDocument();
+}
+
+/**
+ * Get text chunk size
+ *
+ * \return Text chunk size
+ * \retval 0   Text nodes and CDATA are not split into chunks
+ */
+size_t XmlReader::textChunkSize() const
+{
+    return m_textChunkSize;
+}
+
+/**
+ * Set text chunk size
+ *
+ * \param textChunkSize Minimum size of a text chunk (0 disables splitting of text into chunks)
+ *
+ * When enabled, text of a text node or a CDATA section is reported with ParsingResult_TextChunk
+ * each time that the size of the read (and not yet reported) text reaches the text chunk size.
+ * The final part of the text is reported with ParsingResult_TextNode or ParsingResult_CData, so
+ * the text is always terminated with one of these results. This way the memory used for the
+ * text is limited to about the text chunk size (plus the size of the written data) regardless of
+ * the size of the text node.
+ *
+ * \note Text chunks of a text node never split a reference.
+ */
+void XmlReader::setTextChunkSize(const size_t textChunkSize)
+{
+    m_textChunkSize = textChunkSize;
+
+    if (m_workspace != NULL)
+    {
+        m_workspace->textNodeParser.setChunkSize(textChunkSize);
+        m_workspace->cDataParser.setChunkSize(textChunkSize);
+    }
+}
+
+/**
+ * Get event mask
+ *
+ * \return Event mask (see setEventMask())
+ */
+uint32_t XmlReader::eventMask() const
+{
+    return m_eventMask;
+}
+
+/**
+ * Set event mask
+ *
+ * \param eventMask Bitmask of EventMask values for the parsing results that shall be delivered
+ *
+ * Parsing results that are not in the event mask are not returned by parse(), the reader just
+ * continues parsing. Values of comments, processing instructions, text nodes and CDATA that are
+ * filtered out are not stored at all, they are only scanned for their end.
+ *
+ * Text nodes that contain only whitespace are delivered only if both EventMask_TextNode and
+ * EventMask_WhitespaceTextNode are set. Text chunks (see setTextChunkSize()) are delivered along
+ * with the text node or CDATA that they are part of.
+ *
+ * \note ParsingResult_None, ParsingResult_Error and ParsingResult_NeedMoreData are always
+ *       delivered.
+ */
+void XmlReader::setEventMask(const uint32_t eventMask)
+{
+    m_eventMask = eventMask;
+}
+
+/**
+ * Get parser context
+ *
+ * \return Shared parser context or NULL if the reader does not reference one
+ */
+const ParserContext *XmlReader::parserContext() const
+{
+    return m_parserContext;
+}
+
+/**
+ * Set parser context
+ *
+ * \param parserContext Shared parser context (NULL for none)
+ *
+ * \retval true     Parser context was set
+ * \retval false    Reader is not idle (see releaseMemory())
+ *
+ * Attribute keys, selected paths and namespace names of the context are shared read-only by all of
+ * the readers that reference it, so they are not built again for each reader. Attribute keys and
+ * paths that are later registered in the reader are added on top of the ones from the context.
+ *
+ * \note Attribute keys and selected paths that were registered in the reader and the namespace
+ *       names that were interned in its namespace resolver are cleared.
+ */
+bool XmlReader::setParserContext(const ParserContext *parserContext)
+{
+    const bool success = isIdle();
+
+    if (success)
+    {
+        m_parserContext = parserContext;
+
+        if (parserContext != NULL)
+        {
+            m_attributeKeyTable.setBaseTable(&parserContext->attributeKeyTable());
+            m_pathSelector.setBaseSelector(&parserContext->pathSelector());
+        }
+        else
+        {
+            m_attributeKeyTable.setBaseTable(NULL);
+            m_pathSelector.setBaseSelector(NULL);
+        }
+
+        if (m_workspace != NULL)
+        {
+            m_workspace->attributeSlots.clear();
+        }
+
+        m_selectedDepth = 0U;
+
+        // Namespace resolver is created again on top of the resolver of the context when needed
+        delete m_namespaceResolver;
+        m_namespaceResolver = NULL;
+    }
+
+    return success;
+}
+
+/**
+ * Add selected path
+ *
+ * \param path  Element path (see PathSelector)
+ *
+ * \retval true     Path was added
+ * \retval false    Error, invalid path
+ *
+ * When at least one path is selected only the elements that match one of the paths are delivered
+ * along with all of their content (the event mask is still applied to it). Everything outside of
+ * the selected elements is filtered out: elements that can not contain a selected element are
+ * skipped like with skipElement() and values of the other events are not stored.
+ *
+ * \note Paths should be selected before the start of the document.
+ */
+bool XmlReader::addSelectedPath(const Common::UnicodeString &path)
+{
+    return m_pathSelector.addPath(path);
+}
+
+/**
+ * Clear all of the selected paths (paths of the parser context are kept)
+ */
+void XmlReader::clearSelectedPaths()
+{
+    m_pathSelector.clear();
+    m_selectedDepth = 0U;
+}
+
+/**
+ * Register an attribute key
+ *
+ * \param name  Attribute name
+ *
+ * \return Attribute key that can be used with attribute() (registering the same name again
+ *         returns the same key)
+ *
+ * Attributes with a registered name are stored in a slot array by the start of element parser so
+ * looking them up with attribute() does not compare any strings.
+ *
+ * \note Keys should be registered before the start of the document (or at least outside of a start
+ *       of element).
+ */
+uint32_t XmlReader::registerAttributeKey(const Common::UnicodeString &name)
+{
+    return m_attributeKeyTable.add(name);
+}
+
+/**
+ * Clear all of the registered attribute keys (keys of the parser context are kept)
+ */
+void XmlReader::clearAttributeKeys()
+{
+    m_attributeKeyTable.clear();
+
+    if (m_workspace != NULL)
+    {
+        m_workspace->attributeSlots.clear();
+    }
+}
+
+/**
+ * Check if namespace processing is enabled
+ *
+ * \retval true     Element and attribute names are resolved to expanded names
+ * \retval false    Names are reported only as they are written in the document
+ */
+bool XmlReader::namespaceAware() const
+{
+    return m_namespaceAware;
+}
+
+/**
+ * Enable or disable namespace processing
+ *
+ * \param namespaceAware    Resolve element and attribute names to expanded names
+ *
+ * When enabled the "xmlns" attributes of each element open a new namespace scope and the names
+ * are resolved to expandedName() and attributeExpandedNames(). An undeclared prefix or an invalid
+ * namespace declaration is a parsing error.
+ *
+ * \note Namespace processing should be enabled or disabled only before the start of a document.
+ */
+void XmlReader::setNamespaceAware(const bool namespaceAware)
+{
+    m_namespaceAware = namespaceAware;
+
+    if (m_namespaceResolver != NULL)
+    {
+        m_namespaceResolver->reset();
+    }
+}
+
+/**
+ * Get namespace resolver
+ *
+ * \return Namespace resolver (can be used to intern the namespaces and local names in advance)
+ */
+NamespaceResolver &XmlReader::namespaceResolver()
+{
+    if (m_namespaceResolver == NULL)
+    {
+        const NamespaceResolver *baseResolver = NULL;
+
+        if (m_parserContext != NULL)
+        {
+            baseResolver = &m_parserContext->namespaceResolver();
+        }
+
+        m_namespaceResolver = new NamespaceResolver(baseResolver);
+    }
+
+    return *m_namespaceResolver;
+}
+
+/**
+ * Get namespace resolver
+ *
+ * \return Namespace resolver (can be used to look up the namespace URIs and local names)
+ */
+const NamespaceResolver &XmlReader::namespaceResolver() const
+{
+    static const NamespaceResolver emptyNamespaceResolver;
+    const NamespaceResolver *namespaceResolver = &emptyNamespaceResolver;
+
+    if (m_namespaceResolver != NULL)
+    {
+        namespaceResolver = m_namespaceResolver;
+    }
+    else if (m_parserContext != NULL)
+    {
+        namespaceResolver = &m_parserContext->namespaceResolver();
+    }
+    else
+    {
+        // Namespace resolver was not created yet
+    }
+
+    return *namespaceResolver;
 }
 
 /**
@@ -99,19 +501,188 @@ void XmlReader::startNewDocument()
  */
 size_t XmlReader::writeData(const std::string &data)
 {
-    return m_parsingBuffer.writeData(data);
+    const size_t size = workspace().parsingBuffer.writeData(data);
+    m_inputOffset += size;
+    return size;
+}
+
+/**
+ * Get input offset
+ *
+ * \return Number of bytes of the input that were written to the reader (without the bytes of an
+ *         incomplete unicode character at the end)
+ *
+ * After a checkpoint is restored, the input must be written to the reader from this offset on.
+ */
+size_t XmlReader::inputOffset() const
+{
+    return m_inputOffset - workspace().parsingBuffer.incompleteSize();
+}
+
+/**
+ * Save checkpoint
+ *
+ * \param[out] checkpoint   Output for the checkpoint
+ *
+ * \retval true     Success
+ * \retval false    Error, reader is not at an event boundary
+ *
+ * Checkpoint holds the complete state of the reader in a compact binary form: document and
+ * parsing state, values of the last parsing result, open elements, namespace scopes and the data
+ * that was written to the reader but not yet parsed. Its size depends only on this state and not
+ * on the size of the already parsed part of the document.
+ *
+ * \note Checkpoint can be saved only at an event boundary: before the first call to parse() or
+ *       after parse() returned a parsing result other than ParsingResult_NeedMoreData,
+ *       ParsingResult_TextChunk and ParsingResult_Error. Inside of a token the state of the token
+ *       parsers would also be needed.
+ * \note Configuration of the reader (event mask, text chunk size, selected paths, attribute keys,
+ *       namespace processing and arena) is not a part of the checkpoint.
+ */
+bool XmlReader::saveCheckpoint(std::string *checkpoint) const
+{
+    bool success = false;
+
+    if ((checkpoint != NULL) && isCheckpointState(m_parsingState))
+    {
+        Common::BinaryWriter writer(checkpoint);
+        checkpoint->clear();
+        checkpoint->append("ESXC");
+        writer.writeByte(1U);
+        writer.writeNumber(inputOffset());
+
+        // States
+        writer.writeByte(static_cast<uint32_t>(m_documentState));
+        writer.writeByte(static_cast<uint32_t>(m_parsingState));
+        writer.writeByte(static_cast<uint32_t>(m_lastParsingResult));
+        writer.writeNumber(m_selectedDepth);
+
+        // Values
+        writer.writeByte(static_cast<uint32_t>(workspace().xmlDeclaration.version()));
+        writer.writeByte(static_cast<uint32_t>(workspace().xmlDeclaration.encoding()));
+        writer.writeByte(static_cast<uint32_t>(workspace().xmlDeclaration.standalone()));
+        writer.writeString(workspace().documentType.name());
+        writer.writeString(workspace().processingInstruction.piTarget());
+        writer.writeString(workspace().processingInstruction.piData());
+        writer.writeString(workspace().text);
+        writer.writeByte(workspace().textHasReferences ? 1U : 0U);
+        writer.writeString(workspace().name);
+        writer.writeNumber(workspace().attributeList.size());
+
+        for (Common::AttributeList::ConstIterator it = workspace().attributeList.begin();
+             it != workspace().attributeList.end();
+             ++it)
+        {
+            writer.writeString(it->name());
+            writer.writeString(it->rawValue());
+            writer.writeByte(static_cast<uint32_t>(it->valueQuotationMark()));
+            writer.writeByte(it->valueHasReferences() ? 1U : 0U);
+        }
+
+        // Open elements
+        writer.writeNumber(workspace().openElementList.size());
+
+        for (PathSelector::ElementNameList::const_iterator it = workspace().openElementList.begin();
+             it != workspace().openElementList.end();
+             ++it)
+        {
+            writer.writeString(*it);
+        }
+
+        // Namespace scopes and expanded names (URI and local name)
+        writer.writeNumber(namespaceResolver().scopeDepth());
+
+        for (size_t scope = 0U; scope < namespaceResolver().scopeDepth(); scope++)
+        {
+            const size_t count = namespaceResolver().declarationCount(scope);
+            writer.writeNumber(count);
+
+            for (size_t i = 0U; i < count; i++)
+            {
+                Common::UnicodeString prefix;
+                Common::UnicodeString uri;
+                namespaceResolver().declaration(scope, i, &prefix, &uri);
+                writer.writeString(prefix);
+                writer.writeString(uri);
+            }
+        }
+
+        writer.writeNumber(workspace().attributeExpandedNames.size());
+
+        for (size_t i = 0U; i <= workspace().attributeExpandedNames.size(); i++)
+        {
+            const ExpandedName &expandedName =
+                    (i == 0U) ?
+                        workspace().expandedName :
+                        workspace().attributeExpandedNames[i - 1U];
+            writer.writeString(namespaceResolver().namespaceUri(expandedName.namespaceId));
+            writer.writeString(namespaceResolver().localName(expandedName.localNameId));
+        }
+
+        // Data that was not parsed yet
+        const ParsingBuffer &parsingBuffer = workspace().parsingBuffer;
+        writer.writeString(parsingBuffer.substring(parsingBuffer.currentPosition()));
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Restore checkpoint
+ *
+ * \param checkpoint    Checkpoint (see saveCheckpoint())
+ *
+ * \retval true     Success, continue by writing the input from inputOffset() on
+ * \retval false    Error, invalid checkpoint (reader is cleared)
+ *
+ * \note Reader must be configured the same way as the reader that saved the checkpoint.
+ */
+bool XmlReader::restoreCheckpoint(const std::string &checkpoint)
+{
+    Common::BinaryReader reader(checkpoint.data(), checkpoint.size());
+    uint32_t version = 0U;
+    bool success = false;
+
+    // Restored values are stored in the workspace
+    static_cast<void>(workspace());
+    clear();
+
+    if (reader.readData("ESXC", 4U) && reader.readByte(&version))
+    {
+        if (version == 1U)
+        {
+            success = restoreCheckpointData(&reader);
+        }
+    }
+
+    if (!success)
+    {
+        clear();
+    }
+
+    return success;
 }
 
 /**
  * Parse data in the data buffer
  *
  * \return Parsing result
+ *
+ * ParsingResult_EndOfDocument follows the end of the root element. The next call continues with
+ * the next document in the data stream, so the documents can follow each other without framing.
+ *
+ * \note Comments and processing instructions after the root element are reported as a part of the
+ *       prolog of the next document.
  */
 XmlReader::ParsingResult XmlReader::parse()
 {
     ParsingResult result = ParsingResult_Error;
     bool finishParsing = false;
 
+    // Workspace is allocated again after it was released
+    static_cast<void>(workspace());
+
     while (!finishParsing)
     {
         finishParsing = true;
@@ -122,7 +693,7 @@ XmlReader::ParsingResult XmlReader::parse()
             case ParsingState_Idle:
             {
                 // Start reading a XML document
-                if (m_tokenTypeParser.initialize(&m_parsingBuffer))
+                if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer))
                 {
                     m_documentState = DocumentState_PrologWaitForXmlDeclaration;
                     nextState = ParsingState_ReadingTokenType;
@@ -288,7 +859,7 @@ XmlReader::ParsingResult XmlReader::parse()
 
                     case ParsingState_StartOfElementRead:
                     {
-                        if (m_openElementList.size() >= 1U)
+                        if (m_workspace->openElementList.size() >= 1U)
                         {
                             result = ParsingResult_StartOfElement;
                         }
@@ -331,10 +902,16 @@ XmlReader::ParsingResult XmlReader::parse()
                         break;
                     }
 
+                    case ParsingState_TextNodeChunkRead:
+                    {
+                        result = ParsingResult_TextChunk;
+                        break;
+                    }
+
                     case ParsingState_TextNodeRead:
                     {
                         // Check if any text was read
-                        if (m_text.empty())
+                        if (m_workspace->text.empty())
                         {
                             // No text was read, continue parsing
                             finishParsing = false;
@@ -372,10 +949,16 @@ XmlReader::ParsingResult XmlReader::parse()
                         break;
                     }
 
-                    case ParsingState_CDataRead:
+                    case ParsingState_CDataChunkRead:
                     {
-                        // CDATA was read
-                        result = ParsingResult_CData;
+                        result = ParsingResult_TextChunk;
+                        break;
+                    }
+
+                    case ParsingState_CDataRead:
+                    {
+                        // CDATA was read
+                        result = ParsingResult_CData;
                         break;
                     }
 
@@ -407,7 +990,7 @@ XmlReader::ParsingResult XmlReader::parse()
                     case ParsingState_EndOfElementRead:
                     {
                         // Check for end of root element
-                        if (m_openElementList.empty())
+                        if (m_workspace->openElementList.empty())
                         {
                             // End of root element, document is finished
                             m_documentState = DocumentState_EndOfDocument;
@@ -429,10 +1012,49 @@ XmlReader::ParsingResult XmlReader::parse()
                 break;
             }
 
+            case ParsingState_SkippingElement:
+            {
+                // Skipping element
+                nextState = executeParsingStateSkippingElement();
+
+                // Check transitions
+                switch (nextState)
+                {
+                    case ParsingState_SkippingElement:
+                    {
+                        // More data is needed
+                        result = ParsingResult_NeedMoreData;
+                        break;
+                    }
+
+                    case ParsingState_EndOfElementRead:
+                    {
+                        // Check for end of root element
+                        if (m_workspace->openElementList.empty())
+                        {
+                            // End of root element, document is finished
+                            m_documentState = DocumentState_EndOfDocument;
+                        }
+
+                        // End of the skipped element was read
+                        result = ParsingResult_EndOfElement;
+                        break;
+                    }
+
+                    default:
+                    {
+                        // Error
+                        nextState = ParsingState_Error;
+                        break;
+                    }
+                }
+                break;
+            }
+
             case ParsingState_EmptyElementRead:
             {
                 // Check for end of root element
-                if (m_openElementList.empty())
+                if (m_workspace->openElementList.empty())
                 {
                     // End of root element, document is finished
                     m_documentState = DocumentState_EndOfDocument;
@@ -440,7 +1062,13 @@ XmlReader::ParsingResult XmlReader::parse()
 
                 // Name must not be cleared (it holds the name of the "closed" empty element), but
                 // the attributes can be cleared
-                m_attributeList.clear();
+                clearAttributeList();
+
+                if (m_namespaceAware)
+                {
+                    // Expanded name of the empty element is kept for its end of element
+                    endNamespaceScope(false);
+                }
 
                 // For an empty element, just return the "end of element" result
                 nextState = ParsingState_EndOfElementRead;
@@ -448,12 +1076,32 @@ XmlReader::ParsingResult XmlReader::parse()
                 break;
             }
 
+            case ParsingState_TextNodeChunkRead:
+            {
+                // Continue reading the text node
+                clearText();
+                m_textChunkRead = true;
+                nextState = ParsingState_ReadingTextNode;
+                finishParsing = false;
+                break;
+            }
+
+            case ParsingState_CDataChunkRead:
+            {
+                // Continue reading the CDATA
+                clearText();
+                nextState = ParsingState_ReadingCData;
+                finishParsing = false;
+                break;
+            }
+
             case ParsingState_CDataRead:
             {
-                m_text.clear();
+                clearText();
 
                 // Start reading next token
-                if (m_textNodeParser.initialize(&m_parsingBuffer))
+                if (m_workspace->textNodeParser.initialize(&m_workspace->parsingBuffer,
+                                                           valueOption(EventMask_TextNode)))
                 {
                     // Read token type
                     nextState = ParsingState_ReadingTextNode;
@@ -468,11 +1116,12 @@ XmlReader::ParsingResult XmlReader::parse()
 
             case ParsingState_StartOfElementRead:
             {
-                m_name.clear();
-                m_attributeList.clear();
+                m_workspace->name.clear();
+                clearAttributeList();
 
                 // Start reading next token
-                if (m_textNodeParser.initialize(&m_parsingBuffer))
+                if (m_workspace->textNodeParser.initialize(&m_workspace->parsingBuffer,
+                                                           valueOption(EventMask_TextNode)))
                 {
                     // Read token type
                     nextState = ParsingState_ReadingTextNode;
@@ -487,10 +1136,11 @@ XmlReader::ParsingResult XmlReader::parse()
 
             case ParsingState_TextNodeRead:
             {
-                m_text.clear();
+                clearText();
+                m_textChunkRead = false;
 
                 // Start reading next token
-                if (m_tokenTypeParser.initialize(&m_parsingBuffer,
+                if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
                                                  TokenTypeParser::Option_IgnoreLeadingWhitespace))
                 {
                     // Read token type
@@ -508,7 +1158,7 @@ XmlReader::ParsingResult XmlReader::parse()
             case ParsingState_XmlDeclarationRead:
             {
                 // Start reading next token
-                if (m_tokenTypeParser.initialize(&m_parsingBuffer,
+                if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
                                                  TokenTypeParser::Option_IgnoreLeadingWhitespace))
                 {
                     // Read token type
@@ -524,12 +1174,13 @@ XmlReader::ParsingResult XmlReader::parse()
 
             case ParsingState_CommentRead:
             {
-                m_text.clear();
+                clearText();
 
                 if (m_documentState == DocumentState_Element)
                 {
                     // Start reading next token
-                    if (m_textNodeParser.initialize(&m_parsingBuffer))
+                    if (m_workspace->textNodeParser.initialize(&m_workspace->parsingBuffer,
+                                                    valueOption(EventMask_TextNode)))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTextNode;
@@ -546,7 +1197,8 @@ XmlReader::ParsingResult XmlReader::parse()
                     const TokenTypeParser::Option option =
                             TokenTypeParser::Option_IgnoreLeadingWhitespace;
 
-                    if (m_tokenTypeParser.initialize(&m_parsingBuffer, option))
+                    if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
+                                                                option))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTokenType;
@@ -562,12 +1214,19 @@ XmlReader::ParsingResult XmlReader::parse()
 
             case ParsingState_EndOfElementRead:
             {
-                m_name.clear();
+                m_workspace->name.clear();
 
-                if (m_documentState == DocumentState_Element)
+                if (m_documentState == DocumentState_EndOfDocument)
+                {
+                    // End of root element was read, report the end of the document
+                    nextState = ParsingState_EndOfDocumentRead;
+                    result = ParsingResult_EndOfDocument;
+                }
+                else if (m_documentState == DocumentState_Element)
                 {
                     // Start reading next token
-                    if (m_textNodeParser.initialize(&m_parsingBuffer))
+                    if (m_workspace->textNodeParser.initialize(&m_workspace->parsingBuffer,
+                                                    valueOption(EventMask_TextNode)))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTextNode;
@@ -584,7 +1243,8 @@ XmlReader::ParsingResult XmlReader::parse()
                     const TokenTypeParser::Option option =
                             TokenTypeParser::Option_IgnoreLeadingWhitespace;
 
-                    if (m_tokenTypeParser.initialize(&m_parsingBuffer, option))
+                    if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
+                                                                option))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTokenType;
@@ -600,12 +1260,13 @@ XmlReader::ParsingResult XmlReader::parse()
 
             case ParsingState_ProcessingInstructionRead:
             {
-                m_processingInstruction.clear();
+                m_workspace->processingInstruction.clear();
 
                 if (m_documentState == DocumentState_Element)
                 {
                     // Start reading next token
-                    if (m_textNodeParser.initialize(&m_parsingBuffer))
+                    if (m_workspace->textNodeParser.initialize(&m_workspace->parsingBuffer,
+                                                    valueOption(EventMask_TextNode)))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTextNode;
@@ -622,7 +1283,8 @@ XmlReader::ParsingResult XmlReader::parse()
                     const TokenTypeParser::Option option =
                             TokenTypeParser::Option_IgnoreLeadingWhitespace;
 
-                    if (m_tokenTypeParser.initialize(&m_parsingBuffer, option))
+                    if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
+                                                                option))
                     {
                         // Read token type
                         nextState = ParsingState_ReadingTokenType;
@@ -636,6 +1298,28 @@ XmlReader::ParsingResult XmlReader::parse()
                 break;
             }
 
+            case ParsingState_EndOfDocumentRead:
+            {
+                // Continue with the next document in the data stream (its data is already in the
+                // parsing buffer and the token parsers are initialized on demand)
+                resetDocument();
+
+                const TokenTypeParser::Option option =
+                        TokenTypeParser::Option_IgnoreLeadingWhitespace;
+
+                if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer, option))
+                {
+                    // Read token type
+                    nextState = ParsingState_ReadingTokenType;
+                    finishParsing = false;
+                }
+                else
+                {
+                    // Error, failed to initialize parser
+                }
+                break;
+            }
+
             default:
             {
                 // Error
@@ -651,6 +1335,20 @@ XmlReader::ParsingResult XmlReader::parse()
         {
             m_documentState == DocumentState_Error;
         }
+
+        // Check if the parsing result is filtered out (path selection must see all of the parsing
+        // results to keep track of the selected elements)
+        if (finishParsing)
+        {
+            const bool selected = selectEvent(result);
+
+            if ((!selected) || (!isEventDelivered(result)))
+            {
+                // Continue parsing
+                result = ParsingResult_Error;
+                finishParsing = false;
+            }
+        }
     }
 
     // Save last parsing result
@@ -658,6 +1356,116 @@ XmlReader::ParsingResult XmlReader::parse()
     return result;
 }
 
+/**
+ * Parse all of the buffered data and pass the parsing results to the handler
+ *
+ * \param handler   XML handler
+ *
+ * \retval ParsingResult_NeedMoreData   All of the buffered data was parsed
+ * \retval ParsingResult_None           Parsing was stopped by the handler
+ * \retval ParsingResult_Error          Error
+ *
+ * The handler is called inline from the parsing loop with references to the values stored in the
+ * reader so the values do not need to be fetched (copied) with the accessors.
+ *
+ * \note The accessors can still be used from the callbacks, for example to take a value or to
+ *       call skipElement() from AbstractXmlHandler::onStartOfElement().
+ */
+XmlReader::ParsingResult XmlReader::parse(AbstractXmlHandler *handler)
+{
+    ParsingResult result = ParsingResult_Error;
+
+    if (handler != NULL)
+    {
+        bool finishParsing = false;
+
+        while (!finishParsing)
+        {
+            result = parse();
+
+            switch (result)
+            {
+                case ParsingResult_None:
+                case ParsingResult_Error:
+                case ParsingResult_NeedMoreData:
+                {
+                    finishParsing = true;
+                    break;
+                }
+
+                default:
+                {
+                    if (!dispatchEvent(result, handler))
+                    {
+                        // Stopped by the handler
+                        result = ParsingResult_None;
+                        finishParsing = true;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * Parse all of the buffered data in a batch
+ *
+ * \param eventBuffer   Event buffer where the parsing results are appended to
+ *
+ * \retval ParsingResult_NeedMoreData   All of the buffered data was parsed
+ * \retval ParsingResult_None           Event buffer is full
+ * \retval ParsingResult_Error          Error (events before the error are in the event buffer)
+ *
+ * Each event contains all of the data that is otherwise available through the accessors for the
+ * parsing result so there is no need for additional calls per event.
+ *
+ * \note Event buffer is not cleared before the events are appended to it.
+ */
+XmlReader::ParsingResult XmlReader::parseBatch(EventBuffer *eventBuffer)
+{
+    ParsingResult result = ParsingResult_Error;
+
+    if (eventBuffer != NULL)
+    {
+        bool finishParsing = false;
+
+        while (!finishParsing)
+        {
+            if (eventBuffer->isFull())
+            {
+                result = ParsingResult_None;
+                finishParsing = true;
+            }
+            else
+            {
+                result = parse();
+
+                switch (result)
+                {
+                    case ParsingResult_None:
+                    case ParsingResult_Error:
+                    case ParsingResult_NeedMoreData:
+                    {
+                        finishParsing = true;
+                        break;
+                    }
+
+                    default:
+                    {
+                        addEvent(result, eventBuffer);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 /**
  * Get last parsing result
  *
@@ -668,6 +1476,58 @@ XmlReader::ParsingResult XmlReader::lastParsingResult()
     return m_lastParsingResult;
 }
 
+/**
+ * Skip the current element
+ *
+ * \retval true    Element will be skipped
+ * \retval false   Error, last parsing result is not a start of element
+ *
+ * This can be called right after ParsingResult_StartOfElement. The content of the element is then
+ * skipped up to and including its end tag and the next parse() call returns
+ * ParsingResult_EndOfElement for the skipped element (or ParsingResult_NeedMoreData until its end
+ * tag is read).
+ *
+ * Skipped content is only scanned for the nesting depth of the elements and the boundaries of
+ * comments, CDATA sections and processing instructions. No names or values are built for it and it
+ * is not validated.
+ *
+ * \note Attribute list of the element is cleared by this call.
+ */
+bool XmlReader::skipElement()
+{
+    bool success = false;
+
+    switch (m_parsingState)
+    {
+        case ParsingState_StartOfElementRead:
+        {
+            if (m_workspace->skipElementParser.initialize(&m_workspace->parsingBuffer))
+            {
+                clearAttributeList();
+                m_parsingState = ParsingState_SkippingElement;
+                success = true;
+            }
+            break;
+        }
+
+        case ParsingState_EmptyElementRead:
+        {
+            // Empty element has no content, next parsing result is its end of element
+            clearAttributeList();
+            success = true;
+            break;
+        }
+
+        default:
+        {
+            // Error, invalid state
+            break;
+        }
+    }
+
+    return success;
+}
+
 /**
  * Get XML declaration
  *
@@ -675,27 +1535,35 @@ XmlReader::ParsingResult XmlReader::lastParsingResult()
  */
 EmbeddedStAX::Common::XmlDeclaration XmlReader::xmlDeclaration() const
 {
-    return m_xmlDeclaration;
+    return workspace().xmlDeclaration;
 }
 
 /**
  * Get processing instruction
  *
  * \return Processing instruction
+ *
+ * \note The copy always uses the global allocator so it stays valid when an arena is reset.
  */
 EmbeddedStAX::Common::ProcessingInstruction XmlReader::processingInstruction() const
 {
-    return m_processingInstruction;
+    Common::ProcessingInstruction processingInstruction;
+    processingInstruction = workspace().processingInstruction;
+    return processingInstruction;
 }
 
 /**
  * Get document type
  *
  * \return Document type
+ *
+ * \note The copy always uses the global allocator so it stays valid when an arena is reset.
  */
 EmbeddedStAX::Common::DocumentType XmlReader::documentType() const
 {
-    return m_documentType;
+    Common::DocumentType documentType;
+    documentType = workspace().documentType;
+    return documentType;
 }
 
 /**
@@ -705,69 +1573,287 @@ EmbeddedStAX::Common::DocumentType XmlReader::documentType() const
  * - CDATA
  *
  * \return Text
+ *
+ * \note If a text node contains references then they are decoded on the first call and the
+ *       decoded text is cached. Otherwise the text is returned without copying it.
+ */
+const EmbeddedStAX::Common::UnicodeString &XmlReader::text() const
+{
+    const Common::UnicodeString *text = &workspace().text;
+
+    if (workspace().textHasReferences)
+    {
+        decodeText();
+        text = &workspace().decodedText;
+    }
+
+    return *text;
+}
+
+/**
+ * Get raw text
+ *
+ * \return Text (see text()) with references that are not decoded
+ */
+const EmbeddedStAX::Common::UnicodeString &XmlReader::rawText() const
+{
+    return workspace().text;
+}
+
+/**
+ * Check if the raw text contains references
+ *
+ * \retval true    Raw text contains entity and/or character references
+ * \retval false   Raw text doesn't contain any references
+ */
+bool XmlReader::textHasReferences() const
+{
+    return workspace().textHasReferences;
+}
+
+/**
+ * Parse the text as a 64-bit signed integer (see Common::parseInt64())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool XmlReader::textAsInt64(int64_t *result) const
+{
+    return Common::parseInt64(text(), result);
+}
+
+/**
+ * Parse the text as a floating point value (see Common::parseDouble())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool XmlReader::textAsDouble(double *result) const
+{
+    return Common::parseDouble(text(), result);
+}
+
+/**
+ * Parse the text as a boolean value (see Common::parseBool())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
+ */
+bool XmlReader::textAsBool(bool *result) const
+{
+    return Common::parseBool(text(), result);
+}
+
+/**
+ * Parse the text as a timestamp (see Common::parseTimestamp())
+ *
+ * \param[out] result   Output for the parsed value
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid value
  */
-EmbeddedStAX::Common::UnicodeString XmlReader::text() const
+bool XmlReader::textAsTimestamp(Common::Timestamp *result) const
 {
-    return m_text;
+    return Common::parseTimestamp(text(), result);
 }
 
 /**
  * Get element name
  *
  * \return Element name
+ *
+ * \note The copy always uses the global allocator so it stays valid when an arena is reset.
  */
 EmbeddedStAX::Common::UnicodeString XmlReader::name() const
 {
-    return m_name;
+    const Common::UnicodeString &name = workspace().name;
+    return Common::UnicodeString(name.begin(), name.end());
 }
 
 /**
  * Get attribute list
  *
  * \return Attribute list
+ *
+ * \note The copy always uses the global allocator so it stays valid when an arena is reset.
  */
 EmbeddedStAX::Common::AttributeList XmlReader::attributeList() const
 {
-    return m_attributeList;
+    Common::AttributeList attributeList;
+    attributeList = workspace().attributeList;
+    return attributeList;
 }
 
 /**
- * Execute parsing state: Reading token type
+ * Get attribute of the current element by its registered key
  *
- * \retval ParsingState_ReadingTokenType                Wait for more data
- * \retval ParsingState_ReadingProcessingInstruction    Processing instruction token found
- * \retval ParsingState_ReadingDocumentType             Document type token found
- * \retval ParsingState_ReadingComment                  Comment token found
- * \retval ParsingState_ReadingCData                    CDATA token found
- * \retval ParsingState_ReadingStartOfElement           Start of element token found
- * \retval ParsingState_ReadingEndOfElement             End of element token found
- * \retval ParsingState_Error                           Error
+ * \param key   Attribute key (see registerAttributeKey())
+ *
+ * \return Attribute or NULL if the current element does not have the attribute
+ *
+ * \note Attribute is valid until the attribute list is cleared or taken.
  */
-XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
+const EmbeddedStAX::Common::Attribute *XmlReader::attribute(const uint32_t key) const
 {
-    ParsingState nextState = ParsingState_Error;
-    bool finishParsing = false;
+    const Common::Attribute *attribute = NULL;
 
-    while (!finishParsing)
+    if (key < workspace().attributeSlots.size())
     {
-        finishParsing = true;
+        attribute = workspace().attributeSlots[key];
+    }
 
-        // Parse
-        const TokenTypeParser::Result result = m_tokenTypeParser.parse();
+    return attribute;
+}
 
-        switch (result)
-        {
-            case TokenTypeParser::Result_NeedMoreData:
-            {
-                // More data is needed
-                nextState = ParsingState_ReadingTokenType;
-                break;
-            }
+/**
+ * Get expanded name of the current element
+ *
+ * \return Expanded name (valid for start of element and end of element parsing results when
+ *         namespace processing is enabled)
+ */
+ExpandedName XmlReader::expandedName() const
+{
+    return workspace().expandedName;
+}
 
-            case TokenTypeParser::Result_Success:
-            {
-                // Check token type
-                const TokenTypeParser::TokenType tokenType = m_tokenTypeParser.tokenType();
+/**
+ * Get expanded names of the current element's attributes
+ *
+ * \return Expanded names in the same order as the attributes in the attribute list (valid for the
+ *         start of element parsing result when namespace processing is enabled)
+ */
+const std::vector<ExpandedName> &XmlReader::attributeExpandedNames() const
+{
+    return workspace().attributeExpandedNames;
+}
+
+/**
+ * Take text
+ *
+ * \return Text (see text())
+ *
+ * \note After this call the reader's text is empty. The text is transferred without copying it
+ *       unless an arena is used, in that case it is copied to a string that uses the global
+ *       allocator.
+ */
+EmbeddedStAX::Common::UnicodeString XmlReader::takeText()
+{
+    Common::UnicodeString text;
+
+    if (workspace().textHasReferences)
+    {
+        // Take the decoded text
+        decodeText();
+        takeString(&workspace().decodedText, &text);
+        workspace().text.clear();
+    }
+    else
+    {
+        takeString(&workspace().text, &text);
+    }
+
+    workspace().textHasReferences = false;
+    workspace().textDecoded = false;
+    return text;
+}
+
+/**
+ * Take element name
+ *
+ * \return Element name (see name())
+ *
+ * \note After this call the reader's element name is empty (except for an empty element, its name
+ *       is kept for the "end of element" result). The name is transferred without copying it
+ *       unless an arena is used, in that case it is copied to a string that uses the global
+ *       allocator.
+ */
+EmbeddedStAX::Common::UnicodeString XmlReader::takeName()
+{
+    Common::UnicodeString name;
+
+    if (m_parsingState == ParsingState_EmptyElementRead)
+    {
+        // Name of an empty element is still needed for its "end of element" result
+        name.assign(workspace().name.begin(), workspace().name.end());
+    }
+    else
+    {
+        takeString(&workspace().name, &name);
+    }
+
+    return name;
+}
+
+/**
+ * Take attribute list
+ *
+ * \return Attribute list (see attributeList())
+ *
+ * \note After this call the reader's attribute list is empty. The list is transferred without
+ *       copying it unless an arena is used, in that case it is copied to a list that uses the
+ *       global allocator.
+ */
+EmbeddedStAX::Common::AttributeList XmlReader::takeAttributeList()
+{
+    Common::AttributeList attributeList;
+
+    if (attributeList.allocator() == workspace().attributeList.allocator())
+    {
+        attributeList.swap(workspace().attributeList);
+    }
+    else
+    {
+        attributeList = workspace().attributeList;
+    }
+
+    clearAttributeList();
+    return attributeList;
+}
+
+/**
+ * Execute parsing state: Reading token type
+ *
+ * \retval ParsingState_ReadingTokenType                Wait for more data
+ * \retval ParsingState_ReadingProcessingInstruction    Processing instruction token found
+ * \retval ParsingState_ReadingDocumentType             Document type token found
+ * \retval ParsingState_ReadingComment                  Comment token found
+ * \retval ParsingState_ReadingCData                    CDATA token found
+ * \retval ParsingState_ReadingStartOfElement           Start of element token found
+ * \retval ParsingState_ReadingEndOfElement             End of element token found
+ * \retval ParsingState_Error                           Error
+ */
+XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
+{
+    ParsingState nextState = ParsingState_Error;
+    bool finishParsing = false;
+
+    while (!finishParsing)
+    {
+        finishParsing = true;
+
+        // Parse
+        const TokenTypeParser::Result result = m_workspace->tokenTypeParser.parse();
+
+        switch (result)
+        {
+            case TokenTypeParser::Result_NeedMoreData:
+            {
+                // More data is needed
+                nextState = ParsingState_ReadingTokenType;
+                break;
+            }
+
+            case TokenTypeParser::Result_Success:
+            {
+                // Check token type
+                const TokenTypeParser::TokenType tokenType =
+                        m_workspace->tokenTypeParser.tokenType();
 
                 switch (tokenType)
                 {
@@ -785,7 +1871,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                         const TokenTypeParser::Option option =
                                 TokenTypeParser::Option_IgnoreLeadingWhitespace;
 
-                        if (m_tokenTypeParser.initialize(&m_parsingBuffer, option))
+                        if (m_workspace->tokenTypeParser.initialize(&m_workspace->parsingBuffer,
+                                                                    option))
                         {
                             // Execute another cycle
                             finishParsing = false;
@@ -800,7 +1887,13 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                     case TokenTypeParser::TokenType_ProcessingInstruction:
                     {
                         // Set procesing instruction parser
-                        if (m_processingInstructionParser.initialize(&m_parsingBuffer))
+                        const AbstractTokenParser::Option option =
+                                valueOption(EventMask_ProcessingInstruction);
+
+                        ProcessingInstructionParser &parser =
+                                m_workspace->processingInstructionParser;
+
+                        if (parser.initialize(&m_workspace->parsingBuffer, option))
                         {
                             // Processing instruction token found
                             nextState = ParsingState_ReadingProcessingInstruction;
@@ -815,7 +1908,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                     case TokenTypeParser::TokenType_DocumentType:
                     {
                         // Set document type parser
-                        if (m_documentTypeParser.initialize(&m_parsingBuffer))
+                        if (m_workspace->documentTypeParser.initialize(&m_workspace->parsingBuffer))
                         {
                             // Check document state
                             if (m_documentState == DocumentState_PrologWaitForXmlDeclaration)
@@ -847,7 +1940,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                     case TokenTypeParser::TokenType_Comment:
                     {
                         // Set comment parser
-                        if (m_commentParser.initialize(&m_parsingBuffer))
+                        if (m_workspace->commentParser.initialize(&m_workspace->parsingBuffer,
+                                                       valueOption(EventMask_Comment)))
                         {
                             // Check document state
                             if (m_documentState == DocumentState_PrologWaitForXmlDeclaration)
@@ -870,7 +1964,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                     case TokenTypeParser::TokenType_CData:
                     {
                         // Set comment parser
-                        if (m_cDataParser.initialize(&m_parsingBuffer))
+                        if (m_workspace->cDataParser.initialize(&m_workspace->parsingBuffer,
+                                                     valueOption(EventMask_CData)))
                         {
                             // Check document state
                             if (m_documentState == DocumentState_Element)
@@ -893,10 +1988,12 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
                     case TokenTypeParser::TokenType_StartOfElement:
                     {
                         // Start of element token found
-                        if (m_startOfElementParser.initialize(&m_parsingBuffer))
+                        ParsingBuffer *parsingBuffer = &m_workspace->parsingBuffer;
+
+                        if (m_workspace->startOfElementParser.initialize(parsingBuffer))
                         {
-                            m_name.clear();
-                            m_attributeList.clear();
+                            m_workspace->name.clear();
+                            clearAttributeList();
 
                             // Check document state
                             if ((m_documentState == DocumentState_PrologWaitForXmlDeclaration) ||
@@ -923,9 +2020,9 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTokenType()
 
                     case TokenTypeParser::TokenType_EndOfElement:
                     {
-                        if (m_endOfElementParser.initialize(&m_parsingBuffer))
+                        if (m_workspace->endOfElementParser.initialize(&m_workspace->parsingBuffer))
                         {
-                            m_name.clear();
+                            m_workspace->name.clear();
 
                             // Check document state
                             if (m_documentState == DocumentState_Element)
@@ -979,7 +2076,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingProcessingInstructi
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const ProcessingInstructionParser::Result result = m_processingInstructionParser.parse();
+    const ProcessingInstructionParser::Result result =
+            m_workspace->processingInstructionParser.parse();
 
     switch (result)
     {
@@ -994,14 +2092,15 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingProcessingInstructi
         {
             // Check token type
             const ProcessingInstructionParser::TokenType tokenType =
-                    m_processingInstructionParser.tokenType();
+                    m_workspace->processingInstructionParser.tokenType();
 
             switch (tokenType)
             {
                 case ProcessingInstructionParser::TokenType_ProcessingInstruction:
                 {
                     // Processing instruction read
-                    m_processingInstruction = m_processingInstructionParser.processingInstruction();
+                    m_workspace->processingInstructionParser.swapProcessingInstruction(
+                            &m_workspace->processingInstruction);
 
                     // Check document state
                     if (m_documentState == DocumentState_PrologWaitForXmlDeclaration)
@@ -1022,7 +2121,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingProcessingInstructi
                     if (m_documentState == DocumentState_PrologWaitForXmlDeclaration)
                     {
                         // XML declaration read
-                        m_xmlDeclaration = m_processingInstructionParser.xmlDeclaration();
+                        m_workspace->xmlDeclaration =
+                                m_workspace->processingInstructionParser.xmlDeclaration();
 
                         // A XML declaration is at the start of the document. Now start
                         // waiting for document typel.
@@ -1067,7 +2167,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingComment()
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const CommentParser::Result result = m_commentParser.parse();
+    const CommentParser::Result result = m_workspace->commentParser.parse();
 
     switch (result)
     {
@@ -1081,7 +2181,8 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingComment()
         case CommentParser::Result_Success:
         {
             // Save comment text
-            m_text = m_commentParser.text();
+            m_workspace->commentParser.swapText(&m_workspace->text);
+            m_workspace->textHasReferences = false;
 
             // Check document state
             if (m_documentState == DocumentState_PrologWaitForXmlDeclaration)
@@ -1117,7 +2218,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingDocumentType()
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const DocumentTypeParser::Result result = m_documentTypeParser.parse();
+    const DocumentTypeParser::Result result = m_workspace->documentTypeParser.parse();
 
     switch (result)
     {
@@ -1131,7 +2232,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingDocumentType()
         case DocumentTypeParser::Result_Success:
         {
             // Document type read
-            m_documentType = m_documentTypeParser.documentType();
+            m_workspace->documentTypeParser.swapDocumentType(&m_workspace->documentType);
 
             // Check document state
             if (m_documentState == DocumentState_PrologWaitForDocumentType)
@@ -1170,7 +2271,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const StartOfElementParser::Result result = m_startOfElementParser.parse();
+    const StartOfElementParser::Result result = m_workspace->startOfElementParser.parse();
 
     switch (result)
     {
@@ -1192,8 +2293,11 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
                 case DocumentState_Element:
                 {
                     // Start of element read
-                    m_name = m_startOfElementParser.name();
-                    m_attributeList = m_startOfElementParser.attributeList();
+                    m_workspace->startOfElementParser.swapName(&m_workspace->name);
+                    m_workspace->startOfElementParser.swapAttributeList(
+                            &m_workspace->attributeList);
+                    m_workspace->startOfElementParser.swapAttributeSlots(
+                            &m_workspace->attributeSlots);
 
                     if (m_documentState != DocumentState_Element)
                     {
@@ -1201,7 +2305,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
                     }
 
                     const StartOfElementParser::TokenType tokenType =
-                            m_startOfElementParser.tokenType();
+                            m_workspace->startOfElementParser.tokenType();
 
                     switch (tokenType)
                     {
@@ -1210,15 +2314,16 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
                             // Check for start of root element
                             bool success = true;
 
-                            if (m_openElementList.empty())
+                            if (m_workspace->openElementList.empty())
                             {
-                                const Common::UnicodeString rootName = m_documentType.name();
+                                const Common::UnicodeString rootName =
+                                        m_workspace->documentType.name();
 
                                 if (!rootName.empty())
                                 {
                                     // Root element name was set in the document type, make sure
                                     // that the root element name matches
-                                    if (m_name != rootName)
+                                    if (m_workspace->name != rootName)
                                     {
                                         // Error, root element name does not match the root
                                         // element name from the document type
@@ -1227,7 +2332,12 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
                                 }
                             }
 
-                            m_openElementList.push_back(m_name);
+                            // Copy the element name with the reader's allocator
+                            Common::UnicodeString openElementName(
+                                    m_workspace->name.get_allocator());
+                            openElementName = m_workspace->name;
+                            m_workspace->openElementList.push_back(Common::UnicodeString());
+                            m_workspace->openElementList.back().swap(openElementName);
                             nextState = ParsingState_StartOfElementRead;
                             break;
                         }
@@ -1244,6 +2354,15 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
                             break;
                         }
                     }
+
+                    if ((nextState != ParsingState_Error) && m_namespaceAware)
+                    {
+                        if (!startNamespaceScope())
+                        {
+                            // Error, invalid namespace declaration or undeclared prefix
+                            nextState = ParsingState_Error;
+                        }
+                    }
                     break;
                 }
 
@@ -1269,16 +2388,17 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingStartOfElement()
 /**
  * Execute parsing state: Reading text node
  *
- * \retval ParsingState_ReadingTextNode Wait for more data
- * \retval ParsingState_TextNodeRead    Text node was read
- * \retval ParsingState_Error           Error
+ * \retval ParsingState_ReadingTextNode     Wait for more data
+ * \retval ParsingState_TextNodeChunkRead   Text chunk was read
+ * \retval ParsingState_TextNodeRead        Text node was read
+ * \retval ParsingState_Error               Error
  */
 XmlReader::ParsingState XmlReader::executeParsingStateReadingTextNode()
 {
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const TextNodeParser::Result result = m_textNodeParser.parse();
+    const TextNodeParser::Result result = m_workspace->textNodeParser.parse();
 
     switch (result)
     {
@@ -1289,10 +2409,22 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTextNode()
             break;
         }
 
+        case TextNodeParser::Result_TextChunk:
+        {
+            // Save text chunk
+            m_workspace->textHasReferences = m_workspace->textNodeParser.textHasReferences();
+            m_workspace->textDecoded = false;
+            m_workspace->textNodeParser.swapText(&m_workspace->text);
+            nextState = ParsingState_TextNodeChunkRead;
+            break;
+        }
+
         case TextNodeParser::Result_Success:
         {
             // Save text node
-            m_text = m_textNodeParser.text();
+            m_workspace->textHasReferences = m_workspace->textNodeParser.textHasReferences();
+            m_workspace->textDecoded = false;
+            m_workspace->textNodeParser.swapText(&m_workspace->text);
             nextState = ParsingState_TextNodeRead;
             break;
         }
@@ -1311,6 +2443,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingTextNode()
  * Execute parsing state: Reading CDATA
  *
  * \retval ParsingState_ReadingCData    Wait for more data
+ * \retval ParsingState_CDataChunkRead  Text chunk was read
  * \retval ParsingState_CDataRead       CDATA was read
  * \retval ParsingState_Error           Error
  */
@@ -1319,7 +2452,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingCData()
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const CDataParser::Result result = m_cDataParser.parse();
+    const CDataParser::Result result = m_workspace->cDataParser.parse();
 
     switch (result)
     {
@@ -1330,11 +2463,21 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingCData()
             break;
         }
 
+        case CDataParser::Result_TextChunk:
+        {
+            // Save text chunk
+            m_workspace->cDataParser.swapText(&m_workspace->text);
+            m_workspace->textHasReferences = false;
+            nextState = ParsingState_CDataChunkRead;
+            break;
+        }
+
         case CDataParser::Result_Success:
         {
             // Save CDATA text
-            m_text = m_cDataParser.text();
-            m_cDataParser.deinitialize();
+            m_workspace->cDataParser.swapText(&m_workspace->text);
+            m_workspace->textHasReferences = false;
+            m_workspace->cDataParser.deinitialize();
             nextState = ParsingState_CDataRead;
             break;
         }
@@ -1361,7 +2504,7 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingEndOfElement()
     ParsingState nextState = ParsingState_Error;
 
     // Parse
-    const EndOfElementParser::Result result = m_endOfElementParser.parse();
+    const EndOfElementParser::Result result = m_workspace->endOfElementParser.parse();
 
     switch (result)
     {
@@ -1375,14 +2518,23 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingEndOfElement()
         case EndOfElementParser::Result_Success:
         {
             // End of element read
-            m_name = m_endOfElementParser.name();
+            m_workspace->endOfElementParser.swapName(&m_workspace->name);
 
             // Check if end of element matches currently open element
-            if (m_name == m_openElementList.back())
+            if (m_workspace->name == m_workspace->openElementList.back())
             {
                 // Element name matches
-                m_openElementList.pop_back();
+                m_workspace->openElementList.pop_back();
                 nextState = ParsingState_EndOfElementRead;
+
+                if (m_namespaceAware)
+                {
+                    if (!endNamespaceScope(true))
+                    {
+                        // Error, undeclared prefix
+                        nextState = ParsingState_Error;
+                    }
+                }
             }
             else
             {
@@ -1400,3 +2552,976 @@ XmlReader::ParsingState XmlReader::executeParsingStateReadingEndOfElement()
 
     return nextState;
 }
+
+/**
+ * Execute parsing state: Skipping element
+ *
+ * \retval ParsingState_SkippingElement    Wait for more data
+ * \retval ParsingState_EndOfElementRead   End of the skipped element was read
+ * \retval ParsingState_Error              Error
+ */
+XmlReader::ParsingState XmlReader::executeParsingStateSkippingElement()
+{
+    ParsingState nextState = ParsingState_Error;
+
+    // Parse
+    const SkipElementParser::Result result = m_workspace->skipElementParser.parse();
+
+    switch (result)
+    {
+        case SkipElementParser::Result_NeedMoreData:
+        {
+            // More data is needed
+            nextState = ParsingState_SkippingElement;
+            break;
+        }
+
+        case SkipElementParser::Result_Success:
+        {
+            // End of the skipped element read, its name is the name of the last open element
+            m_workspace->name.swap(m_workspace->openElementList.back());
+            m_workspace->openElementList.pop_back();
+            m_workspace->skipElementParser.deinitialize();
+            nextState = ParsingState_EndOfElementRead;
+
+            if (m_namespaceAware)
+            {
+                // Expanded name was already resolved at the start of the skipped element
+                endNamespaceScope(false);
+            }
+            break;
+        }
+
+        default:
+        {
+            // Error
+            break;
+        }
+    }
+
+    return nextState;
+}
+
+/**
+ * Get workspace
+ *
+ * \return Workspace (it is allocated and configured if needed)
+ */
+XmlReader::Workspace &XmlReader::workspace()
+{
+    if (m_workspace == NULL)
+    {
+        m_workspace = new Workspace();
+        m_workspace->startOfElementParser.setAttributeKeyTable(&m_attributeKeyTable);
+        m_workspace->textNodeParser.setChunkSize(m_textChunkSize);
+        m_workspace->cDataParser.setChunkSize(m_textChunkSize);
+
+        if (m_arena != NULL)
+        {
+            rebindData();
+        }
+    }
+
+    return *m_workspace;
+}
+
+/**
+ * Get workspace
+ *
+ * \return Workspace (or an empty workspace if it is not allocated)
+ */
+const XmlReader::Workspace &XmlReader::workspace() const
+{
+    static const Workspace emptyWorkspace;
+    const Workspace *workspace = &emptyWorkspace;
+
+    if (m_workspace != NULL)
+    {
+        workspace = m_workspace;
+    }
+
+    return *workspace;
+}
+
+/**
+ * Check if the reader is idle (see releaseMemory())
+ *
+ * \retval true     Idle
+ * \retval false    Not idle
+ */
+bool XmlReader::isIdle() const
+{
+    bool idle = false;
+    const ParsingBuffer &parsingBuffer = workspace().parsingBuffer;
+
+    if (parsingBuffer.incompleteSize() == 0U)
+    {
+        switch (m_parsingState)
+        {
+            case ParsingState_Idle:
+            {
+                // No data was written since the reader was cleared
+                idle = (parsingBuffer.size() == 0U);
+                break;
+            }
+
+            case ParsingState_EndOfDocumentRead:
+            {
+                // Only whitespace is left after the end of the document (it would be ignored)
+                idle = true;
+
+                for (size_t i = parsingBuffer.currentPosition();
+                     idle && (i < parsingBuffer.size());
+                     i++)
+                {
+                    idle = XmlValidator::isWhitespace(parsingBuffer.at(i));
+                }
+                break;
+            }
+
+            case ParsingState_ReadingTokenType:
+            {
+                // Waiting for the first token of the next document (whitespace is already erased)
+                const TokenTypeParser &tokenTypeParser = workspace().tokenTypeParser;
+                const AbstractTokenParser::Option option =
+                        AbstractTokenParser::Option_IgnoreLeadingWhitespace;
+
+                idle = (m_documentState == DocumentState_PrologWaitForXmlDeclaration) &&
+                       (tokenTypeParser.option() == option) &&
+                       tokenTypeParser.isWaitingForToken() &&
+                       (parsingBuffer.size() == 0U);
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    return idle;
+}
+
+/**
+ * Rebind all of the reader's data (and the data of its token parsers) to the reader's arena
+ *
+ * \note This releases all of the memory that was taken from the previously used arena.
+ */
+void XmlReader::rebindData()
+{
+    const Common::UnicodeString::allocator_type allocator(m_arena);
+
+    Common::ProcessingInstruction(allocator).swap(m_workspace->processingInstruction);
+    Common::DocumentType(allocator).swap(m_workspace->documentType);
+    Common::UnicodeString(allocator).swap(m_workspace->text);
+    Common::UnicodeString(allocator).swap(m_workspace->decodedText);
+    Common::UnicodeString(allocator).swap(m_workspace->name);
+    Common::AttributeList(allocator).swap(m_workspace->attributeList);
+
+    std::list<Common::UnicodeString, Common::ArenaAllocator<Common::UnicodeString> >
+            openElementList(allocator);
+    m_workspace->openElementList.swap(openElementList);
+
+    m_workspace->cDataParser.setArena(m_arena);
+    m_workspace->commentParser.setArena(m_arena);
+    m_workspace->documentTypeParser.setArena(m_arena);
+    m_workspace->endOfElementParser.setArena(m_arena);
+    m_workspace->processingInstructionParser.setArena(m_arena);
+    m_workspace->skipElementParser.setArena(m_arena);
+    m_workspace->startOfElementParser.setArena(m_arena);
+    m_workspace->textNodeParser.setArena(m_arena);
+    m_workspace->tokenTypeParser.setArena(m_arena);
+}
+
+/**
+ * Reset the values of the document
+ *
+ * Only the values of the previous document are reset: buffered data is kept and the token parsers
+ * are not deinitialized because each of them is initialized again before it is used. Apart from
+ * the bulk reset of the arena the cost does not depend on the size of the previous document.
+ */
+void XmlReader::resetDocument()
+{
+    m_documentState = DocumentState_PrologWaitForXmlDeclaration;
+    m_textChunkRead = false;
+    m_selectedDepth = 0U;
+
+    if (m_namespaceResolver != NULL)
+    {
+        m_namespaceResolver->reset();
+    }
+
+    if (m_workspace != NULL)
+    {
+        m_workspace->xmlDeclaration.clear();
+        m_workspace->processingInstruction.clear();
+        m_workspace->documentType.clear();
+        clearText();
+        m_workspace->decodedText.clear();
+        m_workspace->name.clear();
+        clearAttributeList();
+        m_workspace->openElementList.clear();
+        m_workspace->expandedName.namespaceId = NamespaceResolver::NoNamespace;
+        m_workspace->expandedName.localNameId = Common::SymbolTable::InvalidSymbol;
+        m_workspace->attributeExpandedNames.clear();
+    }
+
+    if ((m_arena != NULL) ||
+        ((m_workspace != NULL) && (m_workspace->text.get_allocator().arena() != NULL)))
+    {
+        // Release all of the memory that was taken from the arena and then reset it in bulk
+        if (m_workspace != NULL)
+        {
+            rebindData();
+        }
+
+        if (m_arena != NULL)
+        {
+            m_arena->reset();
+        }
+    }
+}
+
+/**
+ * Clear the text (and its decoded value)
+ */
+void XmlReader::clearText()
+{
+    m_workspace->text.clear();
+    m_workspace->textHasReferences = false;
+    m_workspace->textDecoded = false;
+}
+
+/**
+ * Clear the attribute list and the attribute slots
+ */
+void XmlReader::clearAttributeList()
+{
+    m_workspace->attributeList.clear();
+    m_workspace->attributeSlots.assign(m_workspace->attributeSlots.size(), NULL);
+}
+
+/**
+ * Start a namespace scope for the current start of element and resolve its names
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid namespace declaration or undeclared prefix
+ */
+bool XmlReader::startNamespaceScope()
+{
+    bool success = true;
+    namespaceResolver().startScope();
+    m_workspace->attributeExpandedNames.clear();
+
+    // Declare the namespaces first so that they apply to the element's own names
+    for (Common::AttributeList::ConstIterator it = m_workspace->attributeList.begin();
+         success && (it != m_workspace->attributeList.end());
+         ++it)
+    {
+        ExpandedName attributeName;
+        success = namespaceResolver().resolveAttributeName(it->name(), &attributeName);
+
+        if (success && (attributeName.namespaceId == NamespaceResolver::XmlnsNamespace))
+        {
+            if (namespaceResolver().localName(attributeName.localNameId) == it->name())
+            {
+                // Default namespace declaration ("xmlns")
+                success = namespaceResolver().declare(Common::UnicodeString(), it->value());
+            }
+            else
+            {
+                // Prefixed namespace declaration ("xmlns:prefix")
+                success = namespaceResolver().declare(
+                            namespaceResolver().localName(attributeName.localNameId),
+                            it->value());
+            }
+        }
+    }
+
+    // Resolve the names
+    if (success)
+    {
+        success = namespaceResolver().resolveElementName(m_workspace->name,
+                                                         &m_workspace->expandedName);
+    }
+
+    for (Common::AttributeList::ConstIterator it = m_workspace->attributeList.begin();
+         success && (it != m_workspace->attributeList.end());
+         ++it)
+    {
+        ExpandedName attributeName;
+        success = namespaceResolver().resolveAttributeName(it->name(), &attributeName);
+
+        if (success)
+        {
+            m_workspace->attributeExpandedNames.push_back(attributeName);
+        }
+    }
+
+    return success;
+}
+
+/**
+ * End the namespace scope of the current element
+ *
+ * \param resolveName   Resolve the current element name before the scope is ended
+ *
+ * \retval true     Success
+ * \retval false    Error, undeclared prefix
+ */
+bool XmlReader::endNamespaceScope(const bool resolveName)
+{
+    bool success = true;
+
+    if (resolveName)
+    {
+        success = namespaceResolver().resolveElementName(m_workspace->name,
+                                                         &m_workspace->expandedName);
+    }
+
+    m_workspace->attributeExpandedNames.clear();
+    namespaceResolver().endScope();
+    return success;
+}
+
+/**
+ * Restore checkpoint data
+ *
+ * \param reader    Binary reader positioned after the checkpoint header
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid checkpoint
+ */
+bool XmlReader::restoreCheckpointData(Common::BinaryReader *reader)
+{
+    size_t inputOffset = 0U;
+    uint32_t documentState = 0U;
+    uint32_t parsingState = 0U;
+    uint32_t lastParsingResult = 0U;
+    bool success = reader->readNumber(&inputOffset) &&
+                   reader->readByte(&documentState) &&
+                   reader->readByte(&parsingState) &&
+                   reader->readByte(&lastParsingResult) &&
+                   reader->readNumber(&m_selectedDepth);
+
+    if (success)
+    {
+        success = (documentState < static_cast<uint32_t>(DocumentState_Error)) &&
+                  isCheckpointState(static_cast<ParsingState>(parsingState)) &&
+                  (lastParsingResult <= static_cast<uint32_t>(ParsingResult_EndOfDocument));
+    }
+
+    if (success)
+    {
+        m_inputOffset = inputOffset;
+        m_documentState = static_cast<DocumentState>(documentState);
+        m_parsingState = static_cast<ParsingState>(parsingState);
+        m_lastParsingResult = static_cast<ParsingResult>(lastParsingResult);
+    }
+
+    // Values
+    uint32_t version = 0U;
+    uint32_t encoding = 0U;
+    uint32_t standalone = 0U;
+    Common::UnicodeString value;
+    Common::UnicodeString data;
+    uint32_t flag = 0U;
+    size_t count = 0U;
+
+    success = success &&
+              reader->readByte(&version) &&
+              reader->readByte(&encoding) &&
+              reader->readByte(&standalone);
+
+    if (success)
+    {
+        m_workspace->xmlDeclaration.setVersion(
+                static_cast<Common::XmlDeclaration::Version>(version));
+        m_workspace->xmlDeclaration.setEncoding(
+                static_cast<Common::XmlDeclaration::Encoding>(encoding));
+        m_workspace->xmlDeclaration.setStandalone(
+                    static_cast<Common::XmlDeclaration::Standalone>(standalone));
+        success = reader->readString(&value);
+    }
+
+    if (success)
+    {
+        m_workspace->documentType.setName(value);
+        success = reader->readString(&value) && reader->readString(&data);
+    }
+
+    if (success)
+    {
+        m_workspace->processingInstruction.setPiTarget(value);
+        m_workspace->processingInstruction.setPiData(data);
+        success = reader->readString(&value) && reader->readByte(&flag);
+    }
+
+    if (success)
+    {
+        m_workspace->text = value;
+        m_workspace->textHasReferences = (flag != 0U);
+        success = reader->readString(&value) && reader->readNumber(&count);
+    }
+
+    if (success)
+    {
+        m_workspace->name = value;
+        m_workspace->attributeSlots.assign(m_attributeKeyTable.size(), NULL);
+    }
+
+    for (size_t i = 0U; success && (i < count); i++)
+    {
+        uint32_t quotationMark = 0U;
+        success = reader->readString(&value) &&
+                  reader->readString(&data) &&
+                  reader->readByte(&quotationMark) &&
+                  reader->readByte(&flag);
+
+        if (success)
+        {
+            Common::Attribute attribute(value);
+            attribute.setRawValue(data,
+                                  static_cast<Common::QuotationMark>(quotationMark),
+                                  (flag != 0U));
+            const Common::Attribute *addedAttribute = m_workspace->attributeList.add(attribute);
+            const uint32_t key = m_attributeKeyTable.find(addedAttribute->name());
+
+            if (key < m_workspace->attributeSlots.size())
+            {
+                m_workspace->attributeSlots[key] = addedAttribute;
+            }
+        }
+    }
+
+    // Open elements
+    success = success && reader->readNumber(&count);
+
+    for (size_t i = 0U; success && (i < count); i++)
+    {
+        success = reader->readString(&value);
+
+        if (success)
+        {
+            Common::UnicodeString openElementName(m_workspace->name.get_allocator());
+            openElementName = value;
+            m_workspace->openElementList.push_back(Common::UnicodeString());
+            m_workspace->openElementList.back().swap(openElementName);
+        }
+    }
+
+    // Namespaces and data that was not parsed yet
+    success = success && restoreNamespaceScopes(reader) && reader->readString(&value);
+
+    if (success)
+    {
+        m_workspace->parsingBuffer.writeData(Common::Utf8::toUtf8(value));
+        success = reader->isEndOfData();
+    }
+
+    return success;
+}
+
+/**
+ * Restore namespace scopes and expanded names from a checkpoint
+ *
+ * \param reader    Binary reader positioned at the namespace scopes
+ *
+ * \retval true     Success
+ * \retval false    Error, invalid checkpoint
+ *
+ * \note Namespace resolver is not created if the reader is not namespace aware and the checkpoint
+ *       has no namespace scopes (the expanded names are then only skipped).
+ */
+bool XmlReader::restoreNamespaceScopes(Common::BinaryReader *reader)
+{
+    Common::UnicodeString prefix;
+    Common::UnicodeString uri;
+    size_t scopeCount = 0U;
+    size_t count = 0U;
+    bool success = reader->readNumber(&scopeCount);
+    const bool resolveNames = m_namespaceAware || (scopeCount > 0U);
+
+    for (size_t scope = 0U; success && (scope < scopeCount); scope++)
+    {
+        namespaceResolver().startScope();
+        success = reader->readNumber(&count);
+
+        for (size_t i = 0U; success && (i < count); i++)
+        {
+            success = reader->readString(&prefix) &&
+                      reader->readString(&uri) &&
+                      namespaceResolver().declare(prefix, uri);
+        }
+    }
+
+    // Expanded names are stored as namespace URI and local name, the first one is element's
+    success = success && reader->readNumber(&count);
+
+    for (size_t i = 0U; success && (i <= count); i++)
+    {
+        ExpandedName expandedName;
+        expandedName.namespaceId = NamespaceResolver::NoNamespace;
+        expandedName.localNameId = Common::SymbolTable::InvalidSymbol;
+        success = reader->readString(&uri) && reader->readString(&prefix);
+
+        if (success && resolveNames)
+        {
+            expandedName.namespaceId = namespaceResolver().addNamespace(uri);
+            expandedName.localNameId = prefix.empty() ?
+                                           Common::SymbolTable::InvalidSymbol :
+                                           namespaceResolver().addLocalName(prefix);
+        }
+
+        if (success)
+        {
+            if (i == 0U)
+            {
+                m_workspace->expandedName = expandedName;
+            }
+            else
+            {
+                m_workspace->attributeExpandedNames.push_back(expandedName);
+            }
+        }
+    }
+
+    return success;
+}
+
+/**
+ * Check if a checkpoint can be saved in the parsing state
+ *
+ * \param parsingState  Parsing state
+ *
+ * \retval true     Parsing state is at an event boundary (no token parser is active)
+ * \retval false    Checkpoint can not be saved in the parsing state
+ */
+bool XmlReader::isCheckpointState(const ParsingState parsingState)
+{
+    bool checkpointState = false;
+
+    switch (parsingState)
+    {
+        case ParsingState_Idle:
+        case ParsingState_XmlDeclarationRead:
+        case ParsingState_ProcessingInstructionRead:
+        case ParsingState_DocumentTypeRead:
+        case ParsingState_CommentRead:
+        case ParsingState_StartOfElementRead:
+        case ParsingState_EmptyElementRead:
+        case ParsingState_TextNodeRead:
+        case ParsingState_CDataRead:
+        case ParsingState_EndOfElementRead:
+        case ParsingState_EndOfDocumentRead:
+        {
+            checkpointState = true;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return checkpointState;
+}
+
+/**
+ * Decode the references in the text (if it was not already decoded)
+ */
+void XmlReader::decodeText() const
+{
+    if (!workspace().textDecoded)
+    {
+        if (!Common::decodeReferences(workspace().text, &workspace().decodedText))
+        {
+            // Invalid reference, use the raw text
+            workspace().decodedText.assign(workspace().text.begin(), workspace().text.end());
+        }
+
+        workspace().textDecoded = true;
+    }
+}
+
+/**
+ * Check if the parsing result shall be delivered (see setEventMask())
+ *
+ * \param result    Parsing result
+ *
+ * \retval true     Parsing result shall be delivered
+ * \retval false    Parsing result is filtered out
+ */
+bool XmlReader::isEventDelivered(const ParsingResult result) const
+{
+    bool delivered = true;
+
+    switch (result)
+    {
+        case ParsingResult_None:
+        case ParsingResult_Error:
+        case ParsingResult_NeedMoreData:
+        {
+            // Always delivered
+            break;
+        }
+
+        case ParsingResult_TextChunk:
+        {
+            if (m_parsingState == ParsingState_CDataChunkRead)
+            {
+                delivered = ((m_eventMask & EventMask_CData) != 0U);
+            }
+            else
+            {
+                delivered = ((m_eventMask & EventMask_TextNode) != 0U);
+            }
+            break;
+        }
+
+        case ParsingResult_TextNode:
+        {
+            delivered = ((m_eventMask & EventMask_TextNode) != 0U);
+
+            if (delivered &&
+                ((m_eventMask & EventMask_WhitespaceTextNode) == 0U) &&
+                (!m_textChunkRead))
+            {
+                // Check if the text node contains only whitespace
+                delivered = false;
+
+                for (Common::UnicodeString::const_iterator it = workspace().text.begin();
+                     it != workspace().text.end();
+                     it++)
+                {
+                    if (!XmlValidator::isWhitespace(*it))
+                    {
+                        delivered = true;
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+
+        default:
+        {
+            delivered = ((m_eventMask & (1U << static_cast<uint32_t>(result))) != 0U);
+            break;
+        }
+    }
+
+    return delivered;
+}
+
+/**
+ * Update path selection with the parsing result
+ *
+ * \param result    Parsing result
+ *
+ * \retval true     Parsing result is inside of a selected element (or no paths are selected)
+ * \retval false    Parsing result is filtered out
+ *
+ * Start of an element that can not contain any selected elements starts skipping of the element.
+ */
+bool XmlReader::selectEvent(const ParsingResult result)
+{
+    bool selected = true;
+
+    if (!m_pathSelector.isEmpty())
+    {
+        switch (result)
+        {
+            case ParsingResult_None:
+            case ParsingResult_Error:
+            case ParsingResult_NeedMoreData:
+            case ParsingResult_EndOfDocument:
+            {
+                // Always delivered
+                break;
+            }
+
+            case ParsingResult_StartOfElement:
+            {
+                if (m_selectedDepth == 0U)
+                {
+                    // Empty element is not in the list of the open elements
+                    const bool emptyElement = (m_parsingState == ParsingState_EmptyElementRead);
+                    const PathSelector::Match match =
+                            m_pathSelector.match(m_workspace->openElementList,
+                                                 emptyElement ? &m_workspace->name : NULL);
+
+                    switch (match)
+                    {
+                        case PathSelector::Match_Selected:
+                        {
+                            // Element is selected, its end is reached when the list of the open
+                            // elements gets shorter than this depth
+                            m_selectedDepth = m_workspace->openElementList.size();
+
+                            if (emptyElement)
+                            {
+                                m_selectedDepth++;
+                            }
+                            break;
+                        }
+
+                        case PathSelector::Match_Ancestor:
+                        {
+                            // Continue parsing the content of the element
+                            selected = false;
+                            break;
+                        }
+
+                        default:
+                        {
+                            // Skip the element
+                            selected = false;
+                            skipElement();
+                            break;
+                        }
+                    }
+                }
+                break;
+            }
+
+            case ParsingResult_EndOfElement:
+            {
+                if (m_selectedDepth == 0U)
+                {
+                    selected = false;
+                }
+                else if (m_workspace->openElementList.size() < m_selectedDepth)
+                {
+                    // End of the selected element
+                    m_selectedDepth = 0U;
+                }
+                else
+                {
+                    // End of an element inside of the selected element
+                }
+                break;
+            }
+
+            default:
+            {
+                selected = (m_selectedDepth != 0U);
+                break;
+            }
+        }
+    }
+
+    return selected;
+}
+
+/**
+ * Get the token parser option for the value of the selected event
+ *
+ * \param eventMask Event mask of the event
+ *
+ * \retval Option_SkipValue Event is filtered out so its value is not needed
+ * \retval Option_None      Event is delivered
+ */
+AbstractTokenParser::Option XmlReader::valueOption(const uint32_t eventMask) const
+{
+    AbstractTokenParser::Option option = AbstractTokenParser::Option_None;
+
+    if ((m_eventMask & eventMask) == 0U)
+    {
+        option = AbstractTokenParser::Option_SkipValue;
+    }
+    else if ((!m_pathSelector.isEmpty()) && (m_selectedDepth == 0U))
+    {
+        // Outside of the selected elements
+        option = AbstractTokenParser::Option_SkipValue;
+    }
+    else
+    {
+        // Value is needed
+    }
+
+    return option;
+}
+
+/**
+ * Take the selected string
+ *
+ * \param value    String to take (it is empty after this call)
+ * \param output   Output string (it must use the global allocator)
+ */
+void XmlReader::takeString(Common::UnicodeString *value, Common::UnicodeString *output)
+{
+    if (output->get_allocator() == value->get_allocator())
+    {
+        output->swap(*value);
+    }
+    else
+    {
+        output->assign(value->begin(), value->end());
+    }
+
+    value->clear();
+}
+
+/**
+ * Add the current parsing result to the event buffer
+ *
+ * \param result        Parsing result
+ * \param eventBuffer   Event buffer
+ */
+void XmlReader::addEvent(const ParsingResult result, EventBuffer *eventBuffer) const
+{
+    const Common::UnicodeString noString;
+
+    switch (result)
+    {
+        case ParsingResult_XmlDeclaration:
+        {
+            eventBuffer->setXmlDeclaration(workspace().xmlDeclaration);
+            eventBuffer->addEvent(result, noString, noString);
+            break;
+        }
+
+        case ParsingResult_ProcessingInstruction:
+        {
+            eventBuffer->addEvent(result,
+                                  workspace().processingInstruction.piTarget(),
+                                  workspace().processingInstruction.piData());
+            break;
+        }
+
+        case ParsingResult_DocumentType:
+        {
+            eventBuffer->addEvent(result, workspace().documentType.name(), noString);
+            break;
+        }
+
+        case ParsingResult_Comment:
+        case ParsingResult_TextNode:
+        case ParsingResult_CData:
+        case ParsingResult_TextChunk:
+        {
+            eventBuffer->addEvent(result, noString, text());
+            break;
+        }
+
+        case ParsingResult_StartOfElement:
+        {
+            eventBuffer->addEvent(result, workspace().name, noString);
+
+            for (Common::AttributeList::ConstIterator it = workspace().attributeList.begin();
+                 it != workspace().attributeList.end();
+                 it++)
+            {
+                eventBuffer->addAttribute(*it);
+            }
+            break;
+        }
+
+        case ParsingResult_EndOfElement:
+        {
+            eventBuffer->addEvent(result, workspace().name, noString);
+            break;
+        }
+
+        case ParsingResult_EndOfDocument:
+        {
+            eventBuffer->addEvent(result, noString, noString);
+            break;
+        }
+
+        default:
+        {
+            // No data for other parsing results
+            break;
+        }
+    }
+}
+
+/**
+ * Pass the parsing result to the handler
+ *
+ * \param result    Parsing result
+ * \param handler   XML handler
+ *
+ * \retval true     Continue parsing
+ * \retval false    Stop parsing
+ */
+bool XmlReader::dispatchEvent(const ParsingResult result, AbstractXmlHandler *handler) const
+{
+    bool continueParsing = true;
+
+    switch (result)
+    {
+        case ParsingResult_XmlDeclaration:
+        {
+            continueParsing = handler->onXmlDeclaration(workspace().xmlDeclaration);
+            break;
+        }
+
+        case ParsingResult_ProcessingInstruction:
+        {
+            continueParsing = handler->onProcessingInstruction(workspace().processingInstruction);
+            break;
+        }
+
+        case ParsingResult_DocumentType:
+        {
+            continueParsing = handler->onDocumentType(workspace().documentType);
+            break;
+        }
+
+        case ParsingResult_Comment:
+        {
+            continueParsing = handler->onComment(text());
+            break;
+        }
+
+        case ParsingResult_StartOfElement:
+        {
+            continueParsing = handler->onStartOfElement(workspace().name,
+                                                        workspace().attributeList);
+            break;
+        }
+
+        case ParsingResult_EndOfElement:
+        {
+            continueParsing = handler->onEndOfElement(workspace().name);
+            break;
+        }
+
+        case ParsingResult_TextNode:
+        {
+            continueParsing = handler->onTextNode(text());
+            break;
+        }
+
+        case ParsingResult_CData:
+        {
+            continueParsing = handler->onCData(text());
+            break;
+        }
+
+        case ParsingResult_TextChunk:
+        {
+            continueParsing = handler->onTextChunk(text());
+            break;
+        }
+
+        case ParsingResult_EndOfDocument:
+        {
+            continueParsing = handler->onEndOfDocument();
+            break;
+        }
+
+        default:
+        {
+            // No callback for other parsing results
+            break;
+        }
+    }
+
+    return continueParsing;
+}
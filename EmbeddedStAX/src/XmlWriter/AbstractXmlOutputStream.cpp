@@ -0,0 +1,236 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlWriter/AbstractXmlOutputStream.h>
+
+using namespace EmbeddedStAX::XmlWriter;
+
+/**
+ * Default size of the buffer
+ */
+const size_t AbstractXmlOutputStream::DefaultBufferSize = 4096U;
+
+namespace
+{
+/**
+ * Maximum size of an UTF-8 encoded character
+ */
+const size_t maxUtf8CharSize = 4U;
+}
+
+/**
+ * Constructor
+ *
+ * \param bufferSize    Size of the buffer (at least the size of one UTF-8 encoded character)
+ */
+AbstractXmlOutputStream::AbstractXmlOutputStream(const size_t bufferSize)
+    : m_buffer((bufferSize < maxUtf8CharSize) ? maxUtf8CharSize : bufferSize),
+      m_bufferedSize(0U),
+      m_bytesWritten(0U),
+      m_valid(true)
+{
+}
+
+/**
+ * Destructor
+ */
+AbstractXmlOutputStream::~AbstractXmlOutputStream()
+{
+}
+
+/**
+ * Check if the stream is valid
+ *
+ * \retval true     All of the data was accepted
+ * \retval false    Error, the sink failed to write the data or an invalid character was written
+ */
+bool AbstractXmlOutputStream::isValid() const
+{
+    return m_valid;
+}
+
+/**
+ * Get size of the buffer
+ *
+ * \return Size of the buffer
+ */
+size_t AbstractXmlOutputStream::bufferSize() const
+{
+    return m_buffer.size();
+}
+
+/**
+ * Get size of the buffered data
+ *
+ * \return Size of the data that was not passed to the sink yet
+ */
+size_t AbstractXmlOutputStream::bufferedSize() const
+{
+    return m_bufferedSize;
+}
+
+/**
+ * Get number of written bytes
+ *
+ * \return Number of bytes that were passed to the sink
+ */
+size_t AbstractXmlOutputStream::bytesWritten() const
+{
+    return m_bytesWritten;
+}
+
+/**
+ * Write a character
+ *
+ * \param unicodeChar   Unicode character
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool AbstractXmlOutputStream::write(const uint32_t unicodeChar)
+{
+    bool success = false;
+
+    if (unicodeChar <= 0x7FU)
+    {
+        // 1 byte UTF-8 character
+        success = reserve(1U);
+
+        if (success)
+        {
+            m_buffer[m_bufferedSize] = static_cast<char>(unicodeChar);
+            m_bufferedSize++;
+        }
+    }
+    else if (unicodeChar <= 0x10FFFFU)
+    {
+        // Multi-byte UTF-8 character
+        const std::string utf8 = Common::Utf8::toUtf8(unicodeChar);
+        success = (!utf8.empty()) && reserve(utf8.size());
+
+        if (success)
+        {
+            for (size_t i = 0U; i < utf8.size(); i++)
+            {
+                m_buffer[m_bufferedSize] = utf8[i];
+                m_bufferedSize++;
+            }
+        }
+    }
+    else
+    {
+        // Error, invalid character
+        m_valid = false;
+    }
+
+    return success;
+}
+
+/**
+ * Write text
+ *
+ * \param text  Text
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool AbstractXmlOutputStream::write(const Common::UnicodeString &text)
+{
+    bool success = m_valid;
+
+    for (size_t i = 0U; success && (i < text.size()); i++)
+    {
+        success = write(text[i]);
+    }
+
+    return success;
+}
+
+/**
+ * Write ASCII text
+ *
+ * \param text  Null-terminated ASCII text
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool AbstractXmlOutputStream::writeAscii(const char *text)
+{
+    bool success = m_valid;
+
+    for (size_t i = 0U; success && (text[i] != '\0'); i++)
+    {
+        success = write(static_cast<uint32_t>(static_cast<unsigned char>(text[i])));
+    }
+
+    return success;
+}
+
+/**
+ * Pass all of the buffered data to the sink
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool AbstractXmlOutputStream::flush()
+{
+    if (m_valid && (m_bufferedSize > 0U))
+    {
+        m_valid = writeData(&m_buffer[0], m_bufferedSize);
+
+        if (m_valid)
+        {
+            m_bytesWritten += m_bufferedSize;
+        }
+
+        m_bufferedSize = 0U;
+    }
+
+    return m_valid;
+}
+
+/**
+ * Make room in the buffer
+ *
+ * \param size  Number of bytes that will be written to the buffer
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * \note Buffered data is flushed if the buffer does not have enough free space.
+ */
+bool AbstractXmlOutputStream::reserve(const size_t size)
+{
+    bool success = m_valid;
+
+    if (success && ((m_bufferedSize + size) > m_buffer.size()))
+    {
+        success = flush();
+    }
+
+    return success;
+}
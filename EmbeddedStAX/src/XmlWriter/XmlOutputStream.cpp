@@ -0,0 +1,225 @@
+/*
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * For more information, please refer to <http://unlicense.org>
+ */
+
+#include <EmbeddedStAX/XmlWriter/XmlOutputStream.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+using namespace EmbeddedStAX::XmlWriter;
+
+/**
+ * Constructor
+ *
+ * \param output        String that the data is appended to
+ * \param bufferSize    Size of the buffer
+ */
+StringOutputStream::StringOutputStream(std::string *output, const size_t bufferSize)
+    : AbstractXmlOutputStream(bufferSize),
+      m_output(output)
+{
+}
+
+/**
+ * Destructor
+ */
+StringOutputStream::~StringOutputStream()
+{
+    static_cast<void>(flush());
+}
+
+/**
+ * Append data to the string
+ *
+ * \param data  Data
+ * \param size  Size of the data
+ *
+ * \retval true     Success
+ * \retval false    Error, string is not set
+ */
+bool StringOutputStream::writeData(const char *data, const size_t size)
+{
+    bool success = false;
+
+    if (m_output != NULL)
+    {
+        m_output->append(data, size);
+        success = true;
+    }
+
+    return success;
+}
+
+/**
+ * Constructor
+ *
+ * \param file          C stream opened for writing
+ * \param bufferSize    Size of the buffer
+ */
+FileOutputStream::FileOutputStream(std::FILE *file, const size_t bufferSize)
+    : AbstractXmlOutputStream(bufferSize),
+      m_file(file)
+{
+}
+
+/**
+ * Destructor
+ */
+FileOutputStream::~FileOutputStream()
+{
+    static_cast<void>(flush());
+}
+
+/**
+ * Write data to the file
+ *
+ * \param data  Data
+ * \param size  Size of the data
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool FileOutputStream::writeData(const char *data, const size_t size)
+{
+    bool success = false;
+
+    if (m_file != NULL)
+    {
+        success = (std::fwrite(data, 1U, size, m_file) == size);
+    }
+
+    return success;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Constructor
+ *
+ * \param fileDescriptor    File descriptor opened for writing
+ * \param bufferSize        Size of the buffer
+ */
+FileDescriptorOutputStream::FileDescriptorOutputStream(const int fileDescriptor,
+                                                       const size_t bufferSize)
+    : AbstractXmlOutputStream(bufferSize),
+      m_fileDescriptor(fileDescriptor)
+{
+}
+
+/**
+ * Destructor
+ */
+FileDescriptorOutputStream::~FileDescriptorOutputStream()
+{
+    static_cast<void>(flush());
+}
+
+/**
+ * Write data to the file descriptor
+ *
+ * \param data  Data
+ * \param size  Size of the data
+ *
+ * \retval true     Success
+ * \retval false    Error
+ *
+ * \note Partial writes and writes interrupted by a signal are continued until all of the data is
+ *       written.
+ */
+bool FileDescriptorOutputStream::writeData(const char *data, const size_t size)
+{
+    bool success = (m_fileDescriptor >= 0);
+    size_t position = 0U;
+
+    while (success && (position < size))
+    {
+        const ssize_t result = ::write(m_fileDescriptor, data + position, size - position);
+
+        if (result > 0)
+        {
+            position += static_cast<size_t>(result);
+        }
+        else if ((result < 0) && (errno == EINTR))
+        {
+            // Interrupted by a signal, try again
+        }
+        else
+        {
+            // Error
+            success = false;
+        }
+    }
+
+    return success;
+}
+#endif
+
+/**
+ * Constructor
+ *
+ * \param callback      Function that receives the data
+ * \param userData      User data that is passed to the callback
+ * \param bufferSize    Size of the buffer
+ */
+CallbackOutputStream::CallbackOutputStream(Callback callback,
+                                           void *userData,
+                                           const size_t bufferSize)
+    : AbstractXmlOutputStream(bufferSize),
+      m_callback(callback),
+      m_userData(userData)
+{
+}
+
+/**
+ * Destructor
+ */
+CallbackOutputStream::~CallbackOutputStream()
+{
+    static_cast<void>(flush());
+}
+
+/**
+ * Pass data to the callback
+ *
+ * \param data  Data
+ * \param size  Size of the data
+ *
+ * \retval true     Success
+ * \retval false    Error
+ */
+bool CallbackOutputStream::writeData(const char *data, const size_t size)
+{
+    bool success = false;
+
+    if (m_callback != NULL)
+    {
+        success = m_callback(data, size, m_userData);
+    }
+
+    return success;
+}
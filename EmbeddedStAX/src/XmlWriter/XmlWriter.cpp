@@ -38,19 +38,29 @@ using namespace EmbeddedStAX;
 
 /**
  * Constructor
+ *
+ * \param outputStream  Output stream (NULL to collect the document in memory)
  */
-XmlWriter::XmlWriter::XmlWriter()
+XmlWriter::XmlWriter::XmlWriter(AbstractXmlOutputStream *outputStream)
+    : m_state(State_Empty),
+      m_documentType(),
+      m_openedElementList(),
+      m_xmlString(),
+      m_outputStream(outputStream),
+      m_flushDepth(1U)
 {
     clearDocument();
 }
 
 /**
  * Clear XML document
+ *
+ * \note Data that was already written to the output stream is not affected
  */
 void XmlWriter::XmlWriter::clearDocument()
 {
     m_state = State_Empty;
-    m_documentType;
+    m_documentType.clear();
     m_openedElementList.clear();
     m_xmlString.clear();
 }
@@ -60,12 +70,80 @@ void XmlWriter::XmlWriter::clearDocument()
  *
  * \return XML string
  * \return Empty string on error
+ *
+ * \note The string is always empty when an output stream is set.
  */
 Common::UnicodeString XmlWriter::XmlWriter::xmlString() const
 {
     return m_xmlString;
 }
 
+/**
+ * Get output stream
+ *
+ * \return Output stream or NULL if the document is collected in memory
+ */
+XmlWriter::AbstractXmlOutputStream *XmlWriter::XmlWriter::outputStream() const
+{
+    return m_outputStream;
+}
+
+/**
+ * Set output stream
+ *
+ * \param outputStream  Output stream (NULL to collect the document in memory)
+ *
+ * \note The document is cleared
+ */
+void XmlWriter::XmlWriter::setOutputStream(AbstractXmlOutputStream *outputStream)
+{
+    m_outputStream = outputStream;
+    clearDocument();
+}
+
+/**
+ * Get flush depth
+ *
+ * \return Flush depth
+ */
+size_t XmlWriter::XmlWriter::flushDepth() const
+{
+    return m_flushDepth;
+}
+
+/**
+ * Set flush depth
+ *
+ * \param flushDepth    Depth of the deepest element whose end flushes the output stream (1 for the
+ *                      root element, 0 to flush only when the buffer of the stream gets full)
+ *
+ * By default the output stream is flushed at the end of the root element so the whole document
+ * is passed to the sink when it is complete. A larger depth passes each closed element of that
+ * depth to the sink immediately, for example depth 2 for a stream of records in a root element.
+ */
+void XmlWriter::XmlWriter::setFlushDepth(const size_t flushDepth)
+{
+    m_flushDepth = flushDepth;
+}
+
+/**
+ * Flush the output stream
+ *
+ * \retval true     Success (or no output stream is set)
+ * \retval false    Error, output stream failed to write the data
+ */
+bool XmlWriter::XmlWriter::flush()
+{
+    bool success = true;
+
+    if (m_outputStream != NULL)
+    {
+        success = m_outputStream->flush();
+    }
+
+    return success;
+}
+
 /**
  * Write XML Declaration in the XML document
  *
@@ -84,9 +162,9 @@ bool XmlWriter::XmlWriter::writeXmlDeclaration()
         // TODO: add the "standalone" attribute?
 
         // Set XML Declaration
-        m_xmlString = Common::Utf8::toUnicodeString("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
-        m_state = State_DocumentStarted;
-        success = true;
+        write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>");
+        success = isOutputValid();
+        m_state = success ? State_DocumentStarted : State_Error;
     }
     else
     {
@@ -120,13 +198,13 @@ bool XmlWriter::XmlWriter::writeDocumentType(const Common::UnicodeString &docume
             if (XmlValidator::validateName(documentType))
             {
                 // Create Document Type
-                m_xmlString.append(Common::Utf8::toUnicodeString("<!DOCTYPE "));
-                m_xmlString.append(documentType);
-                m_xmlString.push_back(static_cast<uint32_t>('>'));
+                write("<!DOCTYPE ");
+                write(documentType);
+                write(static_cast<uint32_t>('>'));
 
                 m_documentType = documentType;
                 m_state = State_DocumentStarted;
-                success = true;
+                success = isOutputValid();
             }
         }
     }
@@ -183,9 +261,14 @@ bool XmlWriter::XmlWriter::writeComment(const Common::UnicodeString &commentText
     if (success)
     {
         // Write Comment
-        m_xmlString.append(Common::Utf8::toUnicodeString("<!--"));
-        m_xmlString.append(commentText);
-        m_xmlString.append(Common::Utf8::toUnicodeString("-->"));
+        write("<!--");
+        write(commentText);
+        write("-->");
+        success = isOutputValid();
+    }
+
+    if (success)
+    {
         m_state = nextState;
     }
     else
@@ -241,18 +324,23 @@ bool XmlWriter::XmlWriter::writeProcessingInstruction(const Common::ProcessingIn
     if (success)
     {
         // Write Processing Instruction
-        m_xmlString.append(Common::Utf8::toUnicodeString("<?"));
-        m_xmlString.append(pi.piTarget());
+        write("<?");
+        write(pi.piTarget());
 
         const Common::UnicodeString piData = pi.piData();
 
         if (!piData.empty())
         {
-            m_xmlString.push_back(static_cast<uint32_t>(' '));
-            m_xmlString.append(piData);
+            write(static_cast<uint32_t>(' '));
+            write(piData);
         }
 
-        m_xmlString.append(Common::Utf8::toUnicodeString("?>"));
+        write("?>");
+        success = isOutputValid();
+    }
+
+    if (success)
+    {
         m_state = nextState;
     }
     else
@@ -335,8 +423,8 @@ bool XmlWriter::XmlWriter::writeEmptyElement(const Common::UnicodeString &elemen
     if (success)
     {
         // Write Start of Element
-        m_xmlString.push_back(static_cast<uint32_t>('<'));
-        m_xmlString.append(elementName);
+        write(static_cast<uint32_t>('<'));
+        write(elementName);
 
         // Write Attributes
         success = writeAttributeList(attributeList);
@@ -344,8 +432,15 @@ bool XmlWriter::XmlWriter::writeEmptyElement(const Common::UnicodeString &elemen
         // Write end of Empty Element
         if (success)
         {
-            m_xmlString.append(Common::Utf8::toUnicodeString("/>"));
+            write("/>");
+            success = isOutputValid();
+        }
+
+        if (success)
+        {
             m_state = nextState;
+            flushEndOfElement(m_openedElementList.size() + 1U);
+            success = isOutputValid();
         }
     }
 
@@ -425,8 +520,8 @@ bool XmlWriter::XmlWriter::writeStartOfElement(const Common::UnicodeString &elem
     if (success)
     {
         // Write Start of Element
-        m_xmlString.push_back(static_cast<uint32_t>('<'));
-        m_xmlString.append(elementName);
+        write(static_cast<uint32_t>('<'));
+        write(elementName);
 
         // Write Attributes
         success = writeAttributeList(attributeList);
@@ -434,8 +529,12 @@ bool XmlWriter::XmlWriter::writeStartOfElement(const Common::UnicodeString &elem
         // Write end of Start of Element
         if (success)
         {
-            m_xmlString.push_back(static_cast<uint32_t>('>'));
+            write(static_cast<uint32_t>('>'));
+            success = isOutputValid();
+        }
 
+        if (success)
+        {
             m_openedElementList.push_back(elementName);
             m_state = State_Element;
         }
@@ -468,8 +567,8 @@ bool XmlWriter::XmlWriter::writeTextNode(const Common::UnicodeString &text)
 
         if (XmlValidator::validateTextNode(escapedText))
         {
-            m_xmlString.append(escapedText);
-            success = true;
+            write(escapedText);
+            success = isOutputValid();
         }
         else
         {
@@ -506,10 +605,10 @@ bool XmlWriter::XmlWriter::writeCDataSection(const Common::UnicodeString &cdata)
     {
         if (XmlValidator::validateCDataSection(cdata))
         {
-            m_xmlString.append(Common::Utf8::toUnicodeString("<![CDATA["));
-            m_xmlString.append(cdata);
-            m_xmlString.append(Common::Utf8::toUnicodeString("]]>"));
-            success = true;
+            write("<![CDATA[");
+            write(cdata);
+            write("]]>");
+            success = isOutputValid();
         }
     }
     else
@@ -545,10 +644,11 @@ bool XmlWriter::XmlWriter::writeEndOfElement()
         else
         {
             // Write End of Element
-            m_xmlString.append(Common::Utf8::toUnicodeString("</"));
-            m_xmlString.append(m_openedElementList.back());
+            write("</");
+            write(m_openedElementList.back());
             m_openedElementList.pop_back();
-            m_xmlString.push_back(static_cast<uint32_t>('>'));
+            write(static_cast<uint32_t>('>'));
+            flushEndOfElement(m_openedElementList.size() + 1U);
 
             // Check for end of root element
             if (m_openedElementList.empty())
@@ -556,7 +656,7 @@ bool XmlWriter::XmlWriter::writeEndOfElement()
                 m_state = State_DocumentEnded;
             }
 
-            success = true;
+            success = isOutputValid();
         }
     }
 
@@ -569,6 +669,91 @@ bool XmlWriter::XmlWriter::writeEndOfElement()
     return success;
 }
 
+/**
+ * Write a character to the document
+ *
+ * \param unicodeChar   Unicode character
+ */
+void XmlWriter::XmlWriter::write(const uint32_t unicodeChar)
+{
+    if (m_outputStream != NULL)
+    {
+        static_cast<void>(m_outputStream->write(unicodeChar));
+    }
+    else
+    {
+        m_xmlString.push_back(unicodeChar);
+    }
+}
+
+/**
+ * Write text to the document
+ *
+ * \param text  Text
+ */
+void XmlWriter::XmlWriter::write(const Common::UnicodeString &text)
+{
+    if (m_outputStream != NULL)
+    {
+        static_cast<void>(m_outputStream->write(text));
+    }
+    else
+    {
+        m_xmlString.append(text);
+    }
+}
+
+/**
+ * Write ASCII text to the document
+ *
+ * \param text  Null-terminated ASCII text
+ */
+void XmlWriter::XmlWriter::write(const char *text)
+{
+    if (m_outputStream != NULL)
+    {
+        static_cast<void>(m_outputStream->writeAscii(text));
+    }
+    else
+    {
+        for (size_t i = 0U; text[i] != '\0'; i++)
+        {
+            m_xmlString.push_back(static_cast<uint32_t>(static_cast<unsigned char>(text[i])));
+        }
+    }
+}
+
+/**
+ * Check if all of the written data was accepted by the output
+ *
+ * \retval true     Success (or no output stream is set)
+ * \retval false    Error, output stream is not valid
+ */
+bool XmlWriter::XmlWriter::isOutputValid() const
+{
+    bool valid = true;
+
+    if (m_outputStream != NULL)
+    {
+        valid = m_outputStream->isValid();
+    }
+
+    return valid;
+}
+
+/**
+ * Flush the output stream at the end of an element (if needed)
+ *
+ * \param depth Depth of the element that was closed (1 for the root element)
+ */
+void XmlWriter::XmlWriter::flushEndOfElement(const size_t depth)
+{
+    if ((m_outputStream != NULL) && (depth <= m_flushDepth))
+    {
+        static_cast<void>(m_outputStream->flush());
+    }
+}
+
 /**
  * Write Attribute List in the XML document
  *
@@ -606,12 +791,12 @@ bool XmlWriter::XmlWriter::writeAttributeList(const Common::AttributeList &attri
                     quoteChar = static_cast<uint32_t>('\'');
                 }
 
-                m_xmlString.push_back(static_cast<uint32_t>(' '));
-                m_xmlString.append(name);
-                m_xmlString.push_back(static_cast<uint32_t>('='));
-                m_xmlString.push_back(quoteChar);
-                m_xmlString.append(escapedValue);
-                m_xmlString.push_back(quoteChar);
+                write(static_cast<uint32_t>(' '));
+                write(name);
+                write(static_cast<uint32_t>('='));
+                write(quoteChar);
+                write(escapedValue);
+                write(quoteChar);
                 success = true;
             }
         }
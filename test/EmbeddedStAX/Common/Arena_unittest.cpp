@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/Common/Arena.h>
+#include <EmbeddedStAX/Common/ArenaAllocator.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <list>
+
+using namespace EmbeddedStAX::Common;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::Arena
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_Arena, ConstructorTest)
+{
+    const Arena arena(128U);
+
+    EXPECT_EQ(128U, arena.blockSize());
+    EXPECT_EQ(0U, arena.bytesAllocated());
+    EXPECT_EQ(0U, arena.capacity());
+}
+
+TEST(EmbeddedStAX_Common_Arena, AllocateTest)
+{
+    Arena arena(128U);
+
+    // Small allocations are taken from the same block
+    unsigned char *data1 = static_cast<unsigned char *>(arena.allocate(10U));
+    unsigned char *data2 = static_cast<unsigned char *>(arena.allocate(10U));
+
+    ASSERT_TRUE(data1 != NULL);
+    ASSERT_TRUE(data2 != NULL);
+    EXPECT_TRUE(data2 > data1);
+    EXPECT_EQ(0U, reinterpret_cast<size_t>(data2) % sizeof(void *));
+    EXPECT_EQ(128U, arena.capacity());
+
+    // Large allocation gets its own block
+    void *data3 = arena.allocate(1000U);
+
+    ASSERT_TRUE(data3 != NULL);
+    EXPECT_TRUE(arena.capacity() >= 1128U);
+    EXPECT_TRUE(arena.bytesAllocated() >= 1020U);
+}
+
+TEST(EmbeddedStAX_Common_Arena, ResetTest)
+{
+    Arena arena(128U);
+
+    void *data1 = arena.allocate(64U);
+    const size_t capacity = arena.capacity();
+    arena.reset();
+
+    // Blocks are kept and reused after reset
+    EXPECT_EQ(0U, arena.bytesAllocated());
+    EXPECT_EQ(capacity, arena.capacity());
+    EXPECT_EQ(data1, arena.allocate(64U));
+    EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(EmbeddedStAX_Common_Arena, ClearTest)
+{
+    Arena arena(128U);
+
+    arena.allocate(64U);
+    arena.allocate(1000U);
+    arena.clear();
+
+    EXPECT_EQ(0U, arena.bytesAllocated());
+    EXPECT_EQ(0U, arena.capacity());
+
+    EXPECT_TRUE(arena.allocate(64U) != NULL);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::ArenaAllocator
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_ArenaAllocator, ContainerTest)
+{
+    Arena arena(256U);
+    const ArenaAllocator<int> allocator(&arena);
+    std::list<int, ArenaAllocator<int> > list(allocator);
+
+    for (int i = 0; i < 10; i++)
+    {
+        list.push_back(i);
+    }
+
+    EXPECT_EQ(10U, list.size());
+    EXPECT_TRUE(arena.bytesAllocated() > 0U);
+    EXPECT_TRUE(list.get_allocator() == allocator);
+}
+
+TEST(EmbeddedStAX_Common_ArenaAllocator, UnicodeStringTest)
+{
+    Arena arena;
+    UnicodeString text = UnicodeString(UnicodeString::allocator_type(&arena));
+
+    text = Utf8::toUnicodeString("text in arena");
+
+    EXPECT_EQ(Utf8::toUnicodeString("text in arena"), text);
+    EXPECT_EQ(&arena, text.get_allocator().arena());
+    EXPECT_TRUE(arena.bytesAllocated() > 0U);
+
+    // Global allocator is used when no arena is set
+    const UnicodeString globalText = Utf8::toUnicodeString("text");
+
+    EXPECT_TRUE(globalText.get_allocator().arena() == NULL);
+}
+
+TEST(EmbeddedStAX_Common_ArenaAllocator, AttributeListTest)
+{
+    Arena arena;
+    const UnicodeString::allocator_type allocator(&arena);
+    AttributeList attributeList(allocator);
+
+    attributeList.add(Attribute(Utf8::toUnicodeString("name"), Utf8::toUnicodeString("value")));
+
+    const Attribute *attribute = attributeList.attribute(Utf8::toUnicodeString("name"));
+
+    ASSERT_TRUE(attribute != NULL);
+    EXPECT_EQ(&arena, attributeList.allocator().arena());
+    EXPECT_EQ(&arena, attribute->allocator().arena());
+    EXPECT_EQ(Utf8::toUnicodeString("value"), attribute->value());
+
+    // Swap exchanges the allocators
+    AttributeList globalAttributeList;
+    globalAttributeList.swap(attributeList);
+
+    EXPECT_EQ(&arena, globalAttributeList.allocator().arena());
+    EXPECT_TRUE(attributeList.allocator().arena() == NULL);
+    EXPECT_EQ(1U, globalAttributeList.size());
+    EXPECT_EQ(0U, attributeList.size());
+}
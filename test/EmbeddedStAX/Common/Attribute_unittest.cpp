@@ -93,6 +93,31 @@ TEST(EmbeddedStAX_Common_Attribute, AssignmentOperatorTest)
     EXPECT_EQ(qm, attribute2.valueQuotationMark());
 }
 
+#if __cplusplus >= 201103L
+TEST(EmbeddedStAX_Common_Attribute, MoveTest)
+{
+    const UnicodeString name = Utf8::toUnicodeString("name");
+    const UnicodeString value = Utf8::toUnicodeString("value");
+    const QuotationMark qm = QuotationMark_Apostrophe;
+
+    // Move constructor
+    Attribute attribute1(name, value, qm);
+    Attribute attribute2(std::move(attribute1));
+
+    EXPECT_EQ(name, attribute2.name());
+    EXPECT_EQ(value, attribute2.value());
+    EXPECT_EQ(qm, attribute2.valueQuotationMark());
+
+    // Move assignment
+    Attribute attribute3;
+    attribute3 = std::move(attribute2);
+
+    EXPECT_EQ(name, attribute3.name());
+    EXPECT_EQ(value, attribute3.value());
+    EXPECT_EQ(qm, attribute3.valueQuotationMark());
+}
+#endif
+
 TEST(EmbeddedStAX_Common_Attribute, ClearingTest)
 {
     const UnicodeString name = Utf8::toUnicodeString("name");
@@ -107,6 +132,41 @@ TEST(EmbeddedStAX_Common_Attribute, ClearingTest)
     EXPECT_EQ(attribute.valueQuotationMark(), QuotationMark_None);
 }
 
+TEST(EmbeddedStAX_Common_Attribute, RawValueTest)
+{
+    const UnicodeString name = Utf8::toUnicodeString("name");
+    const UnicodeString rawValue = Utf8::toUnicodeString("a &lt; b &#x41; &unknown;");
+    const UnicodeString value = Utf8::toUnicodeString("a < b A &unknown;");
+    const QuotationMark qm = QuotationMark_Apostrophe;
+
+    // Value without references is not copied
+    Attribute attribute(name, value, qm);
+
+    EXPECT_FALSE(attribute.valueHasReferences());
+    EXPECT_EQ(&attribute.rawValue(), &attribute.value());
+
+    // References are decoded on access
+    attribute.setRawValue(rawValue, qm, true);
+
+    EXPECT_TRUE(attribute.valueHasReferences());
+    EXPECT_EQ(rawValue, attribute.rawValue());
+    EXPECT_EQ(value, attribute.value());
+    EXPECT_EQ(qm, attribute.valueQuotationMark());
+
+    // Decoded value is kept in copies
+    const Attribute attribute2(attribute);
+
+    EXPECT_TRUE(attribute2.valueHasReferences());
+    EXPECT_EQ(rawValue, attribute2.rawValue());
+    EXPECT_EQ(value, attribute2.value());
+
+    // Setting a value discards the references
+    attribute.setValue(rawValue, qm);
+
+    EXPECT_FALSE(attribute.valueHasReferences());
+    EXPECT_EQ(rawValue, attribute.value());
+}
+
 //--------------------------------------------------------------------------------------------------
 // Test case: EmbeddedStAX::Common::AttributeList
 //--------------------------------------------------------------------------------------------------
@@ -309,3 +369,27 @@ TEST(EmbeddedStAX_Common_AttributeList, AssignmentOperatorTest)
         attributeIterator2++;
     }
 }
+
+#if __cplusplus >= 201103L
+TEST(EmbeddedStAX_Common_AttributeList, MoveTest)
+{
+    AttributeList attributeList1;
+    attributeList1.add(Attribute(Utf8::toUnicodeString("name1"), Utf8::toUnicodeString("value1")));
+    attributeList1.add(Attribute(Utf8::toUnicodeString("name2"), Utf8::toUnicodeString("value2")));
+
+    // Move constructor
+    AttributeList attributeList2(std::move(attributeList1));
+
+    EXPECT_EQ(2U, attributeList2.size());
+
+    // Move assignment
+    AttributeList attributeList3;
+    attributeList3 = std::move(attributeList2);
+
+    EXPECT_EQ(2U, attributeList3.size());
+    EXPECT_EQ(0U, attributeList2.size());
+    ASSERT_TRUE(attributeList3.attribute(Utf8::toUnicodeString("name2")) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("value2"),
+              attributeList3.attribute(Utf8::toUnicodeString("name2"))->value());
+}
+#endif
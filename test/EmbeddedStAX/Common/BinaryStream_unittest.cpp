@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/Common/BinaryStream.h>
+
+using namespace EmbeddedStAX::Common;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::BinaryWriter and EmbeddedStAX::Common::BinaryReader
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_BinaryStream, WriteAndReadTest)
+{
+    std::string data;
+    BinaryWriter writer(&data);
+
+    writer.writeByte(0xABU);
+    writer.writeNumber(0U);
+    writer.writeNumber(127U);
+    writer.writeNumber(300U);
+    writer.writeString(Utf8::toUnicodeString("a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80"));
+
+    // Byte, 1 + 1 + 2 byte numbers, string size and 10 bytes of UTF-8 data
+    EXPECT_EQ(16U, data.size());
+
+    BinaryReader reader(data.data(), data.size());
+    uint32_t byte = 0U;
+    size_t number = 0U;
+    UnicodeString text;
+
+    EXPECT_TRUE(reader.readByte(&byte));
+    EXPECT_EQ(0xABU, byte);
+    EXPECT_TRUE(reader.readNumber(&number));
+    EXPECT_EQ(0U, number);
+    EXPECT_TRUE(reader.readNumber(&number));
+    EXPECT_EQ(127U, number);
+    EXPECT_TRUE(reader.readNumber(&number));
+    EXPECT_EQ(300U, number);
+    EXPECT_TRUE(reader.readString(&text));
+    EXPECT_EQ(Utf8::toUnicodeString("a\xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80"), text);
+    EXPECT_TRUE(reader.isEndOfData());
+    EXPECT_FALSE(reader.readByte(&byte));
+}
+
+TEST(EmbeddedStAX_Common_BinaryStream, InvalidDataTest)
+{
+    UnicodeString text;
+    size_t number = 0U;
+
+    // Truncated number and string
+    BinaryReader reader1("\x80", 1U);
+    EXPECT_FALSE(reader1.readNumber(&number));
+
+    BinaryReader reader2("\x05" "ab", 3U);
+    EXPECT_FALSE(reader2.readString(&text));
+
+    // Invalid UTF-8 data
+    BinaryReader reader3("\x01\xFF", 2U);
+    EXPECT_FALSE(reader3.readString(&text));
+
+    // Raw data
+    BinaryReader reader4("ESX", 3U);
+    EXPECT_FALSE(reader4.readData("ESXC", 4U));
+    EXPECT_TRUE(reader4.readData("ES", 2U));
+    EXPECT_EQ(2U, reader4.position());
+}
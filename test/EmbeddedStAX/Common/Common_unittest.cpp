@@ -162,3 +162,36 @@ TEST(EmbeddedStAX_Common_Common_parseDigit, DigitValueNullTest)
     EXPECT_FALSE(parseDigit(static_cast<uint32_t>('0'), 10U, NULL));
     EXPECT_FALSE(parseDigit(static_cast<uint32_t>('0'), 16U, NULL));
 }
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::decodeReferences()
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_Common_decodeReferences, PositiveTest)
+{
+    UnicodeString output;
+
+    EXPECT_TRUE(decodeReferences(Utf8::toUnicodeString("&amp;&lt;&gt;&apos;&quot;"), &output));
+    EXPECT_EQ(Utf8::toUnicodeString("&<>'\""), output);
+
+    EXPECT_TRUE(decodeReferences(Utf8::toUnicodeString("a&#65;b&#x42;c"), &output));
+    EXPECT_EQ(Utf8::toUnicodeString("aAbBc"), output);
+
+    EXPECT_TRUE(decodeReferences(Utf8::toUnicodeString("&unknown; &ampx;"), &output));
+    EXPECT_EQ(Utf8::toUnicodeString("&unknown; &ampx;"), output);
+
+    EXPECT_TRUE(decodeReferences(UnicodeString(), &output));
+    EXPECT_EQ(UnicodeString(), output);
+}
+
+TEST(EmbeddedStAX_Common_Common_decodeReferences, NegativeTest)
+{
+    UnicodeString output;
+
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&amp"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&;"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&#;"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&#x;"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&#12a;"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&#x110000;"), &output));
+    EXPECT_FALSE(decodeReferences(Utf8::toUnicodeString("&amp;"), NULL));
+}
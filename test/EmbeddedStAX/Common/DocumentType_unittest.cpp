@@ -67,6 +67,25 @@ TEST(EmbeddedStAX_Common_DocumentType, AssignmentOperatorTest)
     EXPECT_EQ(name, documentType2.name());
 }
 
+#if __cplusplus >= 201103L
+TEST(EmbeddedStAX_Common_DocumentType, MoveTest)
+{
+    const UnicodeString name = Utf8::toUnicodeString("name");
+
+    // Move constructor
+    DocumentType documentType1(name);
+    DocumentType documentType2(std::move(documentType1));
+
+    EXPECT_EQ(name, documentType2.name());
+
+    // Move assignment
+    DocumentType documentType3;
+    documentType3 = std::move(documentType2);
+
+    EXPECT_EQ(name, documentType3.name());
+}
+#endif
+
 TEST(EmbeddedStAX_Common_DocumentType, ClearingTest)
 {
     const UnicodeString name = Utf8::toUnicodeString("name");
@@ -81,6 +81,28 @@ TEST(EmbeddedStAX_Common_ProcessingInstruction, AssignmentOperatorTest)
     EXPECT_EQ(data, pi2.piData());
 }
 
+#if __cplusplus >= 201103L
+TEST(EmbeddedStAX_Common_ProcessingInstruction, MoveTest)
+{
+    const UnicodeString piTarget = Utf8::toUnicodeString("piTarget");
+    const UnicodeString piData = Utf8::toUnicodeString("piData");
+
+    // Move constructor
+    ProcessingInstruction pi1(piTarget, piData);
+    ProcessingInstruction pi2(std::move(pi1));
+
+    EXPECT_EQ(piTarget, pi2.piTarget());
+    EXPECT_EQ(piData, pi2.piData());
+
+    // Move assignment
+    ProcessingInstruction pi3;
+    pi3 = std::move(pi2);
+
+    EXPECT_EQ(piTarget, pi3.piTarget());
+    EXPECT_EQ(piData, pi3.piData());
+}
+#endif
+
 TEST(EmbeddedStAX_Common_ProcessingInstruction, ClearingTest)
 {
     const UnicodeString target = Utf8::toUnicodeString("target");
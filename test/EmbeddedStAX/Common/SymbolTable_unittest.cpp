@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/Common/SymbolTable.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <sstream>
+
+using namespace EmbeddedStAX::Common;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::SymbolTable
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_SymbolTable, DefaultConstructorTest)
+{
+    const SymbolTable symbolTable;
+
+    EXPECT_EQ(0U, symbolTable.size());
+    EXPECT_EQ(SymbolTable::InvalidSymbol, symbolTable.find(Utf8::toUnicodeString("name")));
+    EXPECT_EQ(UnicodeString(), symbolTable.symbol(0U));
+}
+
+TEST(EmbeddedStAX_Common_SymbolTable, AddingTest)
+{
+    SymbolTable symbolTable;
+    const UnicodeString name1 = Utf8::toUnicodeString("name1");
+    const UnicodeString name2 = Utf8::toUnicodeString("name2");
+
+    EXPECT_EQ(0U, symbolTable.add(name1));
+    EXPECT_EQ(1U, symbolTable.add(name2));
+    EXPECT_EQ(0U, symbolTable.add(name1));
+    EXPECT_EQ(2U, symbolTable.size());
+
+    EXPECT_EQ(0U, symbolTable.find(name1));
+    EXPECT_EQ(1U, symbolTable.find(name2));
+    EXPECT_EQ(name1, symbolTable.symbol(0U));
+    EXPECT_EQ(name2, symbolTable.symbol(1U));
+    EXPECT_EQ(UnicodeString(), symbolTable.symbol(2U));
+}
+
+TEST(EmbeddedStAX_Common_SymbolTable, RehashTest)
+{
+    SymbolTable symbolTable;
+
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        std::stringstream name;
+        name << "name" << i;
+        EXPECT_EQ(i, symbolTable.add(Utf8::toUnicodeString(name.str())));
+    }
+
+    EXPECT_EQ(1000U, symbolTable.size());
+
+    for (uint32_t i = 0U; i < 1000U; i++)
+    {
+        std::stringstream name;
+        name << "name" << i;
+        EXPECT_EQ(i, symbolTable.find(Utf8::toUnicodeString(name.str())));
+    }
+}
+
+TEST(EmbeddedStAX_Common_SymbolTable, ClearingTest)
+{
+    SymbolTable symbolTable;
+    symbolTable.add(Utf8::toUnicodeString("name"));
+    symbolTable.clear();
+
+    EXPECT_EQ(0U, symbolTable.size());
+    EXPECT_EQ(SymbolTable::InvalidSymbol, symbolTable.find(Utf8::toUnicodeString("name")));
+    EXPECT_EQ(0U, symbolTable.add(Utf8::toUnicodeString("other")));
+}
+
+TEST(EmbeddedStAX_Common_SymbolTable, BaseTableTest)
+{
+    SymbolTable baseTable;
+    const UnicodeString name1 = Utf8::toUnicodeString("name1");
+    const UnicodeString name2 = Utf8::toUnicodeString("name2");
+    const UnicodeString name3 = Utf8::toUnicodeString("name3");
+
+    baseTable.add(name1);
+    baseTable.add(name2);
+
+    SymbolTable symbolTable;
+    symbolTable.setBaseTable(&baseTable);
+
+    EXPECT_EQ(&baseTable, symbolTable.baseTable());
+    EXPECT_EQ(2U, symbolTable.size());
+
+    // Symbols of the base table keep their IDs and they are not added again
+    EXPECT_EQ(1U, symbolTable.add(name2));
+    EXPECT_EQ(0U, symbolTable.find(name1));
+    EXPECT_EQ(2U, symbolTable.size());
+
+    // New symbols follow the symbols of the base table
+    EXPECT_EQ(2U, symbolTable.add(name3));
+    EXPECT_EQ(2U, symbolTable.find(name3));
+    EXPECT_EQ(3U, symbolTable.size());
+    EXPECT_EQ(name1, symbolTable.symbol(0U));
+    EXPECT_EQ(name3, symbolTable.symbol(2U));
+    EXPECT_EQ(UnicodeString(), symbolTable.symbol(3U));
+
+    // Base table is not modified
+    EXPECT_EQ(2U, baseTable.size());
+    EXPECT_EQ(SymbolTable::InvalidSymbol, baseTable.find(name3));
+
+    // Clearing keeps the base table
+    symbolTable.clear();
+
+    EXPECT_EQ(2U, symbolTable.size());
+    EXPECT_EQ(SymbolTable::InvalidSymbol, symbolTable.find(name3));
+    EXPECT_EQ(1U, symbolTable.find(name2));
+}
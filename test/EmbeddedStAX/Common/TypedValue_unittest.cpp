@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/Common/Attribute.h>
+#include <EmbeddedStAX/Common/TypedValue.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <math.h>
+
+using namespace EmbeddedStAX::Common;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::Common::TypedValue
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_Common_TypedValue, ParseInt64Test)
+{
+    int64_t result = 0;
+
+    EXPECT_TRUE(parseInt64(Utf8::toUnicodeString("1234"), &result));
+    EXPECT_EQ(1234, result);
+    EXPECT_TRUE(parseInt64(Utf8::toUnicodeString(" \t-42\n"), &result));
+    EXPECT_EQ(-42, result);
+    EXPECT_TRUE(parseInt64(Utf8::toUnicodeString("+7"), &result));
+    EXPECT_EQ(7, result);
+    EXPECT_TRUE(parseInt64(Utf8::toUnicodeString("9223372036854775807"), &result));
+    EXPECT_EQ(INT64_MAX, result);
+    EXPECT_TRUE(parseInt64(Utf8::toUnicodeString("-9223372036854775808"), &result));
+    EXPECT_EQ(INT64_MIN, result);
+
+    // Invalid values
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("9223372036854775808"), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("-9223372036854775809"), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString(""), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("-"), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("12a"), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("1 2"), &result));
+    EXPECT_FALSE(parseInt64(Utf8::toUnicodeString("1"), NULL));
+}
+
+TEST(EmbeddedStAX_Common_TypedValue, ParseDoubleTest)
+{
+    double result = 0.0;
+
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("1.5"), &result));
+    EXPECT_EQ(1.5, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString(" -0.1 "), &result));
+    EXPECT_EQ(-0.1, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("12.5E-3"), &result));
+    EXPECT_EQ(12.5E-3, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString(".5e+2"), &result));
+    EXPECT_EQ(50.0, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("3."), &result));
+    EXPECT_EQ(3.0, result);
+
+    // Values that are converted with strtod()
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("1.7976931348623157e308"), &result));
+    EXPECT_EQ(1.7976931348623157e308, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("0.1234567890123456789012345"), &result));
+    EXPECT_EQ(0.1234567890123456789012345, result);
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("-INF"), &result));
+    EXPECT_TRUE(isinf(result) && (result < 0.0));
+    EXPECT_TRUE(parseDouble(Utf8::toUnicodeString("NaN"), &result));
+    EXPECT_TRUE(isnan(result));
+
+    // Invalid values
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString(""), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("."), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("1e"), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("1e 2"), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("1.2.3"), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("-NaN"), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("inf"), &result));
+    EXPECT_FALSE(parseDouble(Utf8::toUnicodeString("0x10"), &result));
+}
+
+TEST(EmbeddedStAX_Common_TypedValue, ParseBoolTest)
+{
+    bool result = false;
+
+    EXPECT_TRUE(parseBool(Utf8::toUnicodeString("true"), &result));
+    EXPECT_TRUE(result);
+    EXPECT_TRUE(parseBool(Utf8::toUnicodeString(" 0 "), &result));
+    EXPECT_FALSE(result);
+    EXPECT_TRUE(parseBool(Utf8::toUnicodeString("1"), &result));
+    EXPECT_TRUE(result);
+    EXPECT_TRUE(parseBool(Utf8::toUnicodeString("false"), &result));
+    EXPECT_FALSE(result);
+
+    EXPECT_FALSE(parseBool(Utf8::toUnicodeString("TRUE"), &result));
+    EXPECT_FALSE(parseBool(Utf8::toUnicodeString("yes"), &result));
+    EXPECT_FALSE(parseBool(Utf8::toUnicodeString(""), &result));
+}
+
+TEST(EmbeddedStAX_Common_TypedValue, ParseTimestampTest)
+{
+    Timestamp result;
+
+    EXPECT_TRUE(parseTimestamp(Utf8::toUnicodeString("1970-01-01T00:00:00Z"), &result));
+    EXPECT_EQ(0, result.seconds);
+    EXPECT_EQ(0U, result.nanoseconds);
+
+    EXPECT_TRUE(parseTimestamp(Utf8::toUnicodeString("2024-02-29T12:34:56.789Z"), &result));
+    EXPECT_EQ(1709210096, result.seconds);
+    EXPECT_EQ(789000000U, result.nanoseconds);
+
+    EXPECT_TRUE(parseTimestamp(Utf8::toUnicodeString("2024-02-29T14:34:56+02:00"), &result));
+    EXPECT_EQ(1709210096, result.seconds);
+
+    EXPECT_TRUE(parseTimestamp(Utf8::toUnicodeString("1969-12-31T23:59:59.0000000015-00:30"),
+                               &result));
+    EXPECT_EQ(1799, result.seconds);
+    EXPECT_EQ(1U, result.nanoseconds);
+
+    // Invalid values
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2023-02-29T00:00:00Z"), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-13-01T00:00:00Z"), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-01-01T24:00:00Z"), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-01-01 00:00:00Z"), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-01-01T00:00:00."), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-01-01T00:00:00+0200"), &result));
+    EXPECT_FALSE(parseTimestamp(Utf8::toUnicodeString("2024-01-01T00:00:00Zx"), &result));
+}
+
+TEST(EmbeddedStAX_Common_TypedValue, AttributeTest)
+{
+    const Attribute attribute(Utf8::toUnicodeString("value"), Utf8::toUnicodeString("-15"));
+    int64_t intValue = 0;
+    double doubleValue = 0.0;
+    bool boolValue = true;
+
+    EXPECT_TRUE(attribute.valueAsInt64(&intValue));
+    EXPECT_EQ(-15, intValue);
+    EXPECT_TRUE(attribute.valueAsDouble(&doubleValue));
+    EXPECT_EQ(-15.0, doubleValue);
+    EXPECT_FALSE(attribute.valueAsBool(&boolValue));
+
+    // References are decoded before parsing
+    Attribute referenceAttribute;
+    referenceAttribute.setRawValue(Utf8::toUnicodeString("&#x31;"), QuotationMark_Quote, true);
+
+    EXPECT_TRUE(referenceAttribute.valueAsBool(&boolValue));
+    EXPECT_TRUE(boolValue);
+}
@@ -95,6 +95,24 @@ TEST(EmbeddedStAX_Common_XmlDeclaration, AssignmentOperatorTest)
     EXPECT_EQ(standalone, xmlDeclaration2.standalone());
 }
 
+TEST(EmbeddedStAX_Common_XmlDeclaration, SwapTest)
+{
+    XmlDeclaration xmlDeclaration1(XmlDeclaration::Version_v1_0,
+                                   XmlDeclaration::Encoding_Utf8,
+                                   XmlDeclaration::Standalone_Yes);
+    XmlDeclaration xmlDeclaration2;
+
+    xmlDeclaration1.swap(xmlDeclaration2);
+
+    EXPECT_EQ(XmlDeclaration::Version_None, xmlDeclaration1.version());
+    EXPECT_EQ(XmlDeclaration::Encoding_None, xmlDeclaration1.encoding());
+    EXPECT_EQ(XmlDeclaration::Standalone_None, xmlDeclaration1.standalone());
+
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, xmlDeclaration2.version());
+    EXPECT_EQ(XmlDeclaration::Encoding_Utf8, xmlDeclaration2.encoding());
+    EXPECT_EQ(XmlDeclaration::Standalone_Yes, xmlDeclaration2.standalone());
+}
+
 TEST(EmbeddedStAX_Common_XmlDeclaration, ClearingTest)
 {
     const XmlDeclaration::Version version = XmlDeclaration::Version_v1_0;
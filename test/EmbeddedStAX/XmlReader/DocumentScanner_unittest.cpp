@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/DocumentScanner.h>
+#include <string>
+
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::DocumentScanner
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_DocumentScanner, ScanTest)
+{
+    const std::string document1 = "<?xml version=\"1.0\"?>\n"
+                                  "<!DOCTYPE a [<!ENTITY e \"</a>\">]>"
+                                  "<a x='</a>' y=\"/>\"><!-- </a> --><![CDATA[</a>]]>"
+                                  "<?pi </a> ?><b/><c>text > </c></a>";
+    const std::string document2 = "\n<!--c--><d/>";
+    const std::string document3 = "<e><e></e></e>";
+    const std::string data = document1 + document2 + document3 + "\n<f>incomplete";
+
+    DocumentScanner scanner;
+    ASSERT_TRUE(scanner.scan(data.data(), data.size()));
+    ASSERT_EQ(3U, scanner.documentCount());
+
+    EXPECT_EQ(0U, scanner.document(0U)->position);
+    EXPECT_EQ(document1.size(), scanner.document(0U)->size);
+    EXPECT_EQ(document1.size() + 1U, scanner.document(1U)->position);
+    EXPECT_EQ(document2.size() - 1U, scanner.document(1U)->size);
+    EXPECT_EQ(document3.size(), scanner.document(2U)->size);
+    EXPECT_TRUE(scanner.document(3U) == NULL);
+    EXPECT_EQ(document1.size() + document2.size() + document3.size(), scanner.scannedSize());
+
+    // Documents are found regardless of where the data is cut
+    for (size_t size = 0U; size <= data.size(); size++)
+    {
+        ASSERT_TRUE(scanner.scan(data.data(), size));
+
+        if (size < document1.size())
+        {
+            EXPECT_EQ(0U, scanner.documentCount());
+        }
+        else if (size < (document1.size() + document2.size()))
+        {
+            EXPECT_EQ(1U, scanner.documentCount());
+        }
+        else
+        {
+            EXPECT_TRUE(scanner.documentCount() >= 2U);
+        }
+    }
+
+    scanner.clear();
+    EXPECT_EQ(0U, scanner.documentCount());
+    EXPECT_EQ(0U, scanner.scannedSize());
+}
+
+TEST(EmbeddedStAX_XmlReader_DocumentScanner, ErrorTest)
+{
+    const std::string data = "<a/><b></b></c><d/>";
+
+    DocumentScanner scanner;
+    EXPECT_FALSE(scanner.scan(data.data(), data.size()));
+    EXPECT_EQ(2U, scanner.documentCount());
+    EXPECT_EQ(11U, scanner.scannedSize());
+
+    EXPECT_FALSE(scanner.scan(NULL, 1U));
+    EXPECT_TRUE(scanner.scan(NULL, 0U));
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/EventBuffer.h>
+#include <EmbeddedStAX/Common/Utf.h>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::EventBuffer
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_EventBuffer, ConstructorTest)
+{
+    const EventBuffer eventBuffer(16U);
+
+    EXPECT_EQ(16U, eventBuffer.capacity());
+    EXPECT_EQ(0U, eventBuffer.size());
+    EXPECT_TRUE(eventBuffer.isEmpty());
+    EXPECT_FALSE(eventBuffer.isFull());
+    EXPECT_TRUE(eventBuffer.event(0U) == NULL);
+}
+
+TEST(EmbeddedStAX_XmlReader_EventBuffer, ParseBatchTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?>"
+                                 "<?target data?>"
+                                 "<!--comment-->"
+                                 "<root a1='v1' a2=\"v2\">"
+                                 "text<![CDATA[cdata]]>"
+                                 "<root/>"
+                                 "</root>";
+    XmlReader xmlReader;
+    EventBuffer eventBuffer;
+
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parseBatch(&eventBuffer));
+    ASSERT_EQ(10U, eventBuffer.size());
+
+    // XML declaration
+    const EventBuffer::Event *event = eventBuffer.event(0U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, event->type);
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, eventBuffer.xmlDeclaration().version());
+
+    // Processing instruction
+    event = eventBuffer.event(1U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_ProcessingInstruction, event->type);
+    EXPECT_EQ(Utf8::toUnicodeString("target"), eventBuffer.name(*event));
+
+    // Comment
+    event = eventBuffer.event(2U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, event->type);
+    EXPECT_EQ(Utf8::toUnicodeString("comment"), eventBuffer.text(*event));
+
+    // Start of element
+    event = eventBuffer.event(3U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, event->type);
+    EXPECT_EQ(Utf8::toUnicodeString("root"), eventBuffer.name(*event));
+    ASSERT_EQ(2U, event->attributeCount);
+
+    const EventBuffer::AttributeRecord *attribute = eventBuffer.attribute(*event, 1U);
+    ASSERT_TRUE(attribute != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("a2"), eventBuffer.name(*attribute));
+    EXPECT_EQ(Utf8::toUnicodeString("v2"), eventBuffer.value(*attribute));
+    EXPECT_EQ(QuotationMark_Quote, attribute->quotationMark);
+    EXPECT_TRUE(eventBuffer.attribute(*event, 2U) == NULL);
+
+    // Text node and CDATA
+    event = eventBuffer.event(4U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, event->type);
+    EXPECT_EQ(Utf8::toUnicodeString("text"), eventBuffer.text(*event));
+
+    event = eventBuffer.event(5U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_CData, event->type);
+    EXPECT_EQ(Utf8::toUnicodeString("cdata"), eventBuffer.text(*event));
+
+    // Empty element (same name as the root element so it has the same symbol)
+    event = eventBuffer.event(6U);
+    ASSERT_TRUE(event != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, event->type);
+    EXPECT_EQ(eventBuffer.event(3U)->symbol, event->symbol);
+    EXPECT_EQ(0U, event->attributeCount);
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, eventBuffer.event(7U)->type);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, eventBuffer.event(8U)->type);
+    EXPECT_EQ(Utf8::toUnicodeString("root"), eventBuffer.name(*eventBuffer.event(8U)));
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, eventBuffer.event(9U)->type);
+}
+
+TEST(EmbeddedStAX_XmlReader_EventBuffer, CapacityTest)
+{
+    const std::string document = "<root><a/><b/><c/></root>";
+    XmlReader xmlReader;
+    EventBuffer eventBuffer(3U);
+
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+
+    // First batch fills the buffer
+    EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader.parseBatch(&eventBuffer));
+    EXPECT_TRUE(eventBuffer.isFull());
+    EXPECT_EQ(3U, eventBuffer.size());
+
+    const uint32_t rootSymbol = eventBuffer.event(0U)->symbol;
+
+    // Next batches continue where the previous one stopped, symbols are kept
+    eventBuffer.clear();
+    EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader.parseBatch(&eventBuffer));
+    EXPECT_EQ(3U, eventBuffer.size());
+
+    eventBuffer.clear();
+    EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader.parseBatch(&eventBuffer));
+    ASSERT_EQ(3U, eventBuffer.size());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, eventBuffer.event(1U)->type);
+    EXPECT_EQ(rootSymbol, eventBuffer.event(1U)->symbol);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, eventBuffer.event(2U)->type);
+
+    eventBuffer.clear();
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parseBatch(&eventBuffer));
+    EXPECT_TRUE(eventBuffer.isEmpty());
+}
+
+TEST(EmbeddedStAX_XmlReader_EventBuffer, ErrorTest)
+{
+    const std::string document = "<root></other>";
+    XmlReader xmlReader;
+    EventBuffer eventBuffer;
+
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+    EXPECT_EQ(XmlReader::ParsingResult_Error, xmlReader.parseBatch(&eventBuffer));
+    EXPECT_EQ(1U, eventBuffer.size());
+    EXPECT_EQ(XmlReader::ParsingResult_Error, xmlReader.parseBatch(NULL));
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/EventPlayer.h>
+#include <EmbeddedStAX/XmlReader/EventRecorder.h>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::EventRecorder and EmbeddedStAX::XmlReader::EventPlayer
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_EventRecorder, RecordAndReplayTest)
+{
+    const std::string document = "<?xml version=\"1.0\" standalone=\"yes\"?><!DOCTYPE root>"
+                                 "<root a='1' b=\"&lt;\xC3\xA4\"><!--c--><x/>t&amp;"
+                                 "<![CDATA[d]]><?pi data?><x/></root>";
+
+    XmlReader xmlReader;
+    EventRecorder recorder;
+
+    xmlReader.writeData(document);
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, recorder.record(&xmlReader));
+    EXPECT_EQ(13U, recorder.eventCount());
+
+    EventPlayer player;
+    ASSERT_TRUE(player.open(recorder.data().data(), recorder.data().size()));
+
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, player.parse());
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, player.xmlDeclaration().version());
+    EXPECT_EQ(XmlDeclaration::Standalone_Yes, player.xmlDeclaration().standalone());
+
+    EXPECT_EQ(XmlReader::ParsingResult_DocumentType, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), player.documentType().name());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), player.name());
+    ASSERT_EQ(2U, player.attributeList().size());
+    AttributeList::ConstIterator it = player.attributeList().begin();
+    EXPECT_EQ(Utf8::toUnicodeString("a"), it->name());
+    EXPECT_EQ(Utf8::toUnicodeString("1"), it->value());
+    ++it;
+    EXPECT_EQ(Utf8::toUnicodeString("<\xC3\xA4"), it->value());
+    EXPECT_EQ(QuotationMark_Quote, it->valueQuotationMark());
+
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("c"), player.text());
+    EXPECT_EQ(0U, player.attributeList().size());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("x"), player.name());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("x"), player.name());
+
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("t&"), player.text());
+    EXPECT_EQ(XmlReader::ParsingResult_CData, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("d"), player.text());
+
+    EXPECT_EQ(XmlReader::ParsingResult_ProcessingInstruction, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("pi"), player.processingInstruction().piTarget());
+    EXPECT_EQ(Utf8::toUnicodeString(" data"), player.processingInstruction().piData());
+
+    // Repeated name is read from the dictionary
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("x"), player.name());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, player.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, player.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), player.name());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, player.parse());
+
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, player.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, player.lastParsingResult());
+}
+
+TEST(EmbeddedStAX_XmlReader_EventRecorder, InvalidRecordingTest)
+{
+    XmlReader xmlReader;
+    EventRecorder recorder;
+    EventPlayer player;
+
+    // Invalid header
+    EXPECT_FALSE(player.open("XML", 3U));
+    EXPECT_EQ(XmlReader::ParsingResult_Error, player.parse());
+
+    // Truncated recording (end of document and the name of the end of element are cut off)
+    xmlReader.writeData("<root>text</root>");
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, recorder.record(&xmlReader));
+
+    const std::string data = recorder.data();
+    ASSERT_TRUE(player.open(data.data(), data.size() - 2U));
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, player.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, player.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_Error, player.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_Error, player.parse());
+
+    // Clear starts a new recording
+    recorder.clear();
+    EXPECT_EQ(0U, recorder.eventCount());
+    EXPECT_EQ(4U, recorder.data().size());
+
+    // Parsing error is returned
+    xmlReader.startNewDocument();
+    xmlReader.writeData("<a></b>");
+    EXPECT_EQ(XmlReader::ParsingResult_Error, recorder.record(&xmlReader));
+}
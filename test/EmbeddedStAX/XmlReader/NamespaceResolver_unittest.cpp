@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/NamespaceResolver.h>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::NamespaceResolver
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_NamespaceResolver, PredefinedTest)
+{
+    NamespaceResolver resolver;
+    ExpandedName name;
+
+    EXPECT_TRUE(resolver.namespaceUri(NamespaceResolver::NoNamespace).empty());
+    EXPECT_EQ(Utf8::toUnicodeString("http://www.w3.org/XML/1998/namespace"),
+              resolver.namespaceUri(NamespaceResolver::XmlNamespace));
+    EXPECT_EQ(Utf8::toUnicodeString("http://www.w3.org/2000/xmlns/"),
+              resolver.namespaceUri(NamespaceResolver::XmlnsNamespace));
+
+    // Names without a prefix and with the "xml" prefix can be resolved without any declarations
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("root"), &name));
+    EXPECT_EQ(NamespaceResolver::NoNamespace, name.namespaceId);
+    EXPECT_EQ(Utf8::toUnicodeString("root"), resolver.localName(name.localNameId));
+
+    EXPECT_TRUE(resolver.resolveAttributeName(Utf8::toUnicodeString("xml:lang"), &name));
+    EXPECT_EQ(NamespaceResolver::XmlNamespace, name.namespaceId);
+    EXPECT_EQ(Utf8::toUnicodeString("lang"), resolver.localName(name.localNameId));
+
+    EXPECT_TRUE(resolver.resolveAttributeName(Utf8::toUnicodeString("xmlns"), &name));
+    EXPECT_EQ(NamespaceResolver::XmlnsNamespace, name.namespaceId);
+
+    // Invalid names
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString("xmlns:a"), &name));
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString("a:b"), &name));
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString(":b"), &name));
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString("xml:"), &name));
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString("xml:a:b"), &name));
+}
+
+TEST(EmbeddedStAX_XmlReader_NamespaceResolver, ScopeTest)
+{
+    NamespaceResolver resolver;
+    ExpandedName name;
+    const UnicodeString uriA = Utf8::toUnicodeString("urn:a");
+    const UnicodeString uriB = Utf8::toUnicodeString("urn:b");
+
+    // Declaration needs a scope
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("a"), uriA));
+
+    resolver.startScope();
+    EXPECT_TRUE(resolver.declare(Utf8::toUnicodeString("a"), uriA));
+    EXPECT_TRUE(resolver.declare(UnicodeString(), uriA));
+    const uint32_t nsA = resolver.findNamespace(uriA);
+
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("a:x"), &name));
+    EXPECT_EQ(nsA, name.namespaceId);
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("x"), &name));
+    EXPECT_EQ(nsA, name.namespaceId);
+    EXPECT_TRUE(resolver.resolveAttributeName(Utf8::toUnicodeString("x"), &name));
+    EXPECT_EQ(NamespaceResolver::NoNamespace, name.namespaceId);
+
+    // Nested scope overrides the prefix and undeclares the default namespace
+    resolver.startScope();
+    EXPECT_TRUE(resolver.declare(Utf8::toUnicodeString("a"), uriB));
+    EXPECT_TRUE(resolver.declare(UnicodeString(), UnicodeString()));
+    EXPECT_EQ(2U, resolver.scopeDepth());
+
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("a:x"), &name));
+    EXPECT_EQ(resolver.findNamespace(uriB), name.namespaceId);
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("x"), &name));
+    EXPECT_EQ(NamespaceResolver::NoNamespace, name.namespaceId);
+
+    resolver.endScope();
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("a:x"), &name));
+    EXPECT_EQ(nsA, name.namespaceId);
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("x"), &name));
+    EXPECT_EQ(nsA, name.namespaceId);
+
+    // Reset ends all of the scopes but keeps the IDs
+    resolver.reset();
+    EXPECT_EQ(0U, resolver.scopeDepth());
+    EXPECT_FALSE(resolver.resolveElementName(Utf8::toUnicodeString("a:x"), &name));
+    EXPECT_EQ(nsA, resolver.findNamespace(uriA));
+}
+
+TEST(EmbeddedStAX_XmlReader_NamespaceResolver, InvalidDeclarationTest)
+{
+    NamespaceResolver resolver;
+    resolver.startScope();
+
+    EXPECT_TRUE(resolver.declare(Utf8::toUnicodeString("xml"),
+                                 Utf8::toUnicodeString("http://www.w3.org/XML/1998/namespace")));
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("xml"), Utf8::toUnicodeString("urn:a")));
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("xmlns"), Utf8::toUnicodeString("urn:a")));
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("a"),
+                                  Utf8::toUnicodeString("http://www.w3.org/2000/xmlns/")));
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("a"), UnicodeString()));
+}
+
+TEST(EmbeddedStAX_XmlReader_NamespaceResolver, BaseResolverTest)
+{
+    NamespaceResolver baseResolver;
+    const uint32_t namespaceId = baseResolver.addNamespace(Utf8::toUnicodeString("urn:a"));
+    const uint32_t localNameId = baseResolver.addLocalName(Utf8::toUnicodeString("item"));
+
+    NamespaceResolver resolver(&baseResolver);
+    ExpandedName name;
+
+    // Predefined and base names keep their IDs
+    EXPECT_EQ(Utf8::toUnicodeString("http://www.w3.org/XML/1998/namespace"),
+              resolver.namespaceUri(NamespaceResolver::XmlNamespace));
+    EXPECT_EQ(namespaceId, resolver.findNamespace(Utf8::toUnicodeString("urn:a")));
+    EXPECT_EQ(localNameId, resolver.findLocalName(Utf8::toUnicodeString("item")));
+
+    resolver.startScope();
+    EXPECT_TRUE(resolver.declare(Utf8::toUnicodeString("a"), Utf8::toUnicodeString("urn:a")));
+    EXPECT_TRUE(resolver.declare(Utf8::toUnicodeString("b"), Utf8::toUnicodeString("urn:b")));
+
+    EXPECT_TRUE(resolver.resolveElementName(Utf8::toUnicodeString("a:item"), &name));
+    EXPECT_EQ(namespaceId, name.namespaceId);
+    EXPECT_EQ(localNameId, name.localNameId);
+
+    EXPECT_TRUE(resolver.resolveAttributeName(Utf8::toUnicodeString("b:other"), &name));
+    EXPECT_EQ(Utf8::toUnicodeString("urn:b"), resolver.namespaceUri(name.namespaceId));
+    EXPECT_EQ(Utf8::toUnicodeString("other"), resolver.localName(name.localNameId));
+
+    EXPECT_TRUE(resolver.resolveAttributeName(Utf8::toUnicodeString("xml:lang"), &name));
+    EXPECT_EQ(NamespaceResolver::XmlNamespace, name.namespaceId);
+    EXPECT_FALSE(resolver.declare(Utf8::toUnicodeString("xmlns"), Utf8::toUnicodeString("urn:c")));
+    resolver.endScope();
+
+    // Names that were added to the layered resolver are not added to the base resolver
+    EXPECT_EQ(SymbolTable::InvalidSymbol,
+              baseResolver.findNamespace(Utf8::toUnicodeString("urn:b")));
+    EXPECT_EQ(SymbolTable::InvalidSymbol,
+              baseResolver.findLocalName(Utf8::toUnicodeString("other")));
+}
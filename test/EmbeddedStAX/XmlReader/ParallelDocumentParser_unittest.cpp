@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/ParallelDocumentParser.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+#include <vector>
+
+#if (__cplusplus >= 201103L)
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+class DocumentCollector
+{
+public:
+    DocumentCollector()
+        : m_events(),
+          m_indexes(),
+          m_stopAfter(0U)
+    {
+    }
+
+    bool onDocument(const size_t index, EventPlayer &player)
+    {
+        m_indexes.push_back(index);
+
+        for (XmlReader::ParsingResult result = player.parse();
+             result != XmlReader::ParsingResult_NeedMoreData;
+             result = player.parse())
+        {
+            std::string event = std::to_string(static_cast<int>(result));
+
+            if ((result == XmlReader::ParsingResult_StartOfElement) ||
+                (result == XmlReader::ParsingResult_EndOfElement))
+            {
+                event += ":" + Utf8::toUtf8(player.name());
+            }
+            else if (result == XmlReader::ParsingResult_TextNode)
+            {
+                event += ":" + Utf8::toUtf8(player.text());
+            }
+
+            m_events.push_back(event);
+        }
+
+        return (m_indexes.size() != m_stopAfter);
+    }
+
+    std::vector<std::string> m_events;
+    std::vector<size_t> m_indexes;
+    size_t m_stopAfter;
+};
+
+std::string makeDocument(const size_t index)
+{
+    const std::string number = std::to_string(index);
+    return "<?xml version=\"1.0\"?>\n<doc id='" + number + "'><n>" + number + "</n><e/></doc>\n";
+}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::ParallelDocumentParser
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_ParallelDocumentParser, SameAsXmlReaderTest)
+{
+    const size_t documentCount = 200U;
+    std::string data;
+
+    for (size_t i = 0U; i < documentCount; i++)
+    {
+        data += makeDocument(i);
+    }
+
+    // Parse the documents sequentially
+    XmlReader xmlReader;
+    xmlReader.writeData(data);
+    data += "<doc>incomplete";
+    std::vector<std::string> expected;
+
+    for (XmlReader::ParsingResult result = xmlReader.parse();
+         result != XmlReader::ParsingResult_NeedMoreData;
+         result = xmlReader.parse())
+    {
+        std::string event = std::to_string(static_cast<int>(result));
+
+        if ((result == XmlReader::ParsingResult_StartOfElement) ||
+            (result == XmlReader::ParsingResult_EndOfElement))
+        {
+            event += ":" + Utf8::toUtf8(xmlReader.name());
+        }
+        else if (result == XmlReader::ParsingResult_TextNode)
+        {
+            event += ":" + Utf8::toUtf8(xmlReader.text());
+        }
+
+        expected.push_back(event);
+    }
+
+    // Parse them in parallel, events are delivered in the same order
+    ParallelDocumentParser parser(4U);
+    DocumentCollector collector;
+    EXPECT_EQ(4U, parser.threadCount());
+
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData,
+              parser.parse(data.data(), data.size(), collector));
+    EXPECT_EQ(data.size() - 16U, parser.parsedSize());
+    ASSERT_EQ(documentCount, collector.m_indexes.size());
+
+    for (size_t i = 0U; i < documentCount; i++)
+    {
+        EXPECT_EQ(i, collector.m_indexes[i]);
+    }
+
+    ASSERT_EQ(expected.size(), collector.m_events.size());
+
+    for (size_t i = 0U; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i], collector.m_events[i]) << "Event: " << i;
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_ParallelDocumentParser, ConfigurationTest)
+{
+    const std::string data = makeDocument(1U) + makeDocument(2U);
+
+    ParallelDocumentParser parser(2U);
+    parser.setConfiguration([](XmlReader &xmlReader) {
+        xmlReader.setEventMask(XmlReader::EventMask_TextNode);
+    });
+
+    DocumentCollector collector;
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData,
+              parser.parse(data.data(), data.size(), collector));
+    ASSERT_EQ(2U, collector.m_events.size());
+    EXPECT_EQ(std::to_string(static_cast<int>(XmlReader::ParsingResult_TextNode)) + ":2",
+              collector.m_events[1]);
+}
+
+TEST(EmbeddedStAX_XmlReader_ParallelDocumentParser, StopAndErrorTest)
+{
+    std::string data;
+
+    for (size_t i = 0U; i < 50U; i++)
+    {
+        data += makeDocument(i);
+    }
+
+    // Handler stops parsing
+    ParallelDocumentParser parser(3U);
+    DocumentCollector collector;
+    collector.m_stopAfter = 10U;
+
+    EXPECT_EQ(XmlReader::ParsingResult_None, parser.parse(data.data(), data.size(), collector));
+    EXPECT_EQ(10U, collector.m_indexes.size());
+    EXPECT_EQ((10U * makeDocument(0U).size()) - 1U, parser.parsedSize());
+
+    // Document that the reader rejects stops parsing, documents before it are delivered
+    const std::string invalidData = makeDocument(0U) + makeDocument(1U) + "<a><b></c></a>" +
+                                    makeDocument(2U);
+    DocumentCollector collector2;
+
+    EXPECT_EQ(XmlReader::ParsingResult_Error,
+              parser.parse(invalidData.data(), invalidData.size(), collector2));
+    EXPECT_EQ(2U, collector2.m_indexes.size());
+}
+
+#endif // (__cplusplus >= 201103L)
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/ParallelTapeBuilder.h>
+#include "TapeTestUtils.h"
+#include <sstream>
+#include <string>
+
+#if (__cplusplus >= 201103L)
+
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+std::string createDocument(const size_t elementCount)
+{
+    std::ostringstream document;
+    document << "<?xml version=\"1.0\"?>\n<!-- <list> -->\n<list>\n";
+
+    for (size_t i = 0U; i < elementCount; i++)
+    {
+        document << "  <item id='" << i << "' text=\"<b>&amp;</b>\">\n"
+                 << "    <name>item &lt;" << i << "&gt;</name>\n"
+                 << "    <!-- <name>commented out</name> -->\n"
+                 << "    <data><![CDATA[<data>" << i << "</data>]]></data>\n"
+                 << "    <?pi <item/> ?><empty/>\n"
+                 << "  </item>\n";
+    }
+
+    document << "</list>\n";
+    return document.str();
+}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::ParallelTapeBuilder
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_ParallelTapeBuilder, ConstructorTest)
+{
+    const ParallelTapeBuilder builder(3U);
+
+    EXPECT_EQ(3U, builder.threadCount());
+    EXPECT_EQ(1024U * 1024U, builder.minimumSegmentSize());
+    EXPECT_TRUE(ParallelTapeBuilder().threadCount() > 0U);
+}
+
+TEST(EmbeddedStAX_XmlReader_ParallelTapeBuilder, SameAsTapeTest)
+{
+    const std::string document = createDocument(500U);
+    Tape expected;
+
+    ASSERT_TRUE(expected.build(document.data(), document.size()));
+
+    // Segments of different sizes start inside of all kinds of tokens
+    for (size_t segmentSize = 97U; segmentSize < document.size(); segmentSize *= 3U)
+    {
+        ParallelTapeBuilder builder(8U);
+        Tape tape;
+
+        builder.setMinimumSegmentSize(segmentSize);
+
+        ASSERT_TRUE(builder.build(document.data(), document.size(), &tape)) << segmentSize;
+        expectSameTape(expected, tape);
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_ParallelTapeBuilder, ErrorTest)
+{
+    std::string document = createDocument(200U);
+    ParallelTapeBuilder builder(4U);
+    Tape expected;
+    Tape tape;
+
+    builder.setMinimumSegmentSize(100U);
+
+    // Mismatched end of element in the middle of the document
+    const size_t position = document.find("</name>", document.size() / 2U);
+    document.replace(position, 7U, "</nam>");
+
+    ASSERT_FALSE(expected.build(document.data(), document.size()));
+    EXPECT_FALSE(builder.build(document.data(), document.size(), &tape));
+    EXPECT_EQ(expected.errorPosition(), tape.errorPosition());
+
+    // Incomplete document
+    document = createDocument(200U);
+    document.resize(document.size() - 3U);
+
+    ASSERT_FALSE(expected.build(document.data(), document.size()));
+    EXPECT_FALSE(builder.build(document.data(), document.size(), &tape));
+    EXPECT_EQ(expected.errorPosition(), tape.errorPosition());
+    EXPECT_FALSE(builder.build(NULL, 0U, &tape));
+}
+
+#endif // (__cplusplus >= 201103L)
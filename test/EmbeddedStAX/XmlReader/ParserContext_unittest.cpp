@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/ParserContext.h>
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+
+#if (__cplusplus >= 201103L)
+#include <atomic>
+#include <thread>
+#include <vector>
+#endif
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::ParserContext
+//--------------------------------------------------------------------------------------------------
+namespace
+{
+const std::string document = "<r xmlns:a='urn:a'><a:item id='1'/><x id='2'><item id='3'>t</item>"
+                             "</x></r>";
+}
+
+TEST(EmbeddedStAX_XmlReader_ParserContext, ConstructorTest)
+{
+    const ParserContext context;
+
+    EXPECT_EQ(0U, context.attributeKeyTable().size());
+    EXPECT_TRUE(context.pathSelector().isEmpty());
+    EXPECT_EQ(Utf8::toUnicodeString("http://www.w3.org/XML/1998/namespace"),
+              context.namespaceResolver().namespaceUri(NamespaceResolver::XmlNamespace));
+}
+
+TEST(EmbeddedStAX_XmlReader_ParserContext, SharedTablesTest)
+{
+    ParserContext context;
+    const uint32_t idKey = context.registerAttributeKey(Utf8::toUnicodeString("id"));
+    const uint32_t nsA = context.namespaceResolver().addNamespace(Utf8::toUnicodeString("urn:a"));
+    const uint32_t itemName =
+            context.namespaceResolver().addLocalName(Utf8::toUnicodeString("item"));
+    ASSERT_TRUE(context.addSelectedPath(Utf8::toUnicodeString("//item")));
+    ASSERT_TRUE(context.addSelectedPath(Utf8::toUnicodeString("//a:item")));
+
+    XmlReader xmlReader1;
+    XmlReader xmlReader2;
+    ASSERT_TRUE(xmlReader1.setParserContext(&context));
+    ASSERT_TRUE(xmlReader2.setParserContext(&context));
+    EXPECT_EQ(&context, xmlReader1.parserContext());
+
+    // Names of the context can be looked up in the reader before it creates its own resolver
+    EXPECT_EQ(nsA, xmlReader1.namespaceResolver().findNamespace(Utf8::toUnicodeString("urn:a")));
+
+    // Keys registered in a reader are added on top of the keys of the context
+    EXPECT_EQ(idKey, xmlReader2.registerAttributeKey(Utf8::toUnicodeString("id")));
+    EXPECT_EQ(idKey + 1U, xmlReader2.registerAttributeKey(Utf8::toUnicodeString("other")));
+    EXPECT_EQ(1U, context.attributeKeyTable().size());
+
+    xmlReader1.setNamespaceAware(true);
+    xmlReader2.setNamespaceAware(true);
+    xmlReader1.writeData(document);
+    xmlReader2.writeData(document);
+
+    XmlReader *xmlReaders[] = {&xmlReader1, &xmlReader2};
+
+    for (size_t i = 0U; i < 2U; i++)
+    {
+        XmlReader &xmlReader = *xmlReaders[i];
+
+        // Only the selected elements are delivered
+        ASSERT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+        EXPECT_EQ(nsA, xmlReader.expandedName().namespaceId);
+        EXPECT_EQ(itemName, xmlReader.expandedName().localNameId);
+        ASSERT_TRUE(xmlReader.attribute(idKey) != NULL);
+        EXPECT_EQ(Utf8::toUnicodeString("1"), xmlReader.attribute(idKey)->value());
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+        ASSERT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+        EXPECT_EQ(NamespaceResolver::NoNamespace, xmlReader.expandedName().namespaceId);
+        EXPECT_EQ(itemName, xmlReader.expandedName().localNameId);
+        ASSERT_TRUE(xmlReader.attribute(idKey) != NULL);
+        EXPECT_EQ(Utf8::toUnicodeString("3"), xmlReader.attribute(idKey)->value());
+        EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    }
+
+    // Names that were found in the document are not added to the context
+    EXPECT_EQ(SymbolTable::InvalidSymbol,
+              context.namespaceResolver().findLocalName(Utf8::toUnicodeString("x")));
+    EXPECT_NE(SymbolTable::InvalidSymbol,
+              xmlReader1.namespaceResolver().findLocalName(Utf8::toUnicodeString("x")));
+}
+
+TEST(EmbeddedStAX_XmlReader_ParserContext, SetParserContextTest)
+{
+    ParserContext context;
+    const uint32_t idKey = context.registerAttributeKey(Utf8::toUnicodeString("id"));
+
+    XmlReader xmlReader;
+    xmlReader.registerAttributeKey(Utf8::toUnicodeString("other"));
+    ASSERT_TRUE(xmlReader.addSelectedPath(Utf8::toUnicodeString("//x")));
+
+    // Context can not be changed inside of a document
+    xmlReader.writeData("<r>");
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.setParserContext(&context));
+    EXPECT_TRUE(xmlReader.parserContext() == NULL);
+
+    // Keys and paths of the reader are replaced by the ones from the context
+    xmlReader.clear();
+    ASSERT_TRUE(xmlReader.setParserContext(&context));
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("r"), xmlReader.name());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    ASSERT_TRUE(xmlReader.attribute(idKey) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("1"), xmlReader.attribute(idKey)->value());
+
+    // Reader can be detached from the context
+    xmlReader.clear();
+    ASSERT_TRUE(xmlReader.setParserContext(NULL));
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.attribute(idKey) == NULL);
+}
+
+#if (__cplusplus >= 201103L)
+TEST(EmbeddedStAX_XmlReader_ParserContext, ThreadTest)
+{
+    ParserContext context;
+    const uint32_t idKey = context.registerAttributeKey(Utf8::toUnicodeString("id"));
+    ASSERT_TRUE(context.addSelectedPath(Utf8::toUnicodeString("//item")));
+    ASSERT_TRUE(context.addSelectedPath(Utf8::toUnicodeString("//a:item")));
+
+    std::atomic<size_t> idCount(0U);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0U; i < 8U; i++)
+    {
+        threads.push_back(std::thread([&context, &idCount, idKey]() {
+            XmlReader xmlReader;
+            xmlReader.setParserContext(&context);
+
+            for (size_t j = 0U; j < 100U; j++)
+            {
+                XmlReader::ParsingResult result = XmlReader::ParsingResult_None;
+                xmlReader.clear();
+                xmlReader.writeData(document);
+
+                while ((result != XmlReader::ParsingResult_NeedMoreData) &&
+                       (result != XmlReader::ParsingResult_Error))
+                {
+                    result = xmlReader.parse();
+
+                    if ((result == XmlReader::ParsingResult_StartOfElement) &&
+                        (xmlReader.attribute(idKey) != NULL))
+                    {
+                        idCount++;
+                    }
+                }
+            }
+        }));
+    }
+
+    for (size_t i = 0U; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    EXPECT_EQ(8U * 100U * 2U, idCount);
+}
+#endif // (__cplusplus >= 201103L)
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/PathSelector.h>
+#include <EmbeddedStAX/Common/Utf.h>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::PathSelector
+//--------------------------------------------------------------------------------------------------
+static PathSelector::ElementNameList elementNameList(const char *names)
+{
+    PathSelector::ElementNameList list;
+    const UnicodeString namesString = Utf8::toUnicodeString(names);
+    size_t position = 0U;
+
+    while (position < namesString.size())
+    {
+        size_t end = namesString.find(static_cast<uint32_t>(' '), position);
+
+        if (end == UnicodeString::npos)
+        {
+            end = namesString.size();
+        }
+
+        list.push_back(namesString.substr(position, end - position));
+        position = end + 1U;
+    }
+
+    return list;
+}
+
+TEST(EmbeddedStAX_XmlReader_PathSelector, AddPathTest)
+{
+    PathSelector pathSelector;
+
+    EXPECT_TRUE(pathSelector.isEmpty());
+
+    EXPECT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("/envelope/body/order/item")));
+    EXPECT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("//price")));
+    EXPECT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("/envelope//*")));
+    EXPECT_EQ(3U, pathSelector.size());
+
+    // Invalid paths
+    EXPECT_FALSE(pathSelector.addPath(UnicodeString()));
+    EXPECT_FALSE(pathSelector.addPath(Utf8::toUnicodeString("envelope/body")));
+    EXPECT_FALSE(pathSelector.addPath(Utf8::toUnicodeString("/envelope/")));
+    EXPECT_FALSE(pathSelector.addPath(Utf8::toUnicodeString("/envelope///body")));
+    EXPECT_FALSE(pathSelector.addPath(Utf8::toUnicodeString("/1envelope")));
+    EXPECT_EQ(3U, pathSelector.size());
+
+    pathSelector.clear();
+    EXPECT_TRUE(pathSelector.isEmpty());
+}
+
+TEST(EmbeddedStAX_XmlReader_PathSelector, ChildPathTest)
+{
+    PathSelector pathSelector;
+    ASSERT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("/envelope/body/order")));
+
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("envelope"), NULL));
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("envelope body"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope body order"), NULL));
+    EXPECT_EQ(PathSelector::Match_None,
+              pathSelector.match(elementNameList("envelope header"), NULL));
+    EXPECT_EQ(PathSelector::Match_None,
+              pathSelector.match(elementNameList("body"), NULL));
+
+    // Empty element
+    const UnicodeString order = Utf8::toUnicodeString("order");
+
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope body"), &order));
+    EXPECT_EQ(PathSelector::Match_None,
+              pathSelector.match(elementNameList("envelope"), &order));
+}
+
+TEST(EmbeddedStAX_XmlReader_PathSelector, DescendantPathTest)
+{
+    PathSelector pathSelector;
+    ASSERT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("/envelope//order/*")));
+
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("envelope a b"), NULL));
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("envelope a order"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope order item"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope a b order price"), NULL));
+    EXPECT_EQ(PathSelector::Match_None,
+              pathSelector.match(elementNameList("root order item"), NULL));
+
+    // Any of the paths can match
+    ASSERT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("//price")));
+
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("root order"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("root order price"), NULL));
+}
+
+TEST(EmbeddedStAX_XmlReader_PathSelector, BaseSelectorTest)
+{
+    PathSelector baseSelector;
+    ASSERT_TRUE(baseSelector.addPath(Utf8::toUnicodeString("/envelope/body")));
+
+    PathSelector pathSelector;
+    pathSelector.setBaseSelector(&baseSelector);
+
+    EXPECT_EQ(&baseSelector, pathSelector.baseSelector());
+    EXPECT_FALSE(pathSelector.isEmpty());
+    EXPECT_EQ(1U, pathSelector.size());
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope body"), NULL));
+
+    // Paths of both selectors are matched
+    ASSERT_TRUE(pathSelector.addPath(Utf8::toUnicodeString("//price")));
+
+    EXPECT_EQ(2U, pathSelector.size());
+    EXPECT_EQ(1U, baseSelector.size());
+    EXPECT_EQ(PathSelector::Match_Ancestor,
+              pathSelector.match(elementNameList("envelope"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("root order price"), NULL));
+    EXPECT_EQ(PathSelector::Match_None,
+              baseSelector.match(elementNameList("root order price"), NULL));
+
+    // Clearing keeps the paths of the base selector
+    pathSelector.clear();
+
+    EXPECT_EQ(1U, pathSelector.size());
+    EXPECT_EQ(PathSelector::Match_None,
+              pathSelector.match(elementNameList("root order price"), NULL));
+    EXPECT_EQ(PathSelector::Match_Selected,
+              pathSelector.match(elementNameList("envelope body"), NULL));
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/StructuralIndex.h>
+#include <string>
+
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::StructuralIndex
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_StructuralIndex, BuildTest)
+{
+    // Structural characters in the first word, in a long text and in the tail of the document
+    const std::string document = "<a b='c'>text without structural characters &amp; more</a>";
+    StructuralIndex structuralIndex;
+    structuralIndex.build(document.data(), document.size());
+
+    std::string expected;
+
+    for (size_t i = 0U; i < document.size(); i++)
+    {
+        if (StructuralIndex::isStructuralChar(document[i]))
+        {
+            expected.push_back(document[i]);
+        }
+    }
+
+    std::string actual;
+
+    for (size_t i = 0U; i < structuralIndex.size(); i++)
+    {
+        const size_t position = structuralIndex.position(i);
+        ASSERT_TRUE(position < document.size());
+        actual.push_back(document[position]);
+    }
+
+    EXPECT_EQ(std::string("<''>&</>"), expected);
+    EXPECT_EQ(expected, actual);
+}
+
+TEST(EmbeddedStAX_XmlReader_StructuralIndex, AllCharactersTest)
+{
+    // Each structural character at each position of a word
+    const std::string structuralChars = "<>&\"'/?!";
+
+    for (size_t i = 0U; i < structuralChars.size(); i++)
+    {
+        for (size_t offset = 0U; offset < 16U; offset++)
+        {
+            std::string document(24U, 'x');
+            document[offset] = structuralChars[i];
+
+            StructuralIndex structuralIndex;
+            structuralIndex.build(document.data(), document.size());
+
+            ASSERT_EQ(1U, structuralIndex.size());
+            EXPECT_EQ(offset, structuralIndex.position(0U));
+        }
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_StructuralIndex, ClearTest)
+{
+    const std::string document = "<a/>";
+    StructuralIndex structuralIndex;
+    structuralIndex.build(document.data(), document.size());
+
+    EXPECT_EQ(3U, structuralIndex.size());
+
+    structuralIndex.clear();
+
+    EXPECT_EQ(0U, structuralIndex.size());
+    EXPECT_EQ(static_cast<size_t>(-1), structuralIndex.position(0U));
+
+    structuralIndex.build(NULL, 10U);
+
+    EXPECT_EQ(0U, structuralIndex.size());
+}
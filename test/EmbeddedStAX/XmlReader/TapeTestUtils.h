@@ -0,0 +1,52 @@
+#ifndef EMBEDDEDSTAX_XMLREADER_TAPETESTUTILS_H
+#define EMBEDDEDSTAX_XMLREADER_TAPETESTUTILS_H
+
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/Tape.h>
+
+/**
+ * Check that two tapes have the same entries, attributes and structural index
+ *
+ * \param expected  Expected tape
+ * \param actual    Actual tape
+ */
+inline void expectSameTape(const EmbeddedStAX::XmlReader::Tape &expected,
+                           const EmbeddedStAX::XmlReader::Tape &actual)
+{
+    using EmbeddedStAX::XmlReader::Tape;
+
+    ASSERT_EQ(expected.size(), actual.size());
+
+    for (size_t i = 0U; i < expected.size(); i++)
+    {
+        const Tape::Entry &expectedEntry = *expected.entry(i);
+        const Tape::Entry &actualEntry = *actual.entry(i);
+
+        EXPECT_EQ(expectedEntry.type, actualEntry.type) << "Entry: " << i;
+        EXPECT_EQ(expectedEntry.namePosition, actualEntry.namePosition) << "Entry: " << i;
+        EXPECT_EQ(expectedEntry.nameSize, actualEntry.nameSize) << "Entry: " << i;
+        EXPECT_EQ(expectedEntry.textPosition, actualEntry.textPosition) << "Entry: " << i;
+        EXPECT_EQ(expectedEntry.textSize, actualEntry.textSize) << "Entry: " << i;
+        EXPECT_EQ(expectedEntry.textHasReferences, actualEntry.textHasReferences) << "Entry: " << i;
+        ASSERT_EQ(expectedEntry.attributeCount, actualEntry.attributeCount) << "Entry: " << i;
+
+        for (size_t j = 0U; j < expectedEntry.attributeCount; j++)
+        {
+            const Tape::AttributeEntry &expectedAttribute = *expected.attribute(expectedEntry, j);
+            const Tape::AttributeEntry &actualAttribute = *actual.attribute(actualEntry, j);
+
+            EXPECT_EQ(expectedAttribute.namePosition, actualAttribute.namePosition);
+            EXPECT_EQ(expectedAttribute.valuePosition, actualAttribute.valuePosition);
+            EXPECT_EQ(expectedAttribute.valueSize, actualAttribute.valueSize);
+        }
+    }
+
+    ASSERT_EQ(expected.structuralIndex().size(), actual.structuralIndex().size());
+
+    for (size_t i = 0U; i < expected.structuralIndex().size(); i++)
+    {
+        EXPECT_EQ(expected.structuralIndex().position(i), actual.structuralIndex().position(i));
+    }
+}
+
+#endif // EMBEDDEDSTAX_XMLREADER_TAPETESTUTILS_H
@@ -0,0 +1,332 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/Tape.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include "TapeTestUtils.h"
+#include <string>
+#include <vector>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+struct TestEvent
+{
+    XmlReader::ParsingResult type;
+    UnicodeString name;
+    UnicodeString text;
+    std::vector<UnicodeString> attributes;
+};
+
+std::vector<TestEvent> readWithXmlReader(const std::string &document)
+{
+    std::vector<TestEvent> events;
+    XmlReader xmlReader;
+    xmlReader.writeData(document);
+
+    // Tape holds a single document, so it has no end of document event
+    xmlReader.setEventMask(XmlReader::EventMask_All & ~XmlReader::EventMask_EndOfDocument);
+
+    for (XmlReader::ParsingResult result = xmlReader.parse();
+         (result != XmlReader::ParsingResult_NeedMoreData) &&
+         (result != XmlReader::ParsingResult_Error);
+         result = xmlReader.parse())
+    {
+        TestEvent event;
+        event.type = result;
+
+        switch (result)
+        {
+            case XmlReader::ParsingResult_ProcessingInstruction:
+            {
+                event.name = xmlReader.processingInstruction().piTarget();
+                event.text = xmlReader.processingInstruction().piData();
+                break;
+            }
+
+            case XmlReader::ParsingResult_DocumentType:
+            {
+                event.name = xmlReader.documentType().name();
+                break;
+            }
+
+            case XmlReader::ParsingResult_StartOfElement:
+            {
+                event.name = xmlReader.name();
+                const AttributeList attributeList = xmlReader.attributeList();
+
+                for (AttributeList::ConstIterator it = attributeList.begin();
+                     it != attributeList.end();
+                     it++)
+                {
+                    event.attributes.push_back(it->name());
+                    event.attributes.push_back(it->value());
+                }
+                break;
+            }
+
+            case XmlReader::ParsingResult_EndOfElement:
+            {
+                event.name = xmlReader.name();
+                break;
+            }
+
+            case XmlReader::ParsingResult_Comment:
+            case XmlReader::ParsingResult_TextNode:
+            case XmlReader::ParsingResult_CData:
+            {
+                event.text = xmlReader.text();
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+
+        events.push_back(event);
+    }
+
+    return events;
+}
+
+std::vector<TestEvent> readWithTape(const Tape &tape)
+{
+    std::vector<TestEvent> events;
+
+    for (size_t i = 0U; i < tape.size(); i++)
+    {
+        const Tape::Entry &entry = *tape.entry(i);
+        TestEvent event;
+        event.type = entry.type;
+
+        if ((entry.type != XmlReader::ParsingResult_Comment) &&
+            (entry.type != XmlReader::ParsingResult_TextNode) &&
+            (entry.type != XmlReader::ParsingResult_CData) &&
+            (entry.type != XmlReader::ParsingResult_XmlDeclaration))
+        {
+            event.name = tape.name(entry);
+        }
+
+        if ((entry.type != XmlReader::ParsingResult_StartOfElement) &&
+            (entry.type != XmlReader::ParsingResult_EndOfElement) &&
+            (entry.type != XmlReader::ParsingResult_DocumentType))
+        {
+            event.text = tape.text(entry);
+        }
+
+        for (size_t j = 0U; j < entry.attributeCount; j++)
+        {
+            event.attributes.push_back(tape.name(*tape.attribute(entry, j)));
+            event.attributes.push_back(tape.value(*tape.attribute(entry, j)));
+        }
+
+        events.push_back(event);
+    }
+
+    return events;
+}
+
+bool buildWithSegments(const std::string &document,
+                       const std::vector<size_t> &splitPositions,
+                       Tape *tape)
+{
+    std::vector<Tape> segments(splitPositions.size() + 1U);
+    size_t startPosition = 0U;
+
+    for (size_t i = 0U; i < segments.size(); i++)
+    {
+        const size_t endPosition = (i < splitPositions.size()) ? splitPositions[i] :
+                                                                 document.size();
+
+        segments[i].buildSegment(document.data(), document.size(), startPosition, endPosition);
+        startPosition = endPosition;
+    }
+
+    return tape->merge(&segments[0], segments.size());
+}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::Tape
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_Tape, SameAsXmlReaderTest)
+{
+    const std::string document = "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n"
+                                 "<?pitarget      pidata       ?>\n"
+                                 "<!--comment text-->\n"
+                                 "<!DOCTYPE root >\n"
+                                 "<root a1='asd' a2=\"fgh; ('&amp;')\">"
+                                 "asd; 'amp' entity reference ('&amp;')<![CDATA[<a>&amp;]]>\n"
+                                 "  <child1 /> some text\n"
+                                 "  <child2 a='b'>more &lt;text&gt;</child2>\n"
+                                 "  <child3><child4>asdfgh \xC3\xA4</child4        ></child3>\n"
+                                 "  <child5/>some text<!-- > - -->\n"
+                                 "</root>\n"
+                                 "<?pitarget      pidata       ?>\n"
+                                 "<!--comment text-->";
+    Tape tape;
+
+    ASSERT_TRUE(tape.build(document.data(), document.size()));
+    EXPECT_EQ(XmlDeclaration::Standalone_Yes, tape.xmlDeclaration().standalone());
+
+    const std::vector<TestEvent> expected = readWithXmlReader(document);
+    const std::vector<TestEvent> actual = readWithTape(tape);
+
+    ASSERT_EQ(expected.size(), actual.size());
+
+    for (size_t i = 0U; i < expected.size(); i++)
+    {
+        EXPECT_EQ(expected[i].type, actual[i].type) << "Event: " << i;
+        EXPECT_TRUE(expected[i].name == actual[i].name) << "Event: " << i;
+        EXPECT_TRUE(expected[i].text == actual[i].text) << "Event: " << i;
+        EXPECT_TRUE(expected[i].attributes == actual[i].attributes) << "Event: " << i;
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_Tape, ErrorTest)
+{
+    const char *invalidDocuments[] =
+    {
+        "",
+        "<root>",
+        "<root></other>",
+        "<root/><root/>",
+        "text<root/>",
+        "<root a='b></root>",
+        "<root a=b></root>",
+        "<root a='b'c='d'/>",
+        "<root><!-- comment </root>",
+        "<root><![CDATA[ data </root>",
+        "<![CDATA[data]]><root/>",
+        "<root/><!DOCTYPE root>",
+        " <?xml version=\"1.0\"?><root/>"
+    };
+
+    for (size_t i = 0U; i < (sizeof(invalidDocuments) / sizeof(invalidDocuments[0])); i++)
+    {
+        const std::string document = invalidDocuments[i];
+        Tape tape;
+
+        EXPECT_FALSE(tape.build(document.data(), document.size())) << document;
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_Tape, EntryTest)
+{
+    const std::string document = "<root a='&#x41;&#66;'><child>text &amp; more</child></root>";
+    Tape tape;
+
+    ASSERT_TRUE(tape.build(document.data(), document.size()));
+    ASSERT_EQ(5U, tape.size());
+    EXPECT_TRUE(tape.entry(5U) == NULL);
+
+    const Tape::Entry *entry = tape.entry(0U);
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, entry->type);
+    EXPECT_EQ(1U, entry->attributeCount);
+    ASSERT_TRUE(tape.attribute(*entry, 0U) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("AB"), tape.value(*tape.attribute(*entry, 0U)));
+    EXPECT_TRUE(tape.attribute(*entry, 1U) == NULL);
+
+    entry = tape.entry(2U);
+    ASSERT_TRUE(entry != NULL);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, entry->type);
+    EXPECT_TRUE(entry->textHasReferences);
+    EXPECT_EQ(std::string("text &amp; more"),
+              document.substr(entry->textPosition, entry->textSize));
+    EXPECT_EQ(Utf8::toUnicodeString("text & more"), tape.text(*entry));
+}
+
+TEST(EmbeddedStAX_XmlReader_Tape, SegmentTest)
+{
+    // Split positions also land inside of comments, CDATA sections, attribute values and names
+    const std::string document = "<?xml version=\"1.0\"?>\n"
+                                 "<!DOCTYPE root>\n"
+                                 "<!-- <root> </root> -->\n"
+                                 "<root a1='<b>' a2=\"&lt;c/>\">"
+                                 "text &amp; more<![CDATA[<d></d>]]>\n"
+                                 "  <child1 a='</root>'/><?pi <e> ?>\n"
+                                 "  <child2>more <!-- </child2> --> text</child2>\n"
+                                 "</root>\n"
+                                 "<!--<root/>-->";
+    Tape expected;
+    ASSERT_TRUE(expected.build(document.data(), document.size()));
+
+    // Two segments
+    for (size_t i = 0U; i <= document.size(); i++)
+    {
+        Tape tape;
+        const std::vector<size_t> splitPositions(1U, i);
+
+        ASSERT_TRUE(buildWithSegments(document, splitPositions, &tape)) << "Split: " << i;
+        expectSameTape(expected, tape);
+        EXPECT_EQ(XmlDeclaration::Version_v1_0, tape.xmlDeclaration().version());
+    }
+
+    // Three segments
+    for (size_t i = 0U; i < document.size(); i += 3U)
+    {
+        for (size_t j = i; j < document.size(); j += 5U)
+        {
+            Tape tape;
+            std::vector<size_t> splitPositions;
+            splitPositions.push_back(i);
+            splitPositions.push_back(j);
+
+            ASSERT_TRUE(buildWithSegments(document, splitPositions, &tape)) << i << ", " << j;
+            expectSameTape(expected, tape);
+        }
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_Tape, SegmentErrorTest)
+{
+    const char *invalidDocuments[] =
+    {
+        "<root>",
+        "<root></other>",
+        "<root><a></b></root>",
+        "</root>",
+        "<root/><root/>",
+        "text<root/>",
+        "<root/>text",
+        "<root a='b></root>",
+        "<root><!-- comment </root>",
+        "<![CDATA[data]]><root/>",
+        "<root/><!DOCTYPE root>",
+        "<!DOCTYPE root><!DOCTYPE  root><root/>",
+        "<root/> <?xml version=\"1.0\"?>"
+    };
+
+    for (size_t i = 0U; i < (sizeof(invalidDocuments) / sizeof(invalidDocuments[0])); i++)
+    {
+        const std::string document = invalidDocuments[i];
+        Tape expected;
+
+        ASSERT_FALSE(expected.build(document.data(), document.size())) << document;
+
+        for (size_t j = 0U; j <= document.size(); j++)
+        {
+            Tape tape;
+            const std::vector<size_t> splitPositions(1U, j);
+
+            EXPECT_FALSE(buildWithSegments(document, splitPositions, &tape)) << document;
+            EXPECT_EQ(expected.errorPosition(), tape.errorPosition()) << document << ", " << j;
+        }
+    }
+
+    // Segments must cover the whole document
+    const std::string document = "<root></root>";
+    Tape segments[2];
+    Tape tape;
+
+    segments[0].buildSegment(document.data(), document.size(), 0U, 6U);
+    segments[1].buildSegment(document.data(), document.size(), 7U, document.size());
+
+    EXPECT_FALSE(tape.merge(segments, 1U));
+    EXPECT_FALSE(tape.merge(segments, 2U));
+    EXPECT_EQ(6U, tape.errorPosition());
+    EXPECT_FALSE(tape.merge(NULL, 0U));
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/XmlDocument.h>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::XmlDocument
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_XmlDocument, BuildTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?><!-- c --><root a='1' b='&amp;'>"
+                                 "text<x/><![CDATA[<y>]]><?pi data?></root><!-- after -->";
+
+    XmlReader xmlReader;
+    XmlDocument xmlDocument;
+
+    // Document is built incrementally
+    xmlReader.writeData(document.substr(0U, 30U));
+    EXPECT_EQ(XmlDocument::Result_NeedMoreData, xmlDocument.build(&xmlReader));
+    EXPECT_FALSE(xmlDocument.isComplete());
+
+    xmlReader.writeData(document.substr(30U));
+    EXPECT_EQ(XmlDocument::Result_Success, xmlDocument.build(&xmlReader));
+    EXPECT_TRUE(xmlDocument.isComplete());
+    EXPECT_EQ(XmlDocument::Result_Error, xmlDocument.build(&xmlReader));
+
+    // Document node: comment and root element
+    const uint32_t documentNode = xmlDocument.documentNode();
+    const uint32_t comment = xmlDocument.firstChild(documentNode);
+
+    EXPECT_EQ(7U, xmlDocument.nodeCount());
+    EXPECT_EQ(XmlDocument::NodeType_Document, xmlDocument.nodeType(documentNode));
+    EXPECT_EQ(XmlDocument::NodeType_Comment, xmlDocument.nodeType(comment));
+    EXPECT_EQ(Utf8::toUnicodeString(" c "), xmlDocument.value(comment));
+
+    const uint32_t root = xmlDocument.rootElement();
+
+    EXPECT_EQ(root, xmlDocument.nextSibling(comment));
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.nextSibling(root));
+    EXPECT_EQ(documentNode, xmlDocument.parent(root));
+    EXPECT_TRUE(xmlDocument.nameEquals(root, Utf8::toUnicodeString("root")));
+    EXPECT_EQ(Utf8::toUnicodeString("root"), xmlDocument.name(root));
+
+    // Attributes
+    ASSERT_EQ(2U, xmlDocument.attributeCount(root));
+    EXPECT_EQ(Utf8::toUnicodeString("a"), xmlDocument.attributeName(root, 0U));
+    EXPECT_EQ(Utf8::toUnicodeString("1"), xmlDocument.attributeValue(root, 0U));
+    EXPECT_EQ(1U, xmlDocument.findAttribute(root, Utf8::toUnicodeString("b")));
+    EXPECT_EQ(Utf8::toUnicodeString("&"), xmlDocument.attributeValue(root, 1U));
+    EXPECT_EQ(XmlDocument::InvalidIndex,
+              xmlDocument.findAttribute(root, Utf8::toUnicodeString("c")));
+    EXPECT_TRUE(xmlDocument.attributeValue(root, 2U).empty());
+
+    // Children of the root element
+    uint32_t node = xmlDocument.firstChild(root);
+    EXPECT_EQ(XmlDocument::NodeType_TextNode, xmlDocument.nodeType(node));
+    EXPECT_EQ(Utf8::toUnicodeString("text"), xmlDocument.value(node));
+
+    node = xmlDocument.nextSibling(node);
+    EXPECT_EQ(XmlDocument::NodeType_Element, xmlDocument.nodeType(node));
+    EXPECT_EQ(node, xmlDocument.findChildElement(root, Utf8::toUnicodeString("x")));
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.firstChild(node));
+    EXPECT_EQ(0U, xmlDocument.attributeCount(node));
+
+    node = xmlDocument.nextSibling(node);
+    EXPECT_EQ(XmlDocument::NodeType_CData, xmlDocument.nodeType(node));
+    EXPECT_EQ(Utf8::toUnicodeString("<y>"), xmlDocument.value(node));
+
+    node = xmlDocument.nextSibling(node);
+    EXPECT_EQ(XmlDocument::NodeType_ProcessingInstruction, xmlDocument.nodeType(node));
+    EXPECT_EQ(Utf8::toUnicodeString("pi"), xmlDocument.name(node));
+    EXPECT_EQ(Utf8::toUnicodeString(" data"), xmlDocument.value(node));
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.nextSibling(node));
+
+    // Invalid index
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.parent(XmlDocument::InvalidIndex));
+    EXPECT_TRUE(xmlDocument.name(100U).empty());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlDocument, TextChunkTest)
+{
+    XmlReader xmlReader;
+    XmlDocument xmlDocument;
+    xmlReader.setTextChunkSize(4U);
+    xmlReader.writeData("<root>0123456789abcdef<![CDATA[0123456789]]></root>");
+
+    EXPECT_EQ(XmlDocument::Result_Success, xmlDocument.build(&xmlReader));
+
+    const uint32_t text = xmlDocument.firstChild(xmlDocument.rootElement());
+    const uint32_t cData = xmlDocument.nextSibling(text);
+
+    EXPECT_EQ(XmlDocument::NodeType_TextNode, xmlDocument.nodeType(text));
+    EXPECT_EQ(Utf8::toUnicodeString("0123456789abcdef"), xmlDocument.value(text));
+    EXPECT_EQ(XmlDocument::NodeType_CData, xmlDocument.nodeType(cData));
+    EXPECT_EQ(Utf8::toUnicodeString("0123456789"), xmlDocument.value(cData));
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.nextSibling(cData));
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlDocument, ClearTest)
+{
+    XmlReader xmlReader;
+    XmlDocument xmlDocument;
+    xmlReader.writeData("<root><a/><b/></root>");
+
+    EXPECT_EQ(XmlDocument::Result_Success, xmlDocument.build(&xmlReader));
+    EXPECT_EQ(4U, xmlDocument.nodeCount());
+
+    // Clear keeps only the document node
+    xmlDocument.clear();
+    EXPECT_EQ(1U, xmlDocument.nodeCount());
+    EXPECT_FALSE(xmlDocument.isComplete());
+    EXPECT_EQ(XmlDocument::InvalidIndex, xmlDocument.rootElement());
+    EXPECT_TRUE(xmlDocument.stringPool().empty());
+
+    // Parsing error
+    xmlReader.startNewDocument();
+    xmlReader.writeData("<root></other>");
+    EXPECT_EQ(XmlDocument::Result_Error, xmlDocument.build(&xmlReader));
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/XmlEventGenerator.h>
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+#include <vector>
+
+#if (__cplusplus >= 202002L) && defined(__cpp_impl_coroutine)
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+static const std::string generatorTestDocument = "<root a='1'>text<!--c--><e/></root>";
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::XmlEventGenerator
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_XmlEventGenerator, GenerateEventsTest)
+{
+    XmlReader xmlReader;
+    XmlEventGenerator events = generateEvents(xmlReader);
+    std::vector<XmlReader::ParsingResult> results;
+    size_t position = 0U;
+
+    while (events.next())
+    {
+        if (events.value() == XmlReader::ParsingResult_NeedMoreData)
+        {
+            if (position >= generatorTestDocument.size())
+            {
+                break;
+            }
+
+            xmlReader.writeData(generatorTestDocument.substr(position, 2U));
+            position += 2U;
+        }
+        else
+        {
+            results.push_back(events.value());
+        }
+    }
+
+    ASSERT_EQ(7U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[0]);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, results[2]);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[3]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[4]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[5]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results[6]);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::AsyncXmlEventGenerator
+//--------------------------------------------------------------------------------------------------
+class ManualInputSource
+{
+public:
+    class ReadAwaitable
+    {
+    public:
+        explicit ReadAwaitable(ManualInputSource *inputSource)
+            : m_inputSource(inputSource)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) const noexcept
+        {
+            m_inputSource->m_waiting = handle;
+        }
+
+        std::string await_resume() const
+        {
+            const std::string data = m_inputSource->m_data.substr(m_inputSource->m_position, 3U);
+            m_inputSource->m_position += data.size();
+            return data;
+        }
+
+    private:
+        ManualInputSource *m_inputSource;
+    };
+
+    explicit ManualInputSource(const std::string &data)
+        : m_data(data),
+          m_position(0U),
+          m_waiting()
+    {
+    }
+
+    ReadAwaitable read()
+    {
+        return ReadAwaitable(this);
+    }
+
+    bool resumeReader()
+    {
+        bool resumed = false;
+
+        if (m_waiting)
+        {
+            std::coroutine_handle<> handle = m_waiting;
+            m_waiting = nullptr;
+            handle.resume();
+            resumed = true;
+        }
+
+        return resumed;
+    }
+
+private:
+    std::string m_data;
+    size_t m_position;
+    std::coroutine_handle<> m_waiting;
+};
+
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask get_return_object()
+        {
+            return DetachedTask();
+        }
+
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void return_void() noexcept
+        {
+        }
+
+        void unhandled_exception() noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+static DetachedTask consumeEvents(AsyncXmlEventGenerator *events,
+                                  std::vector<XmlReader::ParsingResult> *results,
+                                  bool *finished)
+{
+    bool available = co_await events->next();
+
+    while (available)
+    {
+        results->push_back(events->value());
+        available = co_await events->next();
+    }
+
+    *finished = true;
+}
+
+TEST(EmbeddedStAX_XmlReader_AsyncXmlEventGenerator, GenerateEventsTest)
+{
+    XmlReader xmlReader;
+    ManualInputSource inputSource(generatorTestDocument);
+    AsyncXmlEventGenerator events = generateEvents(xmlReader, inputSource);
+    std::vector<XmlReader::ParsingResult> results;
+    bool finished = false;
+
+    consumeEvents(&events, &results, &finished);
+    EXPECT_FALSE(finished);
+
+    // Event loop
+    size_t resumeCount = 0U;
+
+    while (inputSource.resumeReader())
+    {
+        resumeCount++;
+    }
+
+    EXPECT_TRUE(finished);
+    // One resume per 3 bytes of data and one for the end of the input
+    EXPECT_EQ(((generatorTestDocument.size() + 2U) / 3U) + 1U, resumeCount);
+    ASSERT_EQ(7U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[0]);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, results[2]);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[3]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[4]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[5]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results[6]);
+}
+
+#endif // (__cplusplus >= 202002L) && defined(__cpp_impl_coroutine)
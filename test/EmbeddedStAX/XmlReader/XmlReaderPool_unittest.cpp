@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/XmlReaderPool.h>
+#include <EmbeddedStAX/Common/Arena.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if (__cplusplus >= 201103L)
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+namespace
+{
+size_t countElements(XmlReader &xmlReader, const std::string &document)
+{
+    size_t count = 0U;
+    xmlReader.writeData(document);
+
+    for (XmlReader::ParsingResult result = xmlReader.parse();
+         (result != XmlReader::ParsingResult_NeedMoreData) &&
+         (result != XmlReader::ParsingResult_Error);
+         result = xmlReader.parse())
+    {
+        if (result == XmlReader::ParsingResult_StartOfElement)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+}
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::XmlReaderPool
+//--------------------------------------------------------------------------------------------------
+TEST(EmbeddedStAX_XmlReader_XmlReaderPool, ReuseTest)
+{
+    XmlReaderPool pool(1U);
+
+    EXPECT_EQ(0U, pool.idleCount());
+
+    // Released reader is reused
+    XmlReader *xmlReader1 = pool.acquire();
+    ASSERT_TRUE(xmlReader1 != NULL);
+    pool.release(xmlReader1);
+    EXPECT_EQ(1U, pool.idleCount());
+
+    XmlReader *xmlReader2 = pool.acquire();
+    EXPECT_EQ(xmlReader1, xmlReader2);
+    EXPECT_EQ(0U, pool.idleCount());
+
+    // Only the maximum number of idle readers is kept
+    XmlReader *xmlReader3 = pool.acquire();
+    EXPECT_NE(xmlReader2, xmlReader3);
+
+    pool.release(xmlReader2);
+    pool.release(xmlReader3);
+    pool.release(NULL);
+    EXPECT_EQ(1U, pool.idleCount());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReaderPool, WarmResetTest)
+{
+    XmlReaderPool pool;
+    pool.setConfiguration([](XmlReader &xmlReader) {
+        xmlReader.setEventMask(XmlReader::EventMask_StartOfElement);
+    });
+
+    // Reader is abandoned in the middle of a start of element, reference and comment
+    const char *partialDocuments[] =
+    {
+        "<root><child a='b&am",
+        "<root>text &#x4",
+        "<root><!-- comment",
+        "<?xml version=\"1.0\"?><root><![CDATA[data"
+    };
+
+    for (size_t i = 0U; i < (sizeof(partialDocuments) / sizeof(partialDocuments[0])); i++)
+    {
+        {
+            XmlReaderPool::Lease xmlReader(pool);
+            EXPECT_EQ(1U, countElements(*xmlReader, partialDocuments[i]));
+        }
+
+        XmlReaderPool::Lease xmlReader(pool);
+
+        // Configuration is kept and no data is left from the previous document
+        EXPECT_EQ(XmlReader::EventMask_StartOfElement, xmlReader->eventMask());
+        EXPECT_EQ(0U, xmlReader->inputOffset());
+        EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader->lastParsingResult());
+        EXPECT_EQ(3U, countElements(*xmlReader, "<root a='&amp;'><a>&#x41;</a><b/></root>"));
+        EXPECT_TRUE(xmlReader->name().empty());
+    }
+
+    EXPECT_EQ(1U, pool.idleCount());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReaderPool, ArenaTest)
+{
+    XmlReaderPool pool;
+
+    {
+        Arena arena;
+        XmlReaderPool::Lease xmlReader(pool);
+        xmlReader->setArena(&arena);
+        EXPECT_EQ(3U, countElements(*xmlReader, "<root><a/><b>text</b></root>"));
+    }
+
+    // Arena of the previous user is not kept
+    XmlReaderPool::Lease xmlReader(pool);
+
+    EXPECT_EQ(0U, pool.idleCount());
+    EXPECT_TRUE(xmlReader->arena() == NULL);
+    EXPECT_EQ(3U, countElements(*xmlReader, "<root><a/><b>text</b></root>"));
+    EXPECT_TRUE(xmlReader->name().get_allocator().arena() == NULL);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReaderPool, ThreadTest)
+{
+    XmlReaderPool pool(4U);
+    std::atomic<size_t> elementCount(0U);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0U; i < 8U; i++)
+    {
+        threads.push_back(std::thread([&pool, &elementCount]() {
+            for (size_t j = 0U; j < 100U; j++)
+            {
+                XmlReaderPool::Lease xmlReader(pool);
+                elementCount += countElements(*xmlReader, "<root><a/><b>text</b></root>");
+            }
+        }));
+    }
+
+    for (size_t i = 0U; i < threads.size(); i++)
+    {
+        threads[i].join();
+    }
+
+    EXPECT_EQ(8U * 100U * 3U, elementCount);
+    EXPECT_TRUE(pool.idleCount() <= 4U);
+    EXPECT_TRUE(pool.idleCount() > 0U);
+}
+
+#endif // (__cplusplus >= 201103L)
@@ -0,0 +1,1175 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlReader/XmlReader.h>
+#include <EmbeddedStAX/XmlReader/AbstractXmlHandler.h>
+#include <EmbeddedStAX/XmlReader/StaticXmlHandler.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <vector>
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlReader;
+
+static const std::string testDocument = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                                        "<!--comment-->"
+                                        "<root a1='v1' a2=\"v2\">"
+                                        "text &amp; more<![CDATA[cdata]]>"
+                                        "<empty/>"
+                                        "</root>";
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlReader::XmlReader
+//--------------------------------------------------------------------------------------------------
+static void checkTestDocument(XmlReader *xmlReader)
+{
+    EXPECT_EQ(testDocument.size(), xmlReader->writeData(testDocument));
+
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader->parse());
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, xmlReader->xmlDeclaration().version());
+
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("comment"), xmlReader->text());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), xmlReader->name());
+    AttributeList attributeList = xmlReader->attributeList();
+    ASSERT_EQ(2U, attributeList.size());
+    ASSERT_TRUE(attributeList.attribute(Utf8::toUnicodeString("a2")) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("v2"),
+              attributeList.attribute(Utf8::toUnicodeString("a2"))->value());
+
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("text & more"), xmlReader->text());
+
+    EXPECT_EQ(XmlReader::ParsingResult_CData, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("cdata"), xmlReader->text());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), xmlReader->name());
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), xmlReader->name());
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), xmlReader->name());
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader->parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader->parse());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, ParseDocumentTest)
+{
+    XmlReader xmlReader;
+
+    checkTestDocument(&xmlReader);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, ArenaTest)
+{
+    Arena arena(256U);
+    XmlReader xmlReader;
+    xmlReader.setArena(&arena);
+
+    EXPECT_EQ(&arena, xmlReader.arena());
+
+    checkTestDocument(&xmlReader);
+    EXPECT_TRUE(arena.capacity() > 0U);
+
+    // Memory taken from the arena is released in bulk when the reader continues after the end of
+    // the document
+    EXPECT_EQ(0U, arena.bytesAllocated());
+
+    xmlReader.startNewDocument();
+    EXPECT_EQ(0U, arena.bytesAllocated());
+
+    checkTestDocument(&xmlReader);
+
+    // Copies of the values use the global allocator so they survive the reset of the arena
+    xmlReader.writeData("<?pi data?><!DOCTYPE root><root a='1'/>");
+    EXPECT_EQ(XmlReader::ParsingResult_ProcessingInstruction, xmlReader.parse());
+    const ProcessingInstruction processingInstruction = xmlReader.processingInstruction();
+    EXPECT_EQ(XmlReader::ParsingResult_DocumentType, xmlReader.parse());
+    const DocumentType documentType = xmlReader.documentType();
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    const UnicodeString name = xmlReader.name();
+    const AttributeList attributeList = xmlReader.attributeList();
+
+    EXPECT_TRUE(processingInstruction.allocator().arena() == NULL);
+    EXPECT_TRUE(documentType.allocator().arena() == NULL);
+    EXPECT_TRUE(name.get_allocator().arena() == NULL);
+    EXPECT_TRUE(attributeList.allocator().arena() == NULL);
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+    xmlReader.writeData("<?other value?><!DOCTYPE next><next b='2'/>");
+    EXPECT_EQ(XmlReader::ParsingResult_ProcessingInstruction, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_DocumentType, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+
+    EXPECT_EQ(Utf8::toUnicodeString("pi"), processingInstruction.piTarget());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), documentType.name());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), name);
+    ASSERT_EQ(1U, attributeList.size());
+    EXPECT_EQ(Utf8::toUnicodeString("1"), attributeList.begin()->value());
+    xmlReader.clear();
+
+    // Switch back to the global allocator
+    xmlReader.setArena(NULL);
+    const size_t bytesAllocated = arena.bytesAllocated();
+
+    checkTestDocument(&xmlReader);
+    EXPECT_EQ(bytesAllocated, arena.bytesAllocated());
+}
+
+static void checkTake(XmlReader *xmlReader)
+{
+    EXPECT_EQ(testDocument.size(), xmlReader->writeData(testDocument));
+
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader->parse());
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, xmlReader->parse());
+
+    UnicodeString text = xmlReader->takeText();
+    EXPECT_EQ(Utf8::toUnicodeString("comment"), text);
+    EXPECT_TRUE(text.get_allocator().arena() == NULL);
+    EXPECT_TRUE(xmlReader->text().empty());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader->parse());
+
+    UnicodeString name = xmlReader->takeName();
+    EXPECT_EQ(Utf8::toUnicodeString("root"), name);
+    EXPECT_TRUE(name.get_allocator().arena() == NULL);
+    EXPECT_TRUE(xmlReader->name().empty());
+
+    AttributeList attributeList = xmlReader->takeAttributeList();
+    EXPECT_EQ(2U, attributeList.size());
+    EXPECT_TRUE(attributeList.allocator().arena() == NULL);
+    EXPECT_EQ(0U, xmlReader->attributeList().size());
+
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("text & more"), xmlReader->takeText());
+
+    EXPECT_EQ(XmlReader::ParsingResult_CData, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("cdata"), xmlReader->takeText());
+
+    // Name of an empty element is kept for its "end of element" result
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), xmlReader->takeName());
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), xmlReader->takeName());
+
+    // Open elements are not affected by taking the name
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader->parse());
+    EXPECT_EQ(Utf8::toUnicodeString("root"), xmlReader->takeName());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, TakeTest)
+{
+    XmlReader xmlReader;
+
+    checkTake(&xmlReader);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, TakeWithArenaTest)
+{
+    Arena arena;
+    XmlReader xmlReader;
+    xmlReader.setArena(&arena);
+
+    checkTake(&xmlReader);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, LazyReferenceDecodingTest)
+{
+    XmlReader xmlReader;
+    const std::string document = "<root a1='plain' a2='x &lt; y'>"
+                                 "plain text"
+                                 "<child/>"
+                                 "a &amp; b &#65;&#x42; &custom;"
+                                 "</root>";
+
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+
+    // Attribute values
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    AttributeList attributeList = xmlReader.attributeList();
+    const Attribute *attribute1 = attributeList.attribute(Utf8::toUnicodeString("a1"));
+    const Attribute *attribute2 = attributeList.attribute(Utf8::toUnicodeString("a2"));
+
+    ASSERT_TRUE(attribute1 != NULL);
+    EXPECT_FALSE(attribute1->valueHasReferences());
+    EXPECT_EQ(Utf8::toUnicodeString("plain"), attribute1->value());
+    EXPECT_EQ(&attribute1->rawValue(), &attribute1->value());
+
+    ASSERT_TRUE(attribute2 != NULL);
+    EXPECT_TRUE(attribute2->valueHasReferences());
+    EXPECT_EQ(Utf8::toUnicodeString("x &lt; y"), attribute2->rawValue());
+    EXPECT_EQ(Utf8::toUnicodeString("x < y"), attribute2->value());
+
+    // Text without references is not copied
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.textHasReferences());
+    EXPECT_EQ(Utf8::toUnicodeString("plain text"), xmlReader.text());
+    EXPECT_EQ(&xmlReader.rawText(), &xmlReader.text());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    // Text with references is decoded on access (character references are kept in hexadecimal
+    // format in the raw text)
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textHasReferences());
+    EXPECT_EQ(Utf8::toUnicodeString("a &amp; b &#x41;&#x42; &custom;"), xmlReader.rawText());
+    EXPECT_EQ(Utf8::toUnicodeString("a & b AB &custom;"), xmlReader.text());
+    EXPECT_EQ(Utf8::toUnicodeString("a & b AB &custom;"), xmlReader.takeText());
+    EXPECT_FALSE(xmlReader.textHasReferences());
+    EXPECT_TRUE(xmlReader.text().empty());
+
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+}
+
+static void readTextChunks(XmlReader *xmlReader,
+                           const std::string &document,
+                           const size_t writeSize,
+                           std::vector<XmlReader::ParsingResult> *results,
+                           std::vector<UnicodeString> *texts)
+{
+    size_t position = 0U;
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_NeedMoreData;
+
+    while (result != XmlReader::ParsingResult_Error)
+    {
+        result = xmlReader->parse();
+
+        if (result == XmlReader::ParsingResult_NeedMoreData)
+        {
+            if (position >= document.size())
+            {
+                break;
+            }
+
+            xmlReader->writeData(document.substr(position, writeSize));
+            position += writeSize;
+        }
+        else
+        {
+            results->push_back(result);
+            texts->push_back(xmlReader->text());
+        }
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, TextChunkTest)
+{
+    const std::string text(1000U, 't');
+    const std::string cdata(500U, 'c');
+    const std::string document = "<root>" + text + "&amp;<![CDATA[" + cdata + "]]></root>";
+    const size_t chunkSize = 100U;
+    const size_t writeSize = 37U;
+
+    XmlReader xmlReader;
+    xmlReader.setTextChunkSize(chunkSize);
+    EXPECT_EQ(chunkSize, xmlReader.textChunkSize());
+
+    std::vector<XmlReader::ParsingResult> results;
+    std::vector<UnicodeString> texts;
+    readTextChunks(&xmlReader, document, writeSize, &results, &texts);
+
+    ASSERT_TRUE(results.size() > 5U);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results.front());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[results.size() - 2U]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results.back());
+
+    // Text chunks are terminated by the text node and CDATA results
+    UnicodeString textNode;
+    UnicodeString cDataText;
+    UnicodeString *currentText = &textNode;
+    size_t textNodeCount = 0U;
+    size_t cDataCount = 0U;
+
+    for (size_t i = 1U; i < (results.size() - 2U); i++)
+    {
+        currentText->append(texts[i]);
+
+        switch (results[i])
+        {
+            case XmlReader::ParsingResult_TextChunk:
+            {
+                EXPECT_TRUE(texts[i].size() >= chunkSize);
+                EXPECT_TRUE(texts[i].size() < (chunkSize + writeSize));
+                break;
+            }
+
+            case XmlReader::ParsingResult_TextNode:
+            {
+                textNodeCount++;
+                currentText = &cDataText;
+                break;
+            }
+
+            case XmlReader::ParsingResult_CData:
+            {
+                cDataCount++;
+                break;
+            }
+
+            default:
+            {
+                ADD_FAILURE();
+                break;
+            }
+        }
+    }
+
+    EXPECT_EQ(1U, textNodeCount);
+    EXPECT_EQ(1U, cDataCount);
+    EXPECT_EQ(Utf8::toUnicodeString(text + "&"), textNode);
+    EXPECT_EQ(Utf8::toUnicodeString(cdata), cDataText);
+
+    // Without a chunk size the text nodes are reported as a whole
+    XmlReader xmlReader2;
+    results.clear();
+    texts.clear();
+    readTextChunks(&xmlReader2, document, writeSize, &results, &texts);
+
+    ASSERT_EQ(5U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[1]);
+    EXPECT_EQ(Utf8::toUnicodeString(text + "&"), texts[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_CData, results[2]);
+    EXPECT_EQ(Utf8::toUnicodeString(cdata), texts[2]);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, TextChunkSequenceTest)
+{
+    // "]]>" sequence is detected in a text node even if it is split between text chunks
+    const std::string document = "<root>" + std::string(20U, 't') + "]]></root>";
+
+    XmlReader xmlReader;
+    xmlReader.setTextChunkSize(4U);
+
+    std::vector<XmlReader::ParsingResult> results;
+    std::vector<UnicodeString> texts;
+    readTextChunks(&xmlReader, document, 3U, &results, &texts);
+
+    ASSERT_FALSE(results.empty());
+    EXPECT_EQ(XmlReader::ParsingResult_Error, results.back());
+
+    // Same for the end of CDATA
+    const std::string cDataDocument = "<root><![CDATA[" + std::string(20U, 'c') + "]]></root>";
+
+    XmlReader xmlReader2;
+    xmlReader2.setTextChunkSize(4U);
+    results.clear();
+    texts.clear();
+    readTextChunks(&xmlReader2, cDataDocument, 3U, &results, &texts);
+
+    ASSERT_TRUE(results.size() > 2U);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results.back());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[results.size() - 2U]);
+    EXPECT_EQ(XmlReader::ParsingResult_CData, results[results.size() - 3U]);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, SkipElementTest)
+{
+    const std::string document = "<root>"
+                                 "<skip a='>' b=\"/>\">"
+                                 "text<nested><empty/><nested>x</nested></nested>"
+                                 "<!-- </skip> --><![CDATA[</skip>]]]><?pi </skip> ?>"
+                                 "</skip>"
+                                 "<empty/>"
+                                 "<keep>text</keep>"
+                                 "</root>";
+
+    // Data is written one character at a time to check resuming of skipping
+    XmlReader xmlReader;
+    std::vector<XmlReader::ParsingResult> results;
+    std::vector<UnicodeString> names;
+    size_t position = 0U;
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_NeedMoreData;
+
+    while ((result != XmlReader::ParsingResult_Error) && (position <= document.size()))
+    {
+        result = xmlReader.parse();
+
+        if (result == XmlReader::ParsingResult_NeedMoreData)
+        {
+            xmlReader.writeData(document.substr(position, 1U));
+            position++;
+        }
+        else
+        {
+            results.push_back(result);
+            names.push_back(xmlReader.name());
+
+            if ((result == XmlReader::ParsingResult_StartOfElement) &&
+                ((xmlReader.name() == Utf8::toUnicodeString("skip")) ||
+                 (xmlReader.name() == Utf8::toUnicodeString("empty"))))
+            {
+                EXPECT_TRUE(xmlReader.skipElement());
+            }
+        }
+    }
+
+    ASSERT_EQ(10U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[0]);
+    EXPECT_EQ(Utf8::toUnicodeString("root"), names[0]);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[1]);
+    EXPECT_EQ(Utf8::toUnicodeString("skip"), names[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[2]);
+    EXPECT_EQ(Utf8::toUnicodeString("skip"), names[2]);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[3]);
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), names[3]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[4]);
+    EXPECT_EQ(Utf8::toUnicodeString("empty"), names[4]);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[5]);
+    EXPECT_EQ(Utf8::toUnicodeString("keep"), names[5]);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[6]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[7]);
+    EXPECT_EQ(Utf8::toUnicodeString("keep"), names[7]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[8]);
+    EXPECT_EQ(Utf8::toUnicodeString("root"), names[8]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results[9]);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, SkipElementNegativeTest)
+{
+    XmlReader xmlReader;
+    const std::string document = "<?xml version=\"1.0\"?><root>text</root>";
+
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+
+    // Skipping is only possible right after a start of element
+    EXPECT_FALSE(xmlReader.skipElement());
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.skipElement());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.skipElement());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.skipElement());
+}
+
+static void readEvents(XmlReader *xmlReader,
+                       const std::string &document,
+                       const size_t writeSize,
+                       std::vector<XmlReader::ParsingResult> *results)
+{
+    size_t position = 0U;
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_NeedMoreData;
+
+    while ((result != XmlReader::ParsingResult_Error) && (position < document.size()))
+    {
+        result = xmlReader->parse();
+
+        if (result == XmlReader::ParsingResult_NeedMoreData)
+        {
+            xmlReader->writeData(document.substr(position, writeSize));
+            position += writeSize;
+        }
+        else
+        {
+            results->push_back(result);
+        }
+    }
+
+    while (result != XmlReader::ParsingResult_Error)
+    {
+        result = xmlReader->parse();
+        results->push_back(result);
+
+        if (result == XmlReader::ParsingResult_NeedMoreData)
+        {
+            break;
+        }
+    }
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, EventMaskTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?>"
+                                 "<!-- comment - with - dashes -->"
+                                 "<root>\n  "
+                                 "<?pi data ? with > characters?>"
+                                 "text &amp; more<!-- comment -->"
+                                 "<![CDATA[cdata]]>\n"
+                                 "</root>";
+    std::vector<XmlReader::ParsingResult> results;
+
+    // All events are delivered by default
+    XmlReader xmlReader;
+    EXPECT_EQ(static_cast<uint32_t>(XmlReader::EventMask_All), xmlReader.eventMask());
+
+    readEvents(&xmlReader, document, 3U, &results);
+    ASSERT_EQ(12U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results[10]);
+
+    // Filtered events are skipped, whitespace-only text nodes are filtered out
+    XmlReader xmlReader2;
+    xmlReader2.setEventMask(XmlReader::EventMask_StartOfElement |
+                            XmlReader::EventMask_EndOfElement |
+                            XmlReader::EventMask_TextNode |
+                            XmlReader::EventMask_CData);
+    results.clear();
+    readEvents(&xmlReader2, document, 3U, &results);
+
+    ASSERT_EQ(5U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[0]);
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_CData, results[2]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[3]);
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, results[4]);
+
+    // Values of filtered text nodes are not stored
+    XmlReader xmlReader3;
+    xmlReader3.setEventMask(XmlReader::EventMask_Comment | XmlReader::EventMask_EndOfElement);
+    results.clear();
+    readEvents(&xmlReader3, document, 3U, &results);
+
+    ASSERT_EQ(4U, results.size());
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, results[0]);
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, results[1]);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[2]);
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, results[3]);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, EventMaskValueTest)
+{
+    const std::string document = "<root><!--comment--><?pi data?>text<![CDATA[cdata]]></root>";
+
+    XmlReader xmlReader;
+    xmlReader.setEventMask(XmlReader::EventMask_All);
+    EXPECT_EQ(document.size(), xmlReader.writeData(document));
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_Comment, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("comment"), xmlReader.text());
+    EXPECT_EQ(XmlReader::ParsingResult_ProcessingInstruction, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("pi"), xmlReader.processingInstruction().piTarget());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("text"), xmlReader.text());
+    EXPECT_EQ(XmlReader::ParsingResult_CData, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("cdata"), xmlReader.text());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, PathSelectionTest)
+{
+    const std::string document =
+            "<?xml version=\"1.0\"?>"
+            "<envelope><header><order><item>header</item></order></header>"
+            "<body><!-- comment --><order id=\"1\"><item>a</item><note>n</note><item/></order>"
+            "text<price>10</price></body></envelope>";
+
+    XmlReader xmlReader;
+    EXPECT_TRUE(xmlReader.addSelectedPath(Utf8::toUnicodeString("/envelope/body/order/item")));
+    EXPECT_TRUE(xmlReader.addSelectedPath(Utf8::toUnicodeString("//price")));
+    EXPECT_FALSE(xmlReader.addSelectedPath(Utf8::toUnicodeString("price")));
+
+    for (size_t writeSize = 1U; writeSize <= document.size(); writeSize += 7U)
+    {
+        std::vector<XmlReader::ParsingResult> results;
+        xmlReader.startNewDocument();
+        readEvents(&xmlReader, document, writeSize, &results);
+
+        ASSERT_EQ(10U, results.size());
+        EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[0]);
+        EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[1]);
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[2]);
+        EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[3]);
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[4]);
+        EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, results[5]);
+        EXPECT_EQ(XmlReader::ParsingResult_TextNode, results[6]);
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, results[7]);
+        EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, results[8]);
+        EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, results[9]);
+    }
+
+    // Check the values of the selected events
+    xmlReader.startNewDocument();
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("item"), xmlReader.name());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("a"), xmlReader.text());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("item"), xmlReader.name());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("item"), xmlReader.name());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("price"), xmlReader.name());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("10"), xmlReader.text());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+
+    // All of the events are delivered without selected paths
+    xmlReader.clearSelectedPaths();
+    xmlReader.startNewDocument();
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("envelope"), xmlReader.name());
+}
+
+class RecordingXmlHandler : public AbstractXmlHandler
+{
+public:
+    RecordingXmlHandler(XmlReader *xmlReader)
+        : m_xmlReader(xmlReader),
+          m_events(),
+          m_stopAtEndOfElement(false)
+    {
+    }
+
+    virtual bool onXmlDeclaration(const XmlDeclaration &xmlDeclaration)
+    {
+        m_events.push_back((xmlDeclaration.version() == XmlDeclaration::Version_v1_0) ? "xml:1.0"
+                                                                                     : "xml");
+        return true;
+    }
+
+    virtual bool onComment(const UnicodeString &text)
+    {
+        m_events.push_back("comment:" + Utf8::toUtf8(text));
+        return true;
+    }
+
+    virtual bool onStartOfElement(const UnicodeString &name, const AttributeList &attributeList)
+    {
+        std::string event = "start:" + Utf8::toUtf8(name);
+
+        for (AttributeList::ConstIterator it = attributeList.begin();
+             it != attributeList.end();
+             it++)
+        {
+            event += " " + Utf8::toUtf8(it->name()) +
+                     "=" + Utf8::toUtf8(it->value());
+        }
+
+        m_events.push_back(event);
+
+        if (name == Utf8::toUnicodeString("skip"))
+        {
+            EXPECT_TRUE(m_xmlReader->skipElement());
+        }
+        return true;
+    }
+
+    virtual bool onEndOfElement(const UnicodeString &name)
+    {
+        m_events.push_back("end:" + Utf8::toUtf8(name));
+        return !m_stopAtEndOfElement;
+    }
+
+    virtual bool onTextNode(const UnicodeString &text)
+    {
+        m_events.push_back("text:" + Utf8::toUtf8(text));
+        return true;
+    }
+
+    virtual bool onCData(const UnicodeString &text)
+    {
+        m_events.push_back("cdata:" + Utf8::toUtf8(text));
+        return true;
+    }
+
+    virtual bool onEndOfDocument()
+    {
+        m_events.push_back("end of document");
+        return true;
+    }
+
+    XmlReader *m_xmlReader;
+    std::vector<std::string> m_events;
+    bool m_stopAtEndOfElement;
+};
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, HandlerTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?><!--c--><root a='1'>t &amp; t"
+                                 "<skip><x>skipped</x></skip><![CDATA[d]]><e/></root>";
+
+    XmlReader xmlReader;
+    RecordingXmlHandler handler(&xmlReader);
+
+    EXPECT_EQ(XmlReader::ParsingResult_Error, xmlReader.parse(NULL));
+
+    for (size_t i = 0U; i < document.size(); i++)
+    {
+        xmlReader.writeData(document.substr(i, 1U));
+        ASSERT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse(&handler));
+    }
+
+    ASSERT_EQ(11U, handler.m_events.size());
+    EXPECT_EQ("xml:1.0", handler.m_events[0]);
+    EXPECT_EQ("comment:c", handler.m_events[1]);
+    EXPECT_EQ("start:root a=1", handler.m_events[2]);
+    EXPECT_EQ("text:t & t", handler.m_events[3]);
+    EXPECT_EQ("start:skip", handler.m_events[4]);
+    EXPECT_EQ("end:skip", handler.m_events[5]);
+    EXPECT_EQ("cdata:d", handler.m_events[6]);
+    EXPECT_EQ("start:e", handler.m_events[7]);
+    EXPECT_EQ("end:e", handler.m_events[8]);
+    EXPECT_EQ("end:root", handler.m_events[9]);
+    EXPECT_EQ("end of document", handler.m_events[10]);
+
+    // Handler can stop parsing
+    RecordingXmlHandler stoppingHandler(&xmlReader);
+    stoppingHandler.m_stopAtEndOfElement = true;
+    xmlReader.startNewDocument();
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader.parse(&stoppingHandler));
+    EXPECT_EQ("end:skip", stoppingHandler.m_events.back());
+    EXPECT_EQ(XmlReader::ParsingResult_None, xmlReader.parse(&stoppingHandler));
+    EXPECT_EQ("end:e", stoppingHandler.m_events.back());
+}
+
+class ElementCountingHandler : public StaticXmlHandler
+{
+public:
+    enum
+    {
+        HandlerEventMask = XmlReader::EventMask_StartOfElement | XmlReader::EventMask_TextNode
+    };
+
+    ElementCountingHandler()
+        : m_elementCount(0U),
+          m_text()
+    {
+    }
+
+    bool onStartOfElement(const UnicodeString &, const AttributeList &)
+    {
+        m_elementCount++;
+        return true;
+    }
+
+    bool onTextNode(const UnicodeString &text)
+    {
+        m_text += Utf8::toUtf8(text);
+        return (text != Utf8::toUnicodeString("d"));
+    }
+
+    size_t m_elementCount;
+    std::string m_text;
+};
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, StaticHandlerTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?><!--c--><root>a<x>b</x><![CDATA[c]]>"
+                                 "<y/><z>d</z>e</root>";
+
+    XmlReader xmlReader;
+    ElementCountingHandler handler;
+
+    for (size_t i = 0U; i < document.size(); i++)
+    {
+        xmlReader.writeData(document.substr(i, 1U));
+        const XmlReader::ParsingResult result = xmlReader.parse(handler);
+
+        if (result == XmlReader::ParsingResult_None)
+        {
+            // Stopped by the handler at text "d"
+            EXPECT_EQ(4U, handler.m_elementCount);
+            EXPECT_EQ("abd", handler.m_text);
+        }
+        else
+        {
+            ASSERT_EQ(XmlReader::ParsingResult_NeedMoreData, result);
+        }
+    }
+
+    EXPECT_EQ(4U, handler.m_elementCount);
+    EXPECT_EQ("abde", handler.m_text);
+
+    // Event mask of the reader is not changed
+    EXPECT_EQ(static_cast<uint32_t>(XmlReader::EventMask_All), xmlReader.eventMask());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, TypedTextTest)
+{
+    const std::string document = "<root><i>-12</i><d>2.5e1</d><b>true</b>"
+                                 "<t>2000-01-01T00:00:00Z</t><x>&#49;0</x></root>";
+
+    XmlReader xmlReader;
+    xmlReader.writeData(document);
+
+    int64_t intValue = 0;
+    double doubleValue = 0.0;
+    bool boolValue = false;
+    Timestamp timestamp;
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textAsInt64(&intValue));
+    EXPECT_EQ(-12, intValue);
+    EXPECT_FALSE(xmlReader.textAsBool(&boolValue));
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textAsDouble(&doubleValue));
+    EXPECT_EQ(25.0, doubleValue);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textAsBool(&boolValue));
+    EXPECT_TRUE(boolValue);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textAsTimestamp(&timestamp));
+    EXPECT_EQ(946684800, timestamp.seconds);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    // References are decoded before parsing
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.textAsInt64(&intValue));
+    EXPECT_EQ(10, intValue);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, AttributeKeyTest)
+{
+    const std::string document = "<root id='1' unit=\"ms\"><v unit='s' id='2' x='y'/>"
+                                 "<w other='z'></w></root>";
+
+    XmlReader xmlReader;
+    const uint32_t idKey = xmlReader.registerAttributeKey(Utf8::toUnicodeString("id"));
+    const uint32_t unitKey = xmlReader.registerAttributeKey(Utf8::toUnicodeString("unit"));
+
+    EXPECT_NE(idKey, unitKey);
+    EXPECT_EQ(idKey, xmlReader.registerAttributeKey(Utf8::toUnicodeString("id")));
+    EXPECT_TRUE(xmlReader.attribute(idKey) == NULL);
+
+    for (size_t i = 0U; i < document.size(); i++)
+    {
+        xmlReader.writeData(document.substr(i, 1U));
+    }
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    ASSERT_TRUE(xmlReader.attribute(idKey) != NULL);
+    ASSERT_TRUE(xmlReader.attribute(unitKey) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("1"), xmlReader.attribute(idKey)->value());
+    EXPECT_EQ(Utf8::toUnicodeString("ms"), xmlReader.attribute(unitKey)->value());
+    EXPECT_TRUE(xmlReader.attribute(unitKey + 1U) == NULL);
+
+    // Empty element
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    ASSERT_TRUE(xmlReader.attribute(idKey) != NULL);
+    ASSERT_TRUE(xmlReader.attribute(unitKey) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("2"), xmlReader.attribute(idKey)->value());
+    EXPECT_EQ(Utf8::toUnicodeString("s"), xmlReader.attribute(unitKey)->value());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.attribute(idKey) == NULL);
+
+    // Element without the registered attributes
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.attribute(idKey) == NULL);
+    EXPECT_TRUE(xmlReader.attribute(unitKey) == NULL);
+    EXPECT_EQ(1U, xmlReader.takeAttributeList().size());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+
+    // Keys can be cleared
+    xmlReader.clearAttributeKeys();
+    xmlReader.startNewDocument();
+    xmlReader.writeData(document);
+
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.attribute(idKey) == NULL);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, NamespaceTest)
+{
+    const std::string document = "<a:root xmlns:a='urn:a' xmlns='urn:d'><item a:id='1' id='2'/>"
+                                 "<a:x xmlns='' xmlns:a='urn:b'><y/></a:x><z/></a:root>";
+
+    XmlReader xmlReader;
+    xmlReader.setNamespaceAware(true);
+    NamespaceResolver &resolver = xmlReader.namespaceResolver();
+
+    // IDs can be interned before parsing
+    const uint32_t nsA = resolver.addNamespace(Utf8::toUnicodeString("urn:a"));
+    const uint32_t nsB = resolver.addNamespace(Utf8::toUnicodeString("urn:b"));
+    const uint32_t nsD = resolver.addNamespace(Utf8::toUnicodeString("urn:d"));
+    const uint32_t idName = resolver.addLocalName(Utf8::toUnicodeString("id"));
+    const uint32_t rootName = resolver.addLocalName(Utf8::toUnicodeString("root"));
+
+    xmlReader.writeData(document);
+
+    // <a:root>
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(nsA, xmlReader.expandedName().namespaceId);
+    EXPECT_EQ(rootName, xmlReader.expandedName().localNameId);
+    ASSERT_EQ(2U, xmlReader.attributeExpandedNames().size());
+    EXPECT_EQ(NamespaceResolver::XmlnsNamespace,
+              xmlReader.attributeExpandedNames()[0].namespaceId);
+
+    // <item/> is in the default namespace, its unprefixed attribute is not in any namespace
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(nsD, xmlReader.expandedName().namespaceId);
+    ASSERT_EQ(2U, xmlReader.attributeExpandedNames().size());
+    EXPECT_EQ(nsA, xmlReader.attributeExpandedNames()[0].namespaceId);
+    EXPECT_EQ(idName, xmlReader.attributeExpandedNames()[0].localNameId);
+    EXPECT_EQ(NamespaceResolver::NoNamespace, xmlReader.attributeExpandedNames()[1].namespaceId);
+    EXPECT_EQ(idName, xmlReader.attributeExpandedNames()[1].localNameId);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(nsD, xmlReader.expandedName().namespaceId);
+    EXPECT_TRUE(xmlReader.attributeExpandedNames().empty());
+
+    // <a:x> redeclares the prefix and undeclares the default namespace
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(nsB, xmlReader.expandedName().namespaceId);
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(NamespaceResolver::NoNamespace, xmlReader.expandedName().namespaceId);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(nsB, xmlReader.expandedName().namespaceId);
+
+    // Bindings are restored after </a:x>
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(nsD, xmlReader.expandedName().namespaceId);
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(nsA, xmlReader.expandedName().namespaceId);
+    EXPECT_EQ(rootName, xmlReader.expandedName().localNameId);
+    EXPECT_EQ(0U, resolver.scopeDepth());
+
+    // Undeclared prefix is an error
+    xmlReader.startNewDocument();
+    xmlReader.writeData("<b:root/>");
+    EXPECT_EQ(XmlReader::ParsingResult_Error, xmlReader.parse());
+
+    // Prefixes are not resolved when namespace processing is disabled
+    xmlReader.clear();
+    xmlReader.setNamespaceAware(false);
+    xmlReader.writeData("<b:root/>");
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, CheckpointTest)
+{
+    const std::string document = "<?xml version=\"1.0\"?><!DOCTYPE root><root a='&amp;'>"
+                                 "<x xmlns='urn:x'>t&lt;ext</x><y/><!--c-->tail</root>";
+
+    XmlReader xmlReader;
+    xmlReader.setNamespaceAware(true);
+    std::string checkpoint;
+
+    // Checkpoint can not be saved inside of a token
+    xmlReader.writeData(document.substr(0U, 10U));
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.saveCheckpoint(&checkpoint));
+
+    // Parse up to the text node in element "x" and save a checkpoint
+    xmlReader.writeData(document.substr(10U, 70U));
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_DocumentType, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    ASSERT_TRUE(xmlReader.saveCheckpoint(&checkpoint));
+    EXPECT_EQ(80U, xmlReader.inputOffset());
+
+    // Restore the checkpoint in a new reader and continue both readers with the rest of the input
+    XmlReader restoredReader;
+    restoredReader.setNamespaceAware(true);
+    ASSERT_TRUE(restoredReader.restoreCheckpoint(checkpoint));
+    EXPECT_EQ(80U, restoredReader.inputOffset());
+    EXPECT_EQ(Utf8::toUnicodeString("t<ext"), restoredReader.text());
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, restoredReader.xmlDeclaration().version());
+
+    xmlReader.writeData(document.substr(80U));
+    restoredReader.writeData(document.substr(restoredReader.inputOffset()));
+
+    const NamespaceResolver &resolver = restoredReader.namespaceResolver();
+    XmlReader::ParsingResult result = XmlReader::ParsingResult_None;
+    size_t eventCount = 0U;
+
+    while ((result != XmlReader::ParsingResult_NeedMoreData) &&
+           (result != XmlReader::ParsingResult_Error))
+    {
+        result = restoredReader.parse();
+        EXPECT_EQ(xmlReader.parse(), result);
+        EXPECT_EQ(xmlReader.name(), restoredReader.name());
+        EXPECT_EQ(xmlReader.text(), restoredReader.text());
+
+        if (eventCount == 0U)
+        {
+            // End of element "x" is resolved with the restored namespace scope
+            EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, result);
+            EXPECT_EQ(Utf8::toUnicodeString("urn:x"),
+                      resolver.namespaceUri(restoredReader.expandedName().namespaceId));
+        }
+
+        eventCount++;
+    }
+
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, result);
+    EXPECT_EQ(8U, eventCount);
+
+    // Invalid checkpoints
+    EXPECT_FALSE(restoredReader.restoreCheckpoint(std::string("ESXC")));
+    EXPECT_FALSE(restoredReader.restoreCheckpoint(checkpoint.substr(0U, checkpoint.size() - 1U)));
+    EXPECT_EQ(0U, restoredReader.inputOffset());
+
+    // Incomplete unicode character at the end of the input is not counted in the input offset
+    restoredReader.clear();
+    restoredReader.writeData("<root>\xC3");
+    EXPECT_EQ(6U, restoredReader.inputOffset());
+
+    // Reader that is not namespace aware does not create a namespace resolver for its checkpoint
+    XmlReader plainReader;
+    plainReader.writeData("<root a='1'><x>text<");
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, plainReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, plainReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, plainReader.parse());
+    ASSERT_TRUE(plainReader.saveCheckpoint(&checkpoint));
+
+    const XmlReader emptyReader;
+    XmlReader restoredPlainReader;
+    ASSERT_TRUE(restoredPlainReader.restoreCheckpoint(checkpoint));
+    EXPECT_EQ(Utf8::toUnicodeString("text"), restoredPlainReader.text());
+    EXPECT_EQ(&emptyReader.namespaceResolver(),
+              &static_cast<const XmlReader &>(restoredPlainReader).namespaceResolver());
+    EXPECT_EQ(NamespaceResolver::NoNamespace, restoredPlainReader.expandedName().namespaceId);
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, DocumentStreamTest)
+{
+    // Documents follow each other in the data stream without any framing
+    const std::string message = "<?xml version=\"1.0\"?><msg id='1'><v>text</v></msg>\n"
+                                "<!--c--><msg id='2'/>"
+                                "<?xml version=\"1.0\"?>\r\n<msg id='3'>x</msg>";
+    const size_t messageCount = 100U;
+    std::string stream;
+
+    for (size_t i = 0U; i < messageCount; i++)
+    {
+        stream += message;
+    }
+
+    Arena arena(256U);
+    XmlReader xmlReader;
+    xmlReader.setArena(&arena);
+    RecordingXmlHandler handler(&xmlReader);
+    size_t capacity = 0U;
+
+    // Reader continues with the next document on its own, parts of the next document that are
+    // already in the parsing buffer are kept
+    for (size_t position = 0U; position < stream.size(); position += 13U)
+    {
+        xmlReader.writeData(stream.substr(position, 13U));
+        ASSERT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse(&handler));
+
+        if ((capacity == 0U) && (position >= (2U * message.size())))
+        {
+            capacity = arena.capacity();
+        }
+    }
+
+    // Memory of the previous documents is reused
+    EXPECT_TRUE(capacity > 0U);
+    EXPECT_EQ(capacity, arena.capacity());
+
+    ASSERT_EQ(messageCount * 16U, handler.m_events.size());
+
+    for (size_t i = 0U; i < messageCount; i++)
+    {
+        const std::vector<std::string> events(handler.m_events.begin() + (i * 16U),
+                                              handler.m_events.begin() + ((i + 1U) * 16U));
+        EXPECT_EQ("xml:1.0", events[0]);
+        EXPECT_EQ("start:msg id=1", events[1]);
+        EXPECT_EQ("end:msg", events[5]);
+        EXPECT_EQ("end of document", events[6]);
+        EXPECT_EQ("comment:c", events[7]);
+        EXPECT_EQ("start:msg id=2", events[8]);
+        EXPECT_EQ("end of document", events[10]);
+        EXPECT_EQ("xml:1.0", events[11]);
+        EXPECT_EQ("text:x", events[13]);
+        EXPECT_EQ("end of document", events[15]);
+    }
+
+    // Values of the previous document are available until the next call to parse()
+    xmlReader.writeData("<?xml version=\"1.0\"?><a/><b/>");
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+    EXPECT_EQ(XmlDeclaration::Version_v1_0, xmlReader.xmlDeclaration().version());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlDeclaration::Version_None, xmlReader.xmlDeclaration().version());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+
+    // XML declaration is only allowed at the start of a document
+    xmlReader.writeData("<a><?xml version=\"1.0\"?></a>");
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_Error, xmlReader.parse());
+}
+
+TEST(EmbeddedStAX_XmlReader_XmlReader, ReleaseMemoryTest)
+{
+    // Idle reader holds only its state and configuration
+    EXPECT_TRUE(sizeof(XmlReader) < 256U);
+
+    XmlReader xmlReader;
+    xmlReader.setEventMask(XmlReader::EventMask_All & ~XmlReader::EventMask_Comment);
+    xmlReader.setTextChunkSize(4U);
+    const uint32_t key = xmlReader.registerAttributeKey(Utf8::toUnicodeString("id"));
+
+    EXPECT_TRUE(xmlReader.releaseMemory());
+    EXPECT_TRUE(xmlReader.name().empty());
+    EXPECT_TRUE(xmlReader.text().empty());
+
+    // Reader is not idle inside of a document or a token
+    xmlReader.writeData("<msg id='1'><!--c-->");
+    EXPECT_FALSE(xmlReader.releaseMemory());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.releaseMemory());
+
+    xmlReader.writeData("</msg>\n\n<");
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_FALSE(xmlReader.releaseMemory());
+
+    xmlReader.writeData("msg id='2'/> \n");
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+
+    // Reader is idle after the end of the document (with or without the trailing whitespace)
+    EXPECT_TRUE(xmlReader.releaseMemory());
+    EXPECT_TRUE(xmlReader.name().empty());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.releaseMemory());
+    EXPECT_TRUE(xmlReader.releaseMemory());
+    const size_t inputOffset = xmlReader.inputOffset();
+
+    // Reader continues with the next document and keeps its configuration
+    xmlReader.writeData(" <?xml version=\"1.0\"?><msg id='3'><!--c-->text text");
+    EXPECT_EQ(inputOffset + 51U, xmlReader.inputOffset());
+    EXPECT_EQ(XmlReader::ParsingResult_XmlDeclaration, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_StartOfElement, xmlReader.parse());
+    ASSERT_TRUE(xmlReader.attribute(key) != NULL);
+    EXPECT_EQ(Utf8::toUnicodeString("3"), xmlReader.attribute(key)->value());
+    EXPECT_EQ(XmlReader::ParsingResult_TextChunk, xmlReader.parse());
+    EXPECT_EQ(Utf8::toUnicodeString("text"), xmlReader.text());
+
+    xmlReader.writeData("</msg>");
+    EXPECT_EQ(XmlReader::ParsingResult_TextNode, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfElement, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_EndOfDocument, xmlReader.parse());
+    EXPECT_EQ(XmlReader::ParsingResult_NeedMoreData, xmlReader.parse());
+    EXPECT_TRUE(xmlReader.releaseMemory());
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlWriter/XmlOutputStream.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <cstdio>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+using namespace EmbeddedStAX::Common;
+using namespace EmbeddedStAX::XmlWriter;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlWriter::XmlOutputStream
+//--------------------------------------------------------------------------------------------------
+namespace
+{
+struct CallbackData
+{
+    std::string data;
+    size_t callCount;
+    bool success;
+};
+
+bool callback(const char *data, const size_t size, void *userData)
+{
+    CallbackData *callbackData = static_cast<CallbackData *>(userData);
+    callbackData->callCount++;
+
+    if (callbackData->success)
+    {
+        callbackData->data.append(data, size);
+    }
+
+    return callbackData->success;
+}
+}
+
+TEST(EmbeddedStAX_XmlWriter_XmlOutputStream, StringOutputStreamTest)
+{
+    std::string output;
+    StringOutputStream outputStream(&output, 8U);
+
+    EXPECT_TRUE(outputStream.isValid());
+    EXPECT_EQ(8U, outputStream.bufferSize());
+
+    // Data is kept in the buffer until it gets full
+    EXPECT_TRUE(outputStream.writeAscii("<root>"));
+    EXPECT_TRUE(output.empty());
+    EXPECT_EQ(6U, outputStream.bufferedSize());
+
+    // Multi-byte characters are not split between the blocks
+    EXPECT_TRUE(outputStream.write(Utf8::toUnicodeString("\xC3\xA4\xE2\x82\xAC")));
+    EXPECT_EQ("<root>\xC3\xA4", output);
+    EXPECT_EQ(3U, outputStream.bufferedSize());
+
+    EXPECT_TRUE(outputStream.writeAscii("</root>"));
+    EXPECT_TRUE(outputStream.flush());
+    EXPECT_EQ("<root>\xC3\xA4\xE2\x82\xAC</root>", output);
+    EXPECT_EQ(output.size(), outputStream.bytesWritten());
+    EXPECT_EQ(0U, outputStream.bufferedSize());
+
+    // Invalid character
+    EXPECT_FALSE(outputStream.write(0x110000U));
+    EXPECT_FALSE(outputStream.isValid());
+    EXPECT_FALSE(outputStream.writeAscii("a"));
+}
+
+TEST(EmbeddedStAX_XmlWriter_XmlOutputStream, FileOutputStreamTest)
+{
+    std::FILE *file = std::tmpfile();
+    ASSERT_TRUE(file != NULL);
+
+    {
+        FileOutputStream outputStream(file);
+        EXPECT_TRUE(outputStream.writeAscii("<root/>"));
+    }
+
+    // Buffered data is written when the stream is destroyed
+    char data[16] = {};
+    std::rewind(file);
+    EXPECT_EQ(7U, std::fread(data, 1U, sizeof(data), file));
+    EXPECT_EQ(std::string("<root/>"), data);
+    std::fclose(file);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(EmbeddedStAX_XmlWriter_XmlOutputStream, FileDescriptorOutputStreamTest)
+{
+    int fileDescriptors[2];
+    ASSERT_EQ(0, pipe(fileDescriptors));
+
+    FileDescriptorOutputStream outputStream(fileDescriptors[1]);
+    EXPECT_TRUE(outputStream.writeAscii("<root/>"));
+    EXPECT_TRUE(outputStream.flush());
+
+    char data[16] = {};
+    EXPECT_EQ(7, read(fileDescriptors[0], data, sizeof(data)));
+    EXPECT_EQ(std::string("<root/>"), data);
+    close(fileDescriptors[0]);
+    close(fileDescriptors[1]);
+
+    // Write to a closed file descriptor fails
+    EXPECT_TRUE(outputStream.writeAscii("<root/>"));
+    EXPECT_FALSE(outputStream.flush());
+    EXPECT_FALSE(outputStream.isValid());
+}
+#endif
+
+TEST(EmbeddedStAX_XmlWriter_XmlOutputStream, CallbackOutputStreamTest)
+{
+    CallbackData callbackData;
+    callbackData.callCount = 0U;
+    callbackData.success = true;
+
+    CallbackOutputStream outputStream(&callback, &callbackData, 4U);
+
+    EXPECT_TRUE(outputStream.writeAscii("<root/>"));
+    EXPECT_EQ(1U, callbackData.callCount);
+    EXPECT_TRUE(outputStream.flush());
+    EXPECT_EQ(2U, callbackData.callCount);
+    EXPECT_EQ("<root/>", callbackData.data);
+
+    // Error reported by the callback
+    callbackData.success = false;
+
+    EXPECT_TRUE(outputStream.writeAscii("<a/>"));
+    EXPECT_FALSE(outputStream.writeAscii("<b/>"));
+    EXPECT_FALSE(outputStream.isValid());
+    EXPECT_EQ(3U, callbackData.callCount);
+    EXPECT_EQ(7U, outputStream.bytesWritten());
+}
@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <EmbeddedStAX/XmlWriter/XmlOutputStream.h>
+#include <EmbeddedStAX/XmlWriter/XmlWriter.h>
+#include <EmbeddedStAX/Common/Utf.h>
+#include <string>
+
+using namespace EmbeddedStAX;
+using namespace EmbeddedStAX::Common;
+
+//--------------------------------------------------------------------------------------------------
+// Test case: EmbeddedStAX::XmlWriter::XmlWriter
+//--------------------------------------------------------------------------------------------------
+namespace
+{
+bool writeDocument(XmlWriter::XmlWriter *xmlWriter)
+{
+    AttributeList attributeList;
+    attributeList.add(Attribute(Utf8::toUnicodeString("id"), Utf8::toUnicodeString("a&b")));
+
+    return xmlWriter->writeXmlDeclaration() &&
+           xmlWriter->writeStartOfElement(Utf8::toUnicodeString("root")) &&
+           xmlWriter->writeStartOfElement(Utf8::toUnicodeString("item"), attributeList) &&
+           xmlWriter->writeTextNode(Utf8::toUnicodeString("\xC3\xA4<")) &&
+           xmlWriter->writeEndOfElement() &&
+           xmlWriter->writeEmptyElement(Utf8::toUnicodeString("item")) &&
+           xmlWriter->writeEndOfElement();
+}
+
+const std::string expectedDocument = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><root>"
+                                     "<item id=\"a&amp;b\">\xC3\xA4&lt;</item><item/></root>";
+
+struct CallbackData
+{
+    std::string data;
+    size_t callCount;
+    bool success;
+};
+
+bool callback(const char *data, const size_t size, void *userData)
+{
+    CallbackData *callbackData = static_cast<CallbackData *>(userData);
+    callbackData->callCount++;
+
+    if (callbackData->success)
+    {
+        callbackData->data.append(data, size);
+    }
+
+    return callbackData->success;
+}
+}
+
+TEST(EmbeddedStAX_XmlWriter_XmlWriter, MemoryTest)
+{
+    XmlWriter::XmlWriter xmlWriter;
+
+    EXPECT_TRUE(xmlWriter.outputStream() == NULL);
+    ASSERT_TRUE(writeDocument(&xmlWriter));
+    EXPECT_EQ(expectedDocument, Utf8::toUtf8(xmlWriter.xmlString()));
+    EXPECT_TRUE(xmlWriter.flush());
+}
+
+TEST(EmbeddedStAX_XmlWriter_XmlWriter, OutputStreamTest)
+{
+    std::string output;
+    XmlWriter::StringOutputStream outputStream(&output);
+    XmlWriter::XmlWriter xmlWriter(&outputStream);
+
+    EXPECT_EQ(&outputStream, xmlWriter.outputStream());
+    EXPECT_EQ(1U, xmlWriter.flushDepth());
+
+    // Output is flushed at the end of the root element
+    ASSERT_TRUE(xmlWriter.writeXmlDeclaration());
+    ASSERT_TRUE(xmlWriter.writeStartOfElement(Utf8::toUnicodeString("root")));
+    EXPECT_TRUE(output.empty());
+    ASSERT_TRUE(xmlWriter.writeEmptyElement(Utf8::toUnicodeString("item")));
+    EXPECT_TRUE(output.empty());
+    ASSERT_TRUE(xmlWriter.writeEndOfElement());
+    EXPECT_EQ("<?xml version=\"1.0\" encoding=\"UTF-8\"?><root><item/></root>", output);
+    EXPECT_TRUE(xmlWriter.xmlString().empty());
+
+    // Each record element is flushed
+    output.clear();
+    xmlWriter.clearDocument();
+    xmlWriter.setFlushDepth(2U);
+
+    ASSERT_TRUE(xmlWriter.writeStartOfElement(Utf8::toUnicodeString("root")));
+    ASSERT_TRUE(xmlWriter.writeStartOfElement(Utf8::toUnicodeString("item")));
+    ASSERT_TRUE(xmlWriter.writeEmptyElement(Utf8::toUnicodeString("value")));
+    EXPECT_TRUE(output.empty());
+    ASSERT_TRUE(xmlWriter.writeEndOfElement());
+    EXPECT_EQ("<root><item><value/></item>", output);
+    ASSERT_TRUE(xmlWriter.writeEmptyElement(Utf8::toUnicodeString("item")));
+    EXPECT_EQ("<root><item><value/></item><item/>", output);
+    ASSERT_TRUE(xmlWriter.writeEndOfElement());
+    EXPECT_EQ("<root><item><value/></item><item/></root>", output);
+
+    // Same document as in memory
+    output.clear();
+    xmlWriter.clearDocument();
+    ASSERT_TRUE(writeDocument(&xmlWriter));
+    EXPECT_EQ(expectedDocument, output);
+}
+
+TEST(EmbeddedStAX_XmlWriter_XmlWriter, OutputStreamErrorTest)
+{
+    CallbackData callbackData;
+    callbackData.callCount = 0U;
+    callbackData.success = false;
+
+    XmlWriter::CallbackOutputStream outputStream(&callback, &callbackData, 16U);
+    XmlWriter::XmlWriter xmlWriter(&outputStream);
+
+    // Error is reported when the buffered data is passed to the sink
+    ASSERT_TRUE(xmlWriter.writeStartOfElement(Utf8::toUnicodeString("root")));
+    EXPECT_FALSE(xmlWriter.writeComment(Utf8::toUnicodeString("long comment text")));
+    EXPECT_EQ(1U, callbackData.callCount);
+    EXPECT_FALSE(xmlWriter.writeEndOfElement());
+    EXPECT_FALSE(xmlWriter.flush());
+}